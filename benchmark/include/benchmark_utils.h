@@ -0,0 +1,44 @@
+#ifndef CONCURRENCPP_BENCHMARK_UTILS_H
+#define CONCURRENCPP_BENCHMARK_UTILS_H
+
+#include <chrono>
+#include <string>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+
+namespace concurrencpp::benchmarks {
+    class stopwatch {
+
+       private:
+        const std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+
+       public:
+        std::chrono::nanoseconds elapsed() const noexcept {
+            return std::chrono::steady_clock::now() - m_start;
+        }
+    };
+
+    template<class function_type>
+    std::chrono::nanoseconds measure(function_type&& function) {
+        stopwatch watch;
+        function();
+        return watch.elapsed();
+    }
+
+    inline void report(std::string_view name, std::chrono::nanoseconds elapsed, size_t operations) {
+        const auto ns = static_cast<double>(elapsed.count());
+        const auto ms = ns / 1'000'000.0;
+
+        std::cout << std::left << std::setw(48) << name << std::right << std::fixed << std::setprecision(2) << std::setw(12) << ms
+                  << " ms";
+
+        if (operations != 0) {
+            std::cout << std::setw(12) << ns / static_cast<double>(operations) << " ns/op";
+        }
+
+        std::cout << std::endl;
+    }
+}  // namespace concurrencpp::benchmarks
+
+#endif
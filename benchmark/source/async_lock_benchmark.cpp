@@ -0,0 +1,78 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "benchmark_utils.h"
+
+#include <vector>
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+
+namespace {
+    result<void> lock_unlock(executor_tag, std::shared_ptr<executor> ex, async_lock& lock, size_t& counter, size_t iterations) {
+        for (size_t i = 0; i < iterations; i++) {
+            auto guard = co_await lock.lock_awaitable(ex);
+            ++counter;
+        }
+    }
+
+    lazy_result<void> lock_unlock_inline(std::shared_ptr<executor> ex, async_lock& lock, size_t& counter, size_t iterations) {
+        for (size_t i = 0; i < iterations; i++) {
+            auto guard = co_await lock.lock_awaitable(ex);
+            ++counter;
+        }
+    }
+
+    void uncontended_benchmark(size_t iterations) {
+        async_lock lock;
+        size_t counter = 0;
+        auto ex = std::make_shared<inline_executor>();
+
+        const auto elapsed = measure([&] {
+            lock_unlock_inline(ex, lock, counter, iterations).run().get();
+        });
+
+        report("uncontended lock + unlock", elapsed, iterations);
+    }
+
+    void contended_benchmark(size_t worker_count, size_t iterations) {
+        async_lock lock;
+        size_t counter = 0;
+
+        std::vector<std::shared_ptr<worker_thread_executor>> workers(worker_count);
+        for (auto& worker : workers) {
+            worker = std::make_shared<worker_thread_executor>();
+        }
+
+        std::vector<result<void>> results;
+        results.reserve(worker_count);
+
+        const auto elapsed = measure([&] {
+            for (auto& worker : workers) {
+                results.emplace_back(lock_unlock({}, worker, lock, counter, iterations));
+            }
+
+            for (auto& result : results) {
+                result.get();
+            }
+        });
+
+        for (auto& worker : workers) {
+            worker->shutdown();
+        }
+
+        const auto name = std::to_string(worker_count) + "-way contended lock + unlock";
+        report(name, elapsed, worker_count * iterations);
+    }
+}  // namespace
+
+int main() {
+    constexpr size_t iterations = 1'000'000;
+
+    uncontended_benchmark(iterations * 10);
+
+    for (const auto worker_count : {2, 8, 32}) {
+        contended_benchmark(worker_count, iterations / worker_count * 2);
+    }
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "benchmark_utils.h"
+
+#include <array>
+#include <numeric>
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+
+namespace {
+    generator<size_t> per_element_range(size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            co_yield i;
+        }
+    }
+
+    template<size_t block_size>
+    generator<size_t> span_range(size_t count) {
+        std::array<size_t, block_size> block;
+
+        for (size_t i = 0; i < count; i += block_size) {
+            const auto size = std::min(block_size, count - i);
+            std::iota(block.begin(), block.begin() + size, i);
+            co_yield std::span<size_t>(block.data(), size);
+        }
+    }
+
+    // keeps the compiler from folding the loops away
+    volatile size_t g_sink = 0;
+
+    void hand_written_loop_benchmark(size_t count) {
+        const auto elapsed = measure([count] {
+            size_t sum = 0;
+            for (size_t i = 0; i < count; i++) {
+                sum += i;
+                g_sink = sum;
+            }
+        });
+
+        report("hand written loop", elapsed, count);
+    }
+
+    void per_element_yield_benchmark(size_t count) {
+        const auto elapsed = measure([count] {
+            size_t sum = 0;
+            for (const auto value : per_element_range(count)) {
+                sum += value;
+                g_sink = sum;
+            }
+        });
+
+        report("generator, co_yield per element", elapsed, count);
+    }
+
+    template<size_t block_size>
+    void span_yield_benchmark(size_t count) {
+        const auto elapsed = measure([count] {
+            size_t sum = 0;
+            for (const auto value : span_range<block_size>(count)) {
+                sum += value;
+                g_sink = sum;
+            }
+        });
+
+        const auto name = "generator, co_yield std::span (" + std::to_string(block_size) + ")";
+        report(name, elapsed, count);
+    }
+}  // namespace
+
+int main() {
+    constexpr size_t count = 100'000'000;
+
+    hand_written_loop_benchmark(count);
+    per_element_yield_benchmark(count);
+    span_yield_benchmark<16>(count);
+    span_yield_benchmark<256>(count);
+    span_yield_benchmark<4'096>(count);
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "benchmark_utils.h"
+
+#include <numeric>
+#include <execution>
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+
+namespace {
+    // keeps the compiler from folding the reductions away
+    volatile double g_sink = 0;
+
+    template<class function_type>
+    void run_benchmark(std::string_view name, size_t count, function_type function) {
+        function();  // warm up: page in the input and start the workers
+
+        constexpr size_t rounds = 10;
+        const auto elapsed = measure([&function] {
+            for (size_t i = 0; i < rounds; i++) {
+                g_sink = static_cast<double>(function());
+            }
+        });
+
+        report(name, elapsed, count * rounds);
+    }
+
+    template<class type>
+    void reduce_benchmarks(std::string_view type_name, std::shared_ptr<thread_pool_executor> tpe, size_t count) {
+        std::vector<type> values(count);
+        std::iota(values.begin(), values.end(), type(0));
+
+        const auto name = [type_name](std::string_view algorithm) {
+            return std::string(algorithm) + " <" + std::string(type_name) + ">";
+        };
+
+        run_benchmark(name("std::reduce"), count, [&] {
+            return std::reduce(values.begin(), values.end(), type(0));
+        });
+
+        run_benchmark(name("std::reduce(par)"), count, [&] {
+            return std::reduce(std::execution::par, values.begin(), values.end(), type(0));
+        });
+
+        run_benchmark(name("parallel_reduce"), count, [&] {
+            return parallel_reduce(tpe, values, type(0)).run().get();
+        });
+
+        run_benchmark(name("parallel_reduce, deterministic"), count, [&] {
+            return parallel_reduce(tpe, values, type(0), std::plus<> {}, {.deterministic = true}).run().get();
+        });
+
+        const auto square = [](type value) {
+            return value * value;
+        };
+
+        run_benchmark(name("std::transform_reduce(par)"), count, [&] {
+            return std::transform_reduce(std::execution::par, values.begin(), values.end(), type(0), std::plus<> {}, square);
+        });
+
+        run_benchmark(name("parallel_transform_reduce"), count, [&] {
+            return parallel_transform_reduce(tpe, values, type(0), std::plus<> {}, square).run().get();
+        });
+    }
+}  // namespace
+
+int main() {
+    constexpr size_t count = 50'000'000;
+
+    runtime runtime;
+    const auto tpe = runtime.thread_pool_executor();
+    std::cout << "thread_pool_executor workers: " << tpe->max_concurrency_level() << std::endl;
+
+    reduce_benchmarks<int64_t>("int64_t", tpe, count);
+    reduce_benchmarks<double>("double", tpe, count);
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "benchmark_utils.h"
+
+#include <random>
+#include <algorithm>
+
+using namespace concurrencpp;
+using namespace concurrencpp::benchmarks;
+
+namespace {
+    struct record {
+        uint64_t key;
+        uint64_t payload[3];
+
+        friend bool operator<(const record& lhs, const record& rhs) noexcept {
+            return lhs.key < rhs.key;
+        }
+    };
+
+    template<class type>
+    std::vector<type> make_input(size_t count) {
+        std::mt19937_64 engine(20'230'101);
+        std::vector<type> values(count);
+
+        for (auto& value : values) {
+            const auto random = engine();
+            if constexpr (std::is_same_v<type, std::string>) {
+                value = std::to_string(random);
+            } else if constexpr (std::is_same_v<type, record>) {
+                value = record {random, {random, random, random}};
+            } else {
+                value = static_cast<type>(random);
+            }
+        }
+
+        return values;
+    }
+
+    template<class type>
+    void sort_benchmarks(std::string_view type_name, size_t count) {
+        const auto input = make_input<type>(count);
+        const auto name = [type_name](std::string_view algorithm) {
+            return std::string(algorithm) + " <" + std::string(type_name) + ">";
+        };
+
+        {
+            auto values = input;
+            const auto elapsed = measure([&values] {
+                std::sort(values.begin(), values.end());
+            });
+
+            report(name("std::sort"), elapsed, count);
+        }
+
+        for (const size_t worker_count : {1, 2, 4, 8, 16}) {
+            auto executor = std::make_shared<thread_pool_executor>("threadpool", worker_count, std::chrono::seconds(10));
+            auto values = input;
+
+            const auto elapsed = measure([&] {
+                parallel_sort(executor, values.begin(), values.end()).run().get();
+            });
+
+            executor->shutdown();
+            report(name("parallel_sort, " + std::to_string(worker_count) + " workers"), elapsed, count);
+        }
+    }
+}  // namespace
+
+int main() {
+    constexpr size_t count = 10'000'000;
+
+    sort_benchmarks<uint32_t>("uint32_t", count);
+    sort_benchmarks<double>("double", count);
+    sort_benchmarks<record>("32 byte record", count);
+    sort_benchmarks<std::string>("std::string", count / 4);
+
+    return 0;
+}
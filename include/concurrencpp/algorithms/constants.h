@@ -0,0 +1,21 @@
+#ifndef CONCURRENCPP_ALGORITHMS_CONSTS_H
+#define CONCURRENCPP_ALGORITHMS_CONSTS_H
+
+namespace concurrencpp::details::consts {
+    inline const char* k_parallel_for_null_executor_err_msg = "concurrencpp::parallel_for() - given executor is null.";
+
+    inline const char* k_parallel_transform_null_executor_err_msg = "concurrencpp::parallel_transform() - given executor is null.";
+
+    inline const char* k_parallel_reduce_null_executor_err_msg = "concurrencpp::parallel_reduce() - given executor is null.";
+
+    inline const char* k_parallel_transform_reduce_null_executor_err_msg =
+        "concurrencpp::parallel_transform_reduce() - given executor is null.";
+
+    inline const char* k_parallel_sort_null_executor_err_msg = "concurrencpp::parallel_sort() - given executor is null.";
+
+    inline const char* k_parallel_inclusive_scan_null_executor_err_msg = "concurrencpp::parallel_inclusive_scan() - given executor is null.";
+
+    inline const char* k_parallel_exclusive_scan_null_executor_err_msg = "concurrencpp::parallel_exclusive_scan() - given executor is null.";
+}  // namespace concurrencpp::details::consts
+
+#endif
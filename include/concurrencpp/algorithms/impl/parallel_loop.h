@@ -0,0 +1,151 @@
+#ifndef CONCURRENCPP_PARALLEL_LOOP_H
+#define CONCURRENCPP_PARALLEL_LOOP_H
+
+#include "concurrencpp/errors.h"
+#include "concurrencpp/coroutines/coroutine.h"
+#include "concurrencpp/results/constants.h"
+#include "concurrencpp/results/lazy_result.h"
+#include "concurrencpp/executors/thread_pool_executor.h"
+
+#include <atomic>
+#include <cassert>
+#include <algorithm>
+#include <exception>
+
+namespace concurrencpp::details {
+    /*
+     *  Runs body(begin, end) over the index range [0, count) with lazy binary splitting:
+     *  a range is consumed grain_size indices at a time, and between two chunks, if the pool has an idle worker,
+     *  the upper half of what is left is handed to that worker. Ranges are only split when there is a worker
+     *  to run them, so a busy pool runs the loop (almost) serially and an idle one spreads it across all of its workers.
+     *  The awaiting coroutine is resumed by whichever thread finishes the last range.
+     */
+    template<class body_type>
+    class parallel_loop {
+
+       private:
+        class range_task {
+
+           private:
+            parallel_loop* m_loop;
+            size_t m_begin;
+            size_t m_end;
+
+           public:
+            range_task(parallel_loop& loop, size_t begin, size_t end) noexcept : m_loop(&loop), m_begin(begin), m_end(end) {}
+
+            range_task(range_task&& rhs) noexcept :
+                m_loop(std::exchange(rhs.m_loop, nullptr)), m_begin(rhs.m_begin), m_end(rhs.m_end) {}
+
+            ~range_task() noexcept {
+                if (m_loop == nullptr) {
+                    return;
+                }
+
+                // the range was never executed (the executor was shut down)
+                m_loop->set_exception(std::make_exception_ptr(errors::broken_task(consts::k_broken_task_exception_error_msg)));
+                m_loop->finish_range();
+            }
+
+            void operator()() noexcept {
+                std::exchange(m_loop, nullptr)->run_range(m_begin, m_end);
+            }
+        };
+
+       private:
+        thread_pool_executor& m_executor;
+        const body_type& m_body;
+        const size_t m_count;
+        const size_t m_grain_size;
+        std::atomic_size_t m_pending_ranges {1};
+        std::atomic_bool m_failed {false};
+        std::exception_ptr m_exception;
+        coroutine_handle<void> m_caller_handle;
+
+        void set_exception(std::exception_ptr exception) noexcept {
+            if (!m_failed.exchange(true, std::memory_order_relaxed)) {
+                m_exception = std::move(exception);  // published by the acq_rel decrement in finish_range
+            }
+        }
+
+        void finish_range() noexcept {
+            if (m_pending_ranges.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                m_caller_handle.resume();
+            }
+        }
+
+        void split(size_t begin, size_t end) {
+            m_pending_ranges.fetch_add(1, std::memory_order_relaxed);
+
+            task range(range_task(*this, begin, end));
+            if (!m_executor.enqueue_to_idle_worker(range)) {
+                range();  // another splitter took the idle worker first
+            }
+        }
+
+        void run_range(size_t begin, size_t end) noexcept {
+            try {
+                while (begin < end && !m_failed.load(std::memory_order_relaxed)) {
+                    const auto remaining = end - begin;
+                    if (remaining > m_grain_size && m_executor.has_idle_workers()) {
+                        const auto middle = begin + remaining / 2;
+                        split(middle, end);
+                        end = middle;
+                        continue;
+                    }
+
+                    const auto chunk_end = begin + std::min(remaining, m_grain_size);
+                    m_body(begin, chunk_end);
+                    begin = chunk_end;
+                }
+            } catch (...) {
+                set_exception(std::current_exception());
+            }
+
+            finish_range();
+        }
+
+       public:
+        parallel_loop(thread_pool_executor& executor, const body_type& body, size_t count, size_t grain_size) noexcept :
+            m_executor(executor), m_body(body), m_count(count), m_grain_size(grain_size) {
+            assert(grain_size != 0);
+        }
+
+        bool await_ready() const noexcept {
+            return m_count == 0;
+        }
+
+        void await_suspend(coroutine_handle<void> caller_handle) noexcept {
+            m_caller_handle = caller_handle;
+
+            try {
+                m_executor.post(range_task(*this, 0, m_count));
+            } catch (...) {
+                // the range_task has already reported the failure and resumed the caller
+            }
+        }
+
+        void await_resume() const {
+            if (static_cast<bool>(m_exception)) {
+                std::rethrow_exception(m_exception);
+            }
+        }
+    };
+
+    inline size_t default_grain_size(size_t count, size_t concurrency_level) noexcept {
+        constexpr size_t k_max_default_grain_size = 2'048;
+        const auto chunks_per_worker = std::max(concurrency_level, static_cast<size_t>(1)) * 8;
+        return std::clamp(count / chunks_per_worker, static_cast<size_t>(1), k_max_default_grain_size);
+    }
+
+    template<class body_type>
+    lazy_result<void> run_parallel_loop(std::shared_ptr<thread_pool_executor> executor, size_t count, size_t grain_size, body_type body) {
+        if (grain_size == 0) {
+            grain_size = default_grain_size(count, static_cast<size_t>(executor->max_concurrency_level()));
+        }
+
+        co_await parallel_loop<body_type>(*executor, body, count, grain_size);
+    }
+}  // namespace concurrencpp::details
+
+#endif
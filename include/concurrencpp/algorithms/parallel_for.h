@@ -0,0 +1,128 @@
+#ifndef CONCURRENCPP_PARALLEL_FOR_H
+#define CONCURRENCPP_PARALLEL_FOR_H
+
+#include "concurrencpp/algorithms/constants.h"
+#include "concurrencpp/algorithms/impl/parallel_loop.h"
+
+#include <ranges>
+#include <vector>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+namespace concurrencpp::details {
+    template<class range_type>
+    concept parallel_range = std::ranges::random_access_range<range_type> && std::ranges::sized_range<range_type> &&
+        std::ranges::viewable_range<range_type>;
+
+    template<class view_type, class function_type>
+    using parallel_transform_result_t =
+        std::decay_t<std::invoke_result_t<const function_type&, std::ranges::range_reference_t<const view_type>>>;
+
+    template<class view_type, class function_type>
+    lazy_result<std::vector<parallel_transform_result_t<view_type, function_type>>> parallel_transform_to_vector(
+        std::shared_ptr<thread_pool_executor> executor,
+        view_type view,
+        function_type function,
+        size_t grain_size) {
+        using result_type = parallel_transform_result_t<view_type, function_type>;
+
+        std::vector<result_type> results(std::ranges::size(view));
+
+        co_await run_parallel_loop(std::move(executor),
+                                   results.size(),
+                                   grain_size,
+                                   [&view, &function, output = results.data()](size_t begin, size_t end) {
+                                       auto it = std::ranges::begin(std::as_const(view)) + begin;
+                                       for (auto i = begin; i < end; ++i, ++it) {
+                                           output[i] = function(*it);
+                                       }
+                                   });
+
+        co_return results;
+    }
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+     *  Invokes function(element) for every element of range, in parallel, inside executor.
+     *  The returned lazy_result completes when every element has been processed.
+     *  If function throws, the remaining chunks are skipped and the first exception is rethrown by the lazy_result.
+     *  function might be invoked concurrently from several threads, so it's taken as const.
+     *  grain_size is the minimal amount of elements processed serially; 0 lets the library pick a size.
+     */
+    template<details::parallel_range range_type, class function_type>
+    lazy_result<void> parallel_for(std::shared_ptr<thread_pool_executor> executor,
+                                   range_type&& range,
+                                   function_type function,
+                                   size_t grain_size = 0) {
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(details::consts::k_parallel_for_null_executor_err_msg);
+        }
+
+        auto view = std::views::all(std::forward<range_type>(range));
+        const auto count = static_cast<size_t>(std::ranges::size(view));
+
+        return details::run_parallel_loop(std::move(executor),
+                                          count,
+                                          grain_size,
+                                          [view = std::move(view), function = std::move(function)](size_t begin, size_t end) {
+                                              auto it = std::ranges::begin(view) + begin;
+                                              for (auto i = begin; i < end; ++i, ++it) {
+                                                  function(*it);
+                                              }
+                                          });
+    }
+
+    /*
+     *  Writes function(range[i]) to output[i] for every element of range, in parallel, inside executor.
+     *  output must be able to hold std::ranges::size(range) elements.
+     */
+    template<details::parallel_range range_type, std::random_access_iterator output_iterator, class function_type>
+    lazy_result<void> parallel_transform(std::shared_ptr<thread_pool_executor> executor,
+                                         range_type&& range,
+                                         output_iterator output,
+                                         function_type function,
+                                         size_t grain_size = 0) {
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(details::consts::k_parallel_transform_null_executor_err_msg);
+        }
+
+        auto view = std::views::all(std::forward<range_type>(range));
+        const auto count = static_cast<size_t>(std::ranges::size(view));
+
+        return details::run_parallel_loop(
+            std::move(executor),
+            count,
+            grain_size,
+            [view = std::move(view), output, function = std::move(function)](size_t begin, size_t end) {
+                auto it = std::ranges::begin(view) + begin;
+                auto out = output + begin;
+                for (auto i = begin; i < end; ++i, ++it, ++out) {
+                    *out = function(*it);
+                }
+            });
+    }
+
+    /*
+     *  Returns a std::vector holding function(range[i]) for every element of range, computed in parallel inside executor.
+     */
+    template<details::parallel_range range_type, class function_type>
+    auto parallel_transform(std::shared_ptr<thread_pool_executor> executor, range_type&& range, function_type function, size_t grain_size = 0)
+        -> lazy_result<std::vector<details::parallel_transform_result_t<std::views::all_t<range_type>, function_type>>> {
+        using result_type = details::parallel_transform_result_t<std::views::all_t<range_type>, function_type>;
+        static_assert(std::is_default_constructible_v<result_type>,
+                      "concurrencpp::parallel_transform - the result type of <<function>> must be default constructible.");
+
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(details::consts::k_parallel_transform_null_executor_err_msg);
+        }
+
+        return details::parallel_transform_to_vector(std::move(executor),
+                                                     std::views::all(std::forward<range_type>(range)),
+                                                     std::move(function),
+                                                     grain_size);
+    }
+}  // namespace concurrencpp
+
+#endif
@@ -0,0 +1,237 @@
+#ifndef CONCURRENCPP_PARALLEL_REDUCE_H
+#define CONCURRENCPP_PARALLEL_REDUCE_H
+
+#include "concurrencpp/threads/cache_line.h"
+#include "concurrencpp/algorithms/constants.h"
+#include "concurrencpp/algorithms/parallel_for.h"
+
+#include <memory>
+#include <optional>
+#include <functional>
+
+namespace concurrencpp {
+    struct parallel_reduce_options {
+        /*
+            The minimal number of elements reduced serially as one leaf.
+            0 lets concurrencpp pick a size.
+        */
+        size_t grain_size = 0;
+
+        /*
+            If true, the range is cut into fixed blocks of grain_size elements and the block results are combined
+            from left to right, so the result doesn't depend on the number of workers or on how the work was scheduled.
+            If grain_size is 0, the block size depends only on the size of the range.
+        */
+        bool deterministic = false;
+    };
+}  // namespace concurrencpp
+
+namespace concurrencpp::details {
+    template<class type>
+    struct alignas(CRCPP_CACHE_LINE_ALIGNMENT) padded_partial {
+        std::optional<type> value;
+
+        template<class reduce_type>
+        void merge(type leaf_result, const reduce_type& reduce) {
+            if (value.has_value()) {
+                *value = reduce(std::move(*value), std::move(leaf_result));
+                return;
+            }
+
+            value.emplace(std::move(leaf_result));
+        }
+    };
+
+    /*
+     *  Reduces the non-empty sequence [first, first + count) serially. Four independent accumulators break
+     *  the loop-carried dependency of a single accumulator, which lets the compiler vectorize (or at least pipeline)
+     *  the inner loop. This relies on reduce being associative and commutative, like std::reduce does.
+     */
+    template<class type, class iterator_type, class reduce_type, class transform_type>
+    type reduce_leaf(iterator_type first, size_t count, const reduce_type& reduce, const transform_type& transform) {
+        assert(count != 0);
+
+        if (count < 8) {
+            type result = static_cast<type>(transform(first[0]));
+            for (size_t i = 1; i < count; i++) {
+                result = reduce(std::move(result), transform(first[i]));
+            }
+
+            return result;
+        }
+
+        type acc0 = static_cast<type>(transform(first[0]));
+        type acc1 = static_cast<type>(transform(first[1]));
+        type acc2 = static_cast<type>(transform(first[2]));
+        type acc3 = static_cast<type>(transform(first[3]));
+
+        size_t i = 4;
+        for (; i + 4 <= count; i += 4) {
+            acc0 = reduce(std::move(acc0), transform(first[i]));
+            acc1 = reduce(std::move(acc1), transform(first[i + 1]));
+            acc2 = reduce(std::move(acc2), transform(first[i + 2]));
+            acc3 = reduce(std::move(acc3), transform(first[i + 3]));
+        }
+
+        for (; i < count; i++) {
+            acc0 = reduce(std::move(acc0), transform(first[i]));
+        }
+
+        return reduce(reduce(std::move(acc0), std::move(acc1)), reduce(std::move(acc2), std::move(acc3)));
+    }
+
+    template<class type, class view_type, class reduce_type, class transform_type>
+    type reduce_leaf(const view_type& view, size_t begin, size_t end, const reduce_type& reduce, const transform_type& transform) {
+        if constexpr (std::ranges::contiguous_range<const view_type>) {
+            // raw pointers give the compiler a plain counted loop
+            return reduce_leaf<type>(std::ranges::data(view) + begin, end - begin, reduce, transform);
+        } else {
+            return reduce_leaf<type>(std::ranges::begin(view) + begin, end - begin, reduce, transform);
+        }
+    }
+
+    inline size_t deterministic_block_size(size_t count) noexcept {
+        constexpr size_t k_min_block_size = 2'048;
+        constexpr size_t k_max_block_count = 4'096;
+        return std::max(k_min_block_size, (count + k_max_block_count - 1) / k_max_block_count);
+    }
+
+    template<class type, class view_type, class reduce_type, class transform_type>
+    lazy_result<type> deterministic_transform_reduce(std::shared_ptr<thread_pool_executor> executor,
+                                                     view_type view,
+                                                     type init,
+                                                     reduce_type reduce,
+                                                     transform_type transform,
+                                                     size_t block_size) {
+        const auto count = static_cast<size_t>(std::ranges::size(view));
+        if (count == 0) {
+            co_return init;
+        }
+
+        if (block_size == 0) {
+            block_size = deterministic_block_size(count);
+        }
+
+        const auto block_count = (count + block_size - 1) / block_size;
+        std::vector<padded_partial<type>> partials(block_count);
+
+        co_await run_parallel_loop(std::move(executor), block_count, 1, [&](size_t begin, size_t end) {
+            for (auto block = begin; block < end; ++block) {
+                const auto block_begin = block * block_size;
+                const auto block_end = std::min(count, block_begin + block_size);
+                partials[block].value.emplace(reduce_leaf<type>(view, block_begin, block_end, reduce, transform));
+            }
+        });
+
+        for (auto& partial : partials) {
+            init = reduce(std::move(init), std::move(*partial.value));
+        }
+
+        co_return init;
+    }
+
+    template<class type, class view_type, class reduce_type, class transform_type>
+    lazy_result<type> unordered_transform_reduce(std::shared_ptr<thread_pool_executor> executor,
+                                                 view_type view,
+                                                 type init,
+                                                 reduce_type reduce,
+                                                 transform_type transform,
+                                                 size_t grain_size) {
+        const auto count = static_cast<size_t>(std::ranges::size(view));
+        if (count == 0) {
+            co_return init;
+        }
+
+        // every worker folds its leaves into its own slot, so leaves never contend on a shared accumulator
+        const auto& pool = *executor;
+        std::vector<padded_partial<type>> partials(static_cast<size_t>(pool.max_concurrency_level()));
+
+        co_await run_parallel_loop(std::move(executor), count, grain_size, [&](size_t begin, size_t end) {
+            const auto worker_index = pool.current_worker_index();
+            assert(worker_index < partials.size());  // ranges only ever run inside the pool
+            partials[worker_index].merge(reduce_leaf<type>(view, begin, end, reduce, transform), reduce);
+        });
+
+        for (auto& partial : partials) {
+            if (partial.value.has_value()) {
+                init = reduce(std::move(init), std::move(*partial.value));
+            }
+        }
+
+        co_return init;
+    }
+
+    template<class type, class range_type, class reduce_type, class transform_type>
+    lazy_result<type> parallel_transform_reduce_impl(std::shared_ptr<thread_pool_executor> executor,
+                                                     range_type&& range,
+                                                     type init,
+                                                     reduce_type reduce,
+                                                     transform_type transform,
+                                                     parallel_reduce_options options) {
+        auto view = std::views::all(std::forward<range_type>(range));
+
+        if (options.deterministic) {
+            return deterministic_transform_reduce(std::move(executor),
+                                                  std::move(view),
+                                                  std::move(init),
+                                                  std::move(reduce),
+                                                  std::move(transform),
+                                                  options.grain_size);
+        }
+
+        return unordered_transform_reduce(std::move(executor),
+                                          std::move(view),
+                                          std::move(init),
+                                          std::move(reduce),
+                                          std::move(transform),
+                                          options.grain_size);
+    }
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+     *  Reduces init and the elements of range with reduce, in parallel, inside executor.
+     *  Like std::reduce, reduce must be associative and commutative, as elements are grouped and reordered freely.
+     */
+    template<details::parallel_range range_type, class type, class reduce_type = std::plus<>>
+    lazy_result<type> parallel_reduce(std::shared_ptr<thread_pool_executor> executor,
+                                      range_type&& range,
+                                      type init,
+                                      reduce_type reduce = {},
+                                      parallel_reduce_options options = {}) {
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(details::consts::k_parallel_reduce_null_executor_err_msg);
+        }
+
+        return details::parallel_transform_reduce_impl(std::move(executor),
+                                                       std::forward<range_type>(range),
+                                                       std::move(init),
+                                                       std::move(reduce),
+                                                       std::identity {},
+                                                       options);
+    }
+
+    /*
+     *  Reduces init and transform(element) for every element of range with reduce, in parallel, inside executor.
+     */
+    template<details::parallel_range range_type, class type, class reduce_type, class transform_type>
+    lazy_result<type> parallel_transform_reduce(std::shared_ptr<thread_pool_executor> executor,
+                                                range_type&& range,
+                                                type init,
+                                                reduce_type reduce,
+                                                transform_type transform,
+                                                parallel_reduce_options options = {}) {
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(details::consts::k_parallel_transform_reduce_null_executor_err_msg);
+        }
+
+        return details::parallel_transform_reduce_impl(std::move(executor),
+                                                       std::forward<range_type>(range),
+                                                       std::move(init),
+                                                       std::move(reduce),
+                                                       std::move(transform),
+                                                       options);
+    }
+}  // namespace concurrencpp
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef CONCURRENCPP_PARALLEL_SCAN_H
+#define CONCURRENCPP_PARALLEL_SCAN_H
+
+#include "concurrencpp/results/resume_on.h"
+#include "concurrencpp/algorithms/constants.h"
+#include "concurrencpp/algorithms/parallel_reduce.h"
+
+#include <numeric>
+#include <optional>
+
+namespace concurrencpp::details {
+    template<class range_type>
+    concept parallel_contiguous_range = parallel_range<range_type> && std::ranges::contiguous_range<range_type>;
+
+    inline size_t scan_block_size(size_t count, size_t concurrency_level) noexcept {
+        constexpr size_t k_min_block_size = 4'096;
+        const auto blocks = std::max(concurrency_level, static_cast<size_t>(1)) * 4;
+        return std::max(k_min_block_size, (count + blocks - 1) / blocks);
+    }
+
+    /*
+     *  A two-pass blocked scan: the first pass reduces every block but the last one in parallel,
+     *  the block results are scanned serially into per-block offsets, and the second pass scans every block
+     *  in parallel, starting from its offset. Reading the input twice is what buys the parallelism,
+     *  so ranges that fit in a single block are scanned serially, by one worker of the executor.
+     *  Blocks are folded from left to right, as a scan operation needs to be associative but not commutative.
+     */
+    template<class type, class view_type, class output_iterator, class operation_type>
+    lazy_result<void> parallel_scan_impl(std::shared_ptr<thread_pool_executor> executor,
+                                         view_type view,
+                                         output_iterator output,
+                                         std::optional<type> init,
+                                         operation_type operation,
+                                         bool inclusive) {
+        // like parallel_sort, the scan runs inside the executor and not in the thread that awaits it
+        co_await resume_on(*executor);
+
+        const auto count = static_cast<size_t>(std::ranges::size(view));
+        if (count == 0) {
+            co_return;
+        }
+
+        const auto input = std::ranges::data(view);
+
+        auto scan_block = [&](size_t begin, size_t end, std::optional<type> offset) {
+            if (inclusive) {
+                if (offset.has_value()) {
+                    std::inclusive_scan(input + begin, input + end, output + begin, operation, std::move(*offset));
+                } else {
+                    std::inclusive_scan(input + begin, input + end, output + begin, operation);
+                }
+
+                return;
+            }
+
+            assert(offset.has_value());
+            std::exclusive_scan(input + begin, input + end, output + begin, std::move(*offset), operation);
+        };
+
+        const auto block_size = scan_block_size(count, static_cast<size_t>(executor->max_concurrency_level()));
+        if (count <= block_size) {
+            scan_block(0, count, std::move(init));
+            co_return;
+        }
+
+        const auto block_count = (count + block_size - 1) / block_size;
+        std::vector<padded_partial<type>> block_results(block_count);
+
+        co_await run_parallel_loop(executor, block_count - 1, 1, [&](size_t begin, size_t end) {
+            for (auto block = begin; block < end; ++block) {
+                const auto first = input + block * block_size;
+                const auto last = first + block_size;
+
+                type result = *first;
+                for (auto it = first + 1; it != last; ++it) {
+                    result = operation(std::move(result), *it);
+                }
+
+                block_results[block].value.emplace(std::move(result));
+            }
+        });
+
+        // turn the block results into offsets: block i starts from init op result[0] op ... op result[i - 1]
+        std::optional<type> offset = std::move(init);
+        for (auto& block_result : block_results) {
+            auto result = std::exchange(block_result.value, offset);
+            if (!result.has_value()) {
+                break;  // the last block, which isn't reduced
+            }
+
+            offset = offset.has_value() ? operation(std::move(*offset), std::move(*result)) : std::move(*result);
+        }
+
+        co_await run_parallel_loop(std::move(executor), block_count, 1, [&](size_t begin, size_t end) {
+            for (auto block = begin; block < end; ++block) {
+                const auto block_begin = block * block_size;
+                scan_block(block_begin, std::min(count, block_begin + block_size), block_results[block].value);
+            }
+        });
+    }
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+     *  Writes the inclusive prefix scan of range with operation to output, in parallel, inside executor:
+     *  output[i] = range[0] op range[1] op ... op range[i].
+     *  operation must be associative. output may be the beginning of range itself.
+     */
+    template<details::parallel_contiguous_range range_type, std::random_access_iterator output_iterator, class operation_type = std::plus<>>
+    lazy_result<void> parallel_inclusive_scan(std::shared_ptr<thread_pool_executor> executor,
+                                              range_type&& range,
+                                              output_iterator output,
+                                              operation_type operation = {}) {
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(details::consts::k_parallel_inclusive_scan_null_executor_err_msg);
+        }
+
+        using value_type = std::ranges::range_value_t<range_type>;
+        return details::parallel_scan_impl<value_type>(std::move(executor),
+                                                       std::views::all(std::forward<range_type>(range)),
+                                                       output,
+                                                       std::nullopt,
+                                                       std::move(operation),
+                                                       true);
+    }
+
+    /*
+     *  Writes the exclusive prefix scan of range with operation to output, in parallel, inside executor:
+     *  output[0] = init, output[i] = init op range[0] op ... op range[i - 1].
+     *  operation must be associative. output may be the beginning of range itself.
+     */
+    template<details::parallel_contiguous_range range_type,
+             std::random_access_iterator output_iterator,
+             class type,
+             class operation_type = std::plus<>>
+    lazy_result<void> parallel_exclusive_scan(std::shared_ptr<thread_pool_executor> executor,
+                                              range_type&& range,
+                                              output_iterator output,
+                                              type init,
+                                              operation_type operation = {}) {
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(details::consts::k_parallel_exclusive_scan_null_executor_err_msg);
+        }
+
+        return details::parallel_scan_impl<type>(std::move(executor),
+                                                 std::views::all(std::forward<range_type>(range)),
+                                                 output,
+                                                 std::optional<type>(std::move(init)),
+                                                 std::move(operation),
+                                                 false);
+    }
+}  // namespace concurrencpp
+
+#endif
@@ -0,0 +1,187 @@
+#ifndef CONCURRENCPP_PARALLEL_SORT_H
+#define CONCURRENCPP_PARALLEL_SORT_H
+
+#include "concurrencpp/results/result.h"
+#include "concurrencpp/results/resume_on.h"
+#include "concurrencpp/results/lazy_result.h"
+#include "concurrencpp/algorithms/constants.h"
+#include "concurrencpp/executors/thread_pool_executor.h"
+
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+
+namespace concurrencpp::details {
+    template<class compare_type>
+    struct parallel_sort_context {
+        thread_pool_executor& executor;
+        const compare_type& compare;
+        const size_t sort_cutoff;
+        const size_t merge_cutoff;
+    };
+
+    inline result<void> run_forked(executor_tag, thread_pool_executor&, lazy_result<void> task) {
+        co_await task;
+    }
+
+    /*
+     *  Runs left and right, forking right into the executor only if one of its workers is idle.
+     *  Like the parallel loops, a busy pool runs the whole recursion serially.
+     */
+    inline lazy_result<void> fork_join(thread_pool_executor& executor, lazy_result<void> left, lazy_result<void> right) {
+        if (!executor.has_idle_workers()) {
+            co_await left;
+            co_await right;
+            co_return;
+        }
+
+        auto forked = run_forked({}, executor, std::move(right));
+
+        // right still uses the ranges and the context, so it must finish even if left fails
+        std::exception_ptr left_exception;
+        try {
+            co_await left;
+        } catch (...) {
+            left_exception = std::current_exception();
+        }
+
+        co_await forked;
+
+        if (static_cast<bool>(left_exception)) {
+            std::rethrow_exception(left_exception);
+        }
+    }
+
+    /*
+     *  Merges the sorted ranges [first0, last0) and [first1, last1) into output by moving the elements.
+     *  The larger range is split at its middle element, the other one at the matching bound, and both halves are merged
+     *  in parallel. Ties keep the elements of the first range first, like std::merge.
+     */
+    template<class compare_type, class input_iterator, class output_iterator>
+    lazy_result<void> parallel_merge(const parallel_sort_context<compare_type>& context,
+                                     input_iterator first0,
+                                     input_iterator last0,
+                                     input_iterator first1,
+                                     input_iterator last1,
+                                     output_iterator output) {
+        const auto size0 = static_cast<size_t>(last0 - first0);
+        const auto size1 = static_cast<size_t>(last1 - first1);
+
+        if (size0 + size1 <= context.merge_cutoff) {
+            std::merge(std::make_move_iterator(first0),
+                       std::make_move_iterator(last0),
+                       std::make_move_iterator(first1),
+                       std::make_move_iterator(last1),
+                       output,
+                       context.compare);
+            co_return;
+        }
+
+        auto middle0 = first0;
+        auto middle1 = first1;
+
+        if (size0 >= size1) {
+            middle0 = first0 + size0 / 2;
+            middle1 = std::lower_bound(first1, last1, *middle0, context.compare);
+        } else {
+            middle1 = first1 + size1 / 2;
+            middle0 = std::upper_bound(first0, last0, *middle1, context.compare);
+        }
+
+        const auto output_middle = output + (middle0 - first0) + (middle1 - first1);
+
+        co_await fork_join(context.executor,
+                           parallel_merge(context, first0, middle0, first1, middle1, output),
+                           parallel_merge(context, middle0, last0, middle1, last1, output_middle));
+    }
+
+    /*
+     *  Sorts the elements of [first, first + count) of the scratch range. Both halves are sorted in parallel,
+     *  each one ending up in the opposite range of its parent, and are then merged into the range the parent asked for.
+     *  This way the elements move between the two ranges once per level instead of being copied back after each merge.
+     */
+    template<class compare_type, class scratch_iterator, class user_iterator>
+    lazy_result<void> parallel_merge_sort(const parallel_sort_context<compare_type>& context,
+                                          scratch_iterator scratch,
+                                          user_iterator user,
+                                          size_t count,
+                                          bool result_in_scratch) {
+        if (count <= context.sort_cutoff) {
+            std::sort(scratch, scratch + count, context.compare);
+
+            if (!result_in_scratch) {
+                std::move(scratch, scratch + count, user);
+            }
+
+            co_return;
+        }
+
+        const auto left_count = count / 2;
+        co_await fork_join(context.executor,
+                           parallel_merge_sort(context, scratch, user, left_count, !result_in_scratch),
+                           parallel_merge_sort(context, scratch + left_count, user + left_count, count - left_count, !result_in_scratch));
+
+        if (result_in_scratch) {
+            co_await parallel_merge(context, user, user + left_count, user + left_count, user + count, scratch);
+        } else {
+            co_await parallel_merge(context, scratch, scratch + left_count, scratch + left_count, scratch + count, user);
+        }
+    }
+
+    inline size_t default_sort_cutoff(size_t count, size_t concurrency_level) noexcept {
+        constexpr size_t k_min_sort_cutoff = 16'384;
+        const auto leaves = std::max(concurrency_level, static_cast<size_t>(1)) * 4;
+        return std::max(k_min_sort_cutoff, count / leaves);
+    }
+
+    template<class iterator_type, class compare_type>
+    lazy_result<void> parallel_sort_impl(std::shared_ptr<thread_pool_executor> executor,
+                                         iterator_type begin,
+                                         iterator_type end,
+                                         compare_type compare) {
+        using value_type = std::iter_value_t<iterator_type>;
+        constexpr size_t k_merge_cutoff = 16'384;
+
+        // like the parallel loops, the root runs inside the executor and not in the thread that awaits the sort
+        co_await resume_on(*executor);
+
+        const auto count = static_cast<size_t>(end - begin);
+        const auto sort_cutoff = default_sort_cutoff(count, static_cast<size_t>(executor->max_concurrency_level()));
+
+        if (count <= sort_cutoff) {
+            std::sort(begin, end, compare);
+            co_return;
+        }
+
+        // the elements are moved into a scratch buffer and sorted back into [begin, end)
+        std::vector<value_type> scratch(std::make_move_iterator(begin), std::make_move_iterator(end));
+        const parallel_sort_context<compare_type> context {*executor, compare, sort_cutoff, k_merge_cutoff};
+
+        co_await parallel_merge_sort(context, scratch.begin(), begin, count, false);
+    }
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+     *  Sorts [begin, end) according to compare, in parallel, inside executor. Like std::sort, the sort is not stable.
+     *  Small ranges are sorted serially by one worker of executor. Larger ones are merge-sorted in parallel,
+     *  using a scratch buffer of end - begin elements.
+     *  compare might be called concurrently from several threads.
+     *  If compare throws, the exception is rethrown by the returned lazy_result and the contents of [begin, end) are unspecified.
+     */
+    template<std::random_access_iterator iterator_type, class compare_type = std::less<>>
+    lazy_result<void> parallel_sort(std::shared_ptr<thread_pool_executor> executor,
+                                    iterator_type begin,
+                                    iterator_type end,
+                                    compare_type compare = {}) {
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(details::consts::k_parallel_sort_null_executor_err_msg);
+        }
+
+        return details::parallel_sort_impl(std::move(executor), begin, end, std::move(compare));
+    }
+}  // namespace concurrencpp
+
+#endif
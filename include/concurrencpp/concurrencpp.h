@@ -16,8 +16,27 @@
 #include "concurrencpp/results/promises.h"
 #include "concurrencpp/results/resume_on.h"
 #include "concurrencpp/results/generator.h"
+#include "concurrencpp/results/async_generator.h"
 #include "concurrencpp/executors/executor_all.h"
 #include "concurrencpp/threads/async_lock.h"
+#include "concurrencpp/threads/async_shared_mutex.h"
+#include "concurrencpp/threads/async_semaphore.h"
+#include "concurrencpp/threads/async_latch.h"
+#include "concurrencpp/threads/async_barrier.h"
+#include "concurrencpp/threads/async_event.h"
 #include "concurrencpp/threads/async_condition_variable.h"
+#include "concurrencpp/threads/channel.h"
+#include "concurrencpp/algorithms/parallel_for.h"
+#include "concurrencpp/algorithms/parallel_reduce.h"
+#include "concurrencpp/algorithms/parallel_sort.h"
+#include "concurrencpp/algorithms/parallel_scan.h"
+
+#if defined(CRCPP_HAS_ASYNC_FILE)
+#    include "concurrencpp/io/async_file.h"
+#endif
+
+#if defined(CRCPP_HAS_MAPPED_FILE)
+#    include "concurrencpp/io/mapped_file.h"
+#endif
 
 #endif
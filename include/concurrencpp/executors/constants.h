@@ -3,6 +3,7 @@
 
 #include <limits>
 #include <numeric>
+#include <cstddef>
 
 namespace concurrencpp::details::consts {
     inline const char* k_inline_executor_name = "concurrencpp::inline_executor";
@@ -20,6 +21,23 @@ namespace concurrencpp::details::consts {
     inline const char* k_manual_executor_name = "concurrencpp::manual_executor";
     constexpr int k_manual_executor_max_concurrency_level = std::numeric_limits<int>::max();
 
+    constexpr int k_io_uring_executor_max_concurrency_level = 1;
+    inline const char* k_io_uring_executor_name = "concurrencpp::io_uring_executor";
+
+    inline const char* k_io_uring_executor_null_resume_executor_err_msg =
+        "concurrencpp::io_uring_executor - given resume executor is null.";
+
+    constexpr int k_epoll_executor_max_concurrency_level = 1;
+    inline const char* k_epoll_executor_name = "concurrencpp::epoll_executor";
+
+    constexpr int k_strand_executor_max_concurrency_level = 1;
+    constexpr size_t k_strand_executor_max_batch_size = 64;
+    inline const char* k_strand_executor_name = "concurrencpp::strand_executor";
+
+    inline const char* k_strand_executor_null_executor_err_msg = "concurrencpp::strand_executor - given underlying executor is null.";
+
+    inline const char* k_sharded_executor_zero_shards_err_msg = "concurrencpp::sharded_executor - shard count must be positive.";
+
     inline const char* k_timer_queue_name = "concurrencpp::timer_queue";
 
     inline const char* k_executor_shutdown_err_msg = " - shutdown has been called on this executor.";
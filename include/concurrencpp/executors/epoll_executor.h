@@ -0,0 +1,133 @@
+#ifndef CONCURRENCPP_EPOLL_EXECUTOR_H
+#define CONCURRENCPP_EPOLL_EXECUTOR_H
+
+#include "concurrencpp/threads/thread.h"
+#include "concurrencpp/threads/cache_line.h"
+#include "concurrencpp/coroutines/coroutine.h"
+#include "concurrencpp/executors/derivable_executor.h"
+#include "concurrencpp/executors/impl/reactor_task_loop.h"
+
+#include <map>
+#include <span>
+#include <chrono>
+#include <optional>
+#include <unordered_map>
+
+namespace concurrencpp {
+    class epoll_executor;
+}  // namespace concurrencpp
+
+namespace concurrencpp::details {
+    class epoll_awaitable;
+    class epoll_register_functor;
+
+    struct epoll_registration {
+        const int fd;
+        epoll_awaitable* readers = nullptr;
+        epoll_awaitable* writers = nullptr;
+        bool readable = false;  // an edge that arrived while nobody was waiting for it
+        bool writable = false;
+
+        explicit epoll_registration(int fd) noexcept : fd(fd) {}
+    };
+
+    class CRCPP_API epoll_awaitable {
+
+        friend class concurrencpp::epoll_executor;
+        friend class epoll_register_functor;
+
+       public:
+        using clock_type = std::chrono::steady_clock;
+
+       private:
+        enum class status { idle, ready, timed_out, interrupted, failed };
+
+        epoll_executor& m_executor;
+        const int m_fd;
+        const bool m_writable;
+        const std::optional<clock_type::time_point> m_deadline;
+        coroutine_handle<void> m_caller_handle;
+        epoll_registration* m_registration = nullptr;
+        epoll_awaitable* m_prev = nullptr;
+        epoll_awaitable* m_next = nullptr;
+        std::multimap<clock_type::time_point, epoll_awaitable*>::iterator m_deadline_it;
+        status m_status = status::idle;
+        int m_error = 0;
+
+        void resume(status status, int error = 0) noexcept;
+
+       public:
+        epoll_awaitable(epoll_executor& executor, int fd, bool writable, std::optional<clock_type::time_point> deadline) noexcept;
+
+        epoll_awaitable(const epoll_awaitable&) = delete;
+        epoll_awaitable(epoll_awaitable&&) = delete;
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        bool await_suspend(coroutine_handle<void> caller_handle);
+        bool await_resume() const;
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+     *  A single-threaded reactor: its thread runs the tasks posted to it, like worker_thread_executor,
+     *  and waits on an epoll instance in between. File descriptors are registered edge-triggered the first time
+     *  they are awaited and stay registered until unregister is called.
+     *  Awaiting coroutines are resumed on the executor thread.
+     */
+    class CRCPP_API alignas(CRCPP_CACHE_LINE_ALIGNMENT) epoll_executor final : public derivable_executor<epoll_executor> {
+
+        friend class details::epoll_awaitable;
+        friend class details::epoll_register_functor;
+
+       private:
+        std::unordered_map<int, details::epoll_registration> m_registrations;
+        std::multimap<details::epoll_awaitable::clock_type::time_point, details::epoll_awaitable*> m_deadlines;
+        details::reactor_task_loop m_tasks;
+        const int m_epoll_fd;
+        const int m_wake_fd;
+        details::thread m_thread;
+        std::atomic_bool m_atomic_abort;
+
+        void wake_loop() const noexcept;
+
+        int wait_timeout() const noexcept;
+        void wait_for_events(int timeout_ms);
+        void dispatch_events(details::epoll_registration& registration, uint32_t events);
+        void expire_deadlines();
+        void interrupt_waiters() noexcept;
+        void work_loop();
+
+        bool register_awaitable(details::epoll_awaitable& awaitable) noexcept;
+        void unlink_awaitable(details::epoll_awaitable& awaitable) noexcept;
+        void resume_all(details::epoll_awaitable* head) noexcept;
+        void unregister_impl(int fd) noexcept;
+
+       public:
+        epoll_executor(const std::function<void(std::string_view thread_name)>& thread_started_callback = {},
+                       const std::function<void(std::string_view thread_name)>& thread_terminated_callback = {});
+
+        ~epoll_executor() noexcept override;
+
+        void enqueue(concurrencpp::task task) override;
+        void enqueue(std::span<concurrencpp::task> tasks) override;
+
+        int max_concurrency_level() const noexcept override;
+
+        bool shutdown_requested() const override;
+        void shutdown() override;
+
+        details::epoll_awaitable readable(int fd);
+        details::epoll_awaitable readable(int fd, std::chrono::milliseconds timeout);
+
+        details::epoll_awaitable writable(int fd);
+        details::epoll_awaitable writable(int fd, std::chrono::milliseconds timeout);
+
+        void unregister(int fd);
+    };
+}  // namespace concurrencpp
+
+#endif
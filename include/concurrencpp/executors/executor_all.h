@@ -7,5 +7,15 @@
 #include "concurrencpp/executors/thread_executor.h"
 #include "concurrencpp/executors/worker_thread_executor.h"
 #include "concurrencpp/executors/manual_executor.h"
+#include "concurrencpp/executors/strand_executor.h"
+#include "concurrencpp/executors/sharded_executor.h"
+
+#if defined(CRCPP_HAS_EPOLL)
+#    include "concurrencpp/executors/epoll_executor.h"
+#endif
+
+#if defined(CRCPP_HAS_IO_URING)
+#    include "concurrencpp/executors/io_uring_executor.h"
+#endif
 
 #endif
@@ -0,0 +1,106 @@
+#ifndef CONCURRENCPP_REACTOR_TASK_LOOP_H
+#define CONCURRENCPP_REACTOR_TASK_LOOP_H
+
+#include "concurrencpp/task.h"
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/threads/cache_line.h"
+#include "concurrencpp/executors/executor.h"
+
+#include <span>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <string_view>
+
+namespace concurrencpp::details {
+    /*
+     *  The task queues and loop of a single-threaded executor whose thread also waits for I/O (epoll_executor, io_uring_executor).
+     *  Tasks enqueued by the loop thread go to the private queue without locking, other threads publish to the public queue,
+     *  which the loop thread moves into the private queue once per iteration.
+     *  The executor parameterizes the loop with its wait step, which runs after the private queue was drained,
+     *  and wakes that step up whenever enqueue or publish report that the public queue stopped being empty.
+     */
+    class CRCPP_API reactor_task_loop {
+
+       private:
+        std::deque<task> m_private_queue;
+        std::atomic_bool m_private_atomic_abort;
+        alignas(CRCPP_CACHE_LINE_ALIGNMENT) std::mutex m_lock;
+        std::deque<task> m_public_queue;
+        bool m_has_public_work;
+        bool m_abort;
+        const std::string_view m_executor_name;
+
+        void bind_to_this_thread() noexcept;
+        void run_tasks();
+
+        // take is invoked under the public lock on every call, including the last one, which observes the abort
+        template<class take_type>
+        bool take_public_work(take_type& take) {
+            std::unique_lock<std::mutex> lock(m_lock);
+            take();
+
+            if (m_abort) {
+                return false;
+            }
+
+            if (m_private_queue.empty()) {
+                std::swap(m_private_queue, m_public_queue);  // reuse underlying allocations.
+            } else {
+                m_private_queue.insert(m_private_queue.end(),
+                                       std::make_move_iterator(m_public_queue.begin()),
+                                       std::make_move_iterator(m_public_queue.end()));
+                m_public_queue.clear();
+            }
+
+            m_has_public_work = false;
+            return true;
+        }
+
+       public:
+        explicit reactor_task_loop(std::string_view executor_name) noexcept;
+
+        bool running_in_this_thread() const noexcept;
+        bool abort_requested() const noexcept;
+        bool has_private_tasks() const noexcept;
+
+        // returns true if the wait step has to be woken up
+        bool enqueue(std::span<task> tasks);
+
+        // runs publish under the public lock, for executor-specific work that is handed over with the tasks.
+        // returns true if the wait step has to be woken up
+        template<class publish_type>
+        bool publish(publish_type&& publish) {
+            std::unique_lock<std::mutex> lock(m_lock);
+            if (m_abort) {
+                throw_runtime_shutdown_exception(m_executor_name);
+            }
+
+            publish();
+            return !std::exchange(m_has_public_work, true);
+        }
+
+        template<class wait_step_type, class take_type>
+        void run(wait_step_type&& wait_step, take_type&& take) {
+            bind_to_this_thread();
+
+            while (take_public_work(take)) {
+                run_tasks();
+                wait_step();
+            }
+        }
+
+        template<class wait_step_type>
+        void run(wait_step_type&& wait_step) {
+            run(std::forward<wait_step_type>(wait_step), [] {});
+        }
+
+        // the caller has to wake the wait step up afterwards
+        void abort();
+
+        // destroys the tasks that never ran, once the loop thread has exited
+        void clear();
+    };
+}  // namespace concurrencpp::details
+
+#endif
@@ -0,0 +1,177 @@
+#ifndef CONCURRENCPP_IO_URING_EXECUTOR_H
+#define CONCURRENCPP_IO_URING_EXECUTOR_H
+
+#include "concurrencpp/utils/slist.h"
+#include "concurrencpp/threads/thread.h"
+#include "concurrencpp/threads/cache_line.h"
+#include "concurrencpp/coroutines/coroutine.h"
+#include "concurrencpp/executors/derivable_executor.h"
+#include "concurrencpp/executors/impl/reactor_task_loop.h"
+
+#include <span>
+#include <chrono>
+
+#include <sys/uio.h>
+#include <sys/types.h>
+#include <linux/io_uring.h>
+
+namespace concurrencpp {
+    class io_uring_executor;
+}  // namespace concurrencpp
+
+namespace concurrencpp::details {
+    class io_uring_ring;
+
+    class CRCPP_API io_uring_operation {
+
+        friend class concurrencpp::io_uring_executor;
+
+       private:
+        io_uring_operation* m_prev = nullptr;
+
+       protected:
+        io_uring_executor& m_executor;
+        const std::shared_ptr<executor> m_resume_executor;
+        const char* const m_operation_name;
+        io_uring_sqe m_sqe {};
+        __kernel_timespec m_timeout {};
+        coroutine_handle<void> m_caller_handle;
+        int m_result = 0;
+        bool m_interrupted = false;
+
+        void submit(coroutine_handle<void> caller_handle);
+        void complete(int result) noexcept;
+        void interrupt() noexcept;
+
+        void throw_if_interrupted() const;
+        void throw_if_failed() const;
+
+       public:
+        io_uring_operation* next = nullptr;
+
+        io_uring_operation(io_uring_executor& executor,
+                           std::shared_ptr<concurrencpp::executor> resume_executor,
+                           const char* operation_name,
+                           uint8_t opcode,
+                           int fd) noexcept;
+
+        io_uring_operation(io_uring_operation&& rhs) noexcept;
+    };
+
+    template<class type>
+    class io_uring_awaitable : public io_uring_operation {
+
+       public:
+        using io_uring_operation::io_uring_operation;
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        void await_suspend(coroutine_handle<void> caller_handle) {
+            submit(caller_handle);
+        }
+
+        type await_resume() const {
+            throw_if_interrupted();
+            throw_if_failed();
+
+            if constexpr (!std::is_void_v<type>) {
+                return static_cast<type>(m_result);
+            }
+        }
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+     *  A single-threaded executor whose thread runs the tasks posted to it and drives an io_uring instance.
+     *  The operations below are awaitables: awaiting one queues a submission, which the executor thread adds
+     *  to the submission ring on its next loop iteration, together with all the other submissions queued meanwhile,
+     *  and submits with a single system call. When the completion arrives, the awaiting coroutine is resumed
+     *  inside its resume executor, or inline if the resume executor is this executor.
+     */
+    class CRCPP_API alignas(CRCPP_CACHE_LINE_ALIGNMENT) io_uring_executor final : public derivable_executor<io_uring_executor> {
+
+        friend class details::io_uring_operation;
+
+       private:
+        std::unique_ptr<details::io_uring_ring> m_ring;
+        details::slist<details::io_uring_operation> m_private_operations;
+        details::io_uring_operation* m_in_flight_operations;
+        size_t m_in_flight_count;
+        bool m_wake_armed;
+        uint64_t m_wake_buffer;
+        details::reactor_task_loop m_tasks;
+        details::slist<details::io_uring_operation> m_public_operations;  // guarded by the public lock of m_tasks
+        const int m_wake_fd;
+        details::thread m_thread;
+        std::atomic_bool m_atomic_abort;
+
+        void wake_loop() const noexcept;
+        void enqueue_operation(details::io_uring_operation& operation);
+
+        void take_public_operations() noexcept;
+        void prepare_submissions();
+        void reap_completions();
+        void cancel_in_flight_operations();
+        void work_loop();
+
+        void add_in_flight(details::io_uring_operation& operation) noexcept;
+        void remove_in_flight(details::io_uring_operation& operation) noexcept;
+
+       public:
+        io_uring_executor(size_t ring_entries = 256,
+                          const std::function<void(std::string_view thread_name)>& thread_started_callback = {},
+                          const std::function<void(std::string_view thread_name)>& thread_terminated_callback = {});
+
+        ~io_uring_executor() noexcept override;
+
+        void enqueue(concurrencpp::task task) override;
+        void enqueue(std::span<concurrencpp::task> tasks) override;
+
+        int max_concurrency_level() const noexcept override;
+
+        bool shutdown_requested() const override;
+        void shutdown() override;
+
+        details::io_uring_awaitable<size_t> read(std::shared_ptr<executor> resume_executor,
+                                                 int fd,
+                                                 std::span<std::byte> buffer,
+                                                 uint64_t offset);
+
+        details::io_uring_awaitable<size_t> write(std::shared_ptr<executor> resume_executor,
+                                                  int fd,
+                                                  std::span<const std::byte> buffer,
+                                                  uint64_t offset);
+
+        details::io_uring_awaitable<size_t> readv(std::shared_ptr<executor> resume_executor,
+                                                  int fd,
+                                                  std::span<const iovec> buffers,
+                                                  uint64_t offset);
+
+        details::io_uring_awaitable<void> fsync(std::shared_ptr<executor> resume_executor, int fd);
+
+        details::io_uring_awaitable<int> openat(std::shared_ptr<executor> resume_executor,
+                                                int dir_fd,
+                                                const char* path,
+                                                int flags,
+                                                mode_t mode = 0);
+
+        details::io_uring_awaitable<int> accept(std::shared_ptr<executor> resume_executor, int fd, int flags = 0);
+
+        details::io_uring_awaitable<size_t> recv(std::shared_ptr<executor> resume_executor,
+                                                 int fd,
+                                                 std::span<std::byte> buffer,
+                                                 int flags = 0);
+
+        details::io_uring_awaitable<size_t> send(std::shared_ptr<executor> resume_executor,
+                                                 int fd,
+                                                 std::span<const std::byte> buffer,
+                                                 int flags = 0);
+
+        details::io_uring_awaitable<void> timeout(std::shared_ptr<executor> resume_executor, std::chrono::nanoseconds duration);
+    };
+}  // namespace concurrencpp
+
+#endif
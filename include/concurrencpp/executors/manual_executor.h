@@ -19,6 +19,20 @@ namespace concurrencpp {
         bool m_abort;
         std::atomic_bool m_atomic_abort;
 
+#if defined(CRCPP_HAS_EVENTFD)
+        int m_event_fd = -1;
+        bool m_event_fd_signaled = false;
+#endif
+
+        // called with m_lock held: the eventfd is readable while m_tasks is not empty, and after shutdown
+        void signal_event_fd() noexcept;
+        void reset_event_fd() noexcept;
+
+        void take_batch(std::deque<task>& batch, size_t max_count);
+        void return_batch(std::deque<task>& batch);
+        template<class clock_type>
+        size_t run_batch(std::deque<task>& batch, std::chrono::time_point<clock_type> deadline);
+
         template<class clock_type, class duration_type>
         static std::chrono::system_clock::time_point to_system_time_point(
             std::chrono::time_point<clock_type, duration_type> time_point) noexcept(noexcept(clock_type::now())) {
@@ -39,6 +53,7 @@ namespace concurrencpp {
 
        public:
         manual_executor();
+        ~manual_executor() noexcept;
 
         void enqueue(task task) override;
         void enqueue(std::span<task> tasks) override;
@@ -53,6 +68,10 @@ namespace concurrencpp {
 
         size_t clear();
 
+#if defined(CRCPP_HAS_EVENTFD)
+        int event_fd();
+#endif
+
         bool loop_once();
         bool loop_once_for(std::chrono::milliseconds max_waiting_time);
 
@@ -69,6 +88,8 @@ namespace concurrencpp {
             return loop_until_impl(max_count, to_system_time_point(timeout_time));
         }
 
+        size_t loop_for_duration(std::chrono::nanoseconds max_duration);
+
         void wait_for_task();
         bool wait_for_task_for(std::chrono::milliseconds max_waiting_time);
 
@@ -0,0 +1,164 @@
+#ifndef CONCURRENCPP_SHARDED_EXECUTOR_H
+#define CONCURRENCPP_SHARDED_EXECUTOR_H
+
+#include "concurrencpp/utils/bind.h"
+#include "concurrencpp/results/resume_on.h"
+#include "concurrencpp/threads/cache_line.h"
+#include "concurrencpp/executors/worker_thread_executor.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+namespace concurrencpp::details {
+    CRCPP_API uint64_t shard_hash_bytes(std::string_view bytes) noexcept;
+    CRCPP_API size_t shard_index_of(uint64_t hash, size_t shard_count) noexcept;
+
+    inline uint64_t shard_hash_mix(uint64_t value) noexcept {
+        // splitmix64 finalizer: spreads sequential ids, like consecutive user ids, over the whole range
+        value ^= value >> 30;
+        value *= 0xbf58476d1ce4e5b9ULL;
+        value ^= value >> 27;
+        value *= 0x94d049bb133111ebULL;
+        value ^= value >> 31;
+        return value;
+    }
+
+    /*
+     *  Integral keys and string keys hash the same on every platform and in every run.
+     *  Other keys fall back to std::hash, which is only stable within the same build.
+     */
+    template<class key_type>
+    uint64_t shard_hash(const key_type& key) noexcept {
+        if constexpr (std::is_integral_v<key_type>) {
+            return shard_hash_mix(static_cast<uint64_t>(key));
+        } else if constexpr (std::is_enum_v<key_type>) {
+            return shard_hash_mix(static_cast<uint64_t>(static_cast<std::underlying_type_t<key_type>>(key)));
+        } else if constexpr (std::is_convertible_v<const key_type&, std::string_view>) {
+            return shard_hash_bytes(std::string_view(key));
+        } else {
+            return shard_hash_mix(static_cast<uint64_t>(std::hash<key_type> {}(key)));
+        }
+    }
+
+    template<class callable_type>
+    class counted_shard_task {
+
+       private:
+        std::atomic_size_t* m_queue_depth;
+        callable_type m_callable;
+
+        void release() noexcept {
+            if (m_queue_depth != nullptr) {
+                std::exchange(m_queue_depth, nullptr)->fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+       public:
+        template<class given_callable_type>
+        counted_shard_task(std::atomic_size_t& queue_depth, given_callable_type&& callable) :
+            m_queue_depth(&queue_depth), m_callable(std::forward<given_callable_type>(callable)) {
+            queue_depth.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        counted_shard_task(counted_shard_task&& rhs) noexcept(std::is_nothrow_move_constructible_v<callable_type>) :
+            m_queue_depth(std::exchange(rhs.m_queue_depth, nullptr)), m_callable(std::move(rhs.m_callable)) {}
+
+        ~counted_shard_task() noexcept {
+            release();  // the task was destroyed without running, e.g. because its shard was shut down
+        }
+
+        decltype(auto) operator()() noexcept(std::is_nothrow_invocable_v<callable_type&>) {
+            release();
+            return m_callable();
+        }
+    };
+
+    struct CRCPP_API alignas(CRCPP_CACHE_LINE_ALIGNMENT) executor_shard {
+        std::shared_ptr<worker_thread_executor> executor;
+        std::atomic_size_t queue_depth {0};
+
+        template<class callable_type>
+        auto make_task(callable_type&& callable) {
+            return counted_shard_task<std::decay_t<callable_type>>(queue_depth, std::forward<callable_type>(callable));
+        }
+
+        template<class callable_type, class... argument_types>
+        void post(callable_type&& callable, argument_types&&... arguments) {
+            executor->post(make_task(bind(std::forward<callable_type>(callable), std::forward<argument_types>(arguments)...)));
+        }
+
+        template<class callable_type, class... argument_types>
+        auto submit(callable_type&& callable, argument_types&&... arguments) {
+            return executor->submit(
+                make_task(bind(std::forward<callable_type>(callable), std::forward<argument_types>(arguments)...)));
+        }
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+     *  Owns shard_count worker_thread_executors and routes every key to one of them.
+     *  All the work of the same key runs on the same thread, in the order it was posted, so per-key state needs no locking.
+     *  A key is mapped to a shard with a stable hash and jump consistent hashing, so changing the shard count between runs
+     *  only moves about 1/shard_count of the keys.
+     */
+    class CRCPP_API sharded_executor {
+
+       private:
+        const size_t m_shard_count;
+        const std::unique_ptr<details::executor_shard[]> m_shards;
+
+        details::executor_shard& shard_of(uint64_t hash) const noexcept;
+
+       public:
+        explicit sharded_executor(size_t shard_count,
+                                  const std::function<void(std::string_view thread_name)>& thread_started_callback = {},
+                                  const std::function<void(std::string_view thread_name)>& thread_terminated_callback = {});
+
+        ~sharded_executor() noexcept;
+
+        sharded_executor(const sharded_executor&) = delete;
+        sharded_executor& operator=(const sharded_executor&) = delete;
+
+        size_t shard_count() const noexcept;
+
+        template<class key_type>
+        size_t shard_index(const key_type& key) const noexcept {
+            return details::shard_index_of(details::shard_hash(key), m_shard_count);
+        }
+
+        template<class key_type>
+        std::shared_ptr<worker_thread_executor> shard(const key_type& key) const noexcept {
+            return shard_of(details::shard_hash(key)).executor;
+        }
+
+        template<class key_type, class callable_type, class... argument_types>
+        void post(const key_type& key, callable_type&& callable, argument_types&&... arguments) {
+            shard_of(details::shard_hash(key)).post(std::forward<callable_type>(callable), std::forward<argument_types>(arguments)...);
+        }
+
+        template<class key_type, class callable_type, class... argument_types>
+        auto submit(const key_type& key, callable_type&& callable, argument_types&&... arguments) {
+            return shard_of(details::shard_hash(key))
+                .submit(std::forward<callable_type>(callable), std::forward<argument_types>(arguments)...);
+        }
+
+        template<class key_type>
+        auto resume_on(const key_type& key) noexcept {
+            return details::resume_on_awaitable<details::executor_shard>(shard_of(details::shard_hash(key)));
+        }
+
+        // tasks that were posted to each shard and haven't started running yet, indexed like shard_index
+        std::vector<size_t> queue_depths() const;
+
+        bool shutdown_requested() const;
+        void shutdown();
+    };
+}  // namespace concurrencpp
+
+#endif
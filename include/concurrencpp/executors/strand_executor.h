@@ -0,0 +1,42 @@
+#ifndef CONCURRENCPP_STRAND_EXECUTOR_H
+#define CONCURRENCPP_STRAND_EXECUTOR_H
+
+#include "concurrencpp/threads/cache_line.h"
+#include "concurrencpp/executors/derivable_executor.h"
+
+#include <span>
+#include <memory>
+
+namespace concurrencpp::details {
+    struct strand_state;
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+     *  Runs its tasks one at a time, in FIFO order, on top of another executor.
+     *  Tasks are pushed to a lock-free queue. The first task that finds the strand idle posts a single drain task to the
+     *  underlying executor, which then runs up to k_strand_executor_max_batch_size queued tasks before yielding the thread
+     *  and re-posting itself. Tasks of the same strand never run concurrently, although they might run on different threads.
+     */
+    class CRCPP_API alignas(CRCPP_CACHE_LINE_ALIGNMENT) strand_executor final : public derivable_executor<strand_executor> {
+
+       private:
+        const std::shared_ptr<details::strand_state> m_state;
+
+       public:
+        explicit strand_executor(std::shared_ptr<executor> underlying_executor);
+
+        void enqueue(concurrencpp::task task) override;
+        void enqueue(std::span<concurrencpp::task> tasks) override;
+
+        int max_concurrency_level() const noexcept override;
+
+        bool shutdown_requested() const override;
+        void shutdown() override;
+
+        std::shared_ptr<executor> underlying_executor() const noexcept;
+        bool running_in_this_thread() const noexcept;
+    };
+}  // namespace concurrencpp
+
+#endif
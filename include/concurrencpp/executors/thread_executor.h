@@ -7,7 +7,9 @@
 
 #include <list>
 #include <span>
+#include <deque>
 #include <mutex>
+#include <chrono>
 #include <condition_variable>
 
 namespace concurrencpp {
@@ -23,12 +25,24 @@ namespace concurrencpp {
         const std::function<void(std::string_view thread_name)> m_thread_started_callback;
         const std::function<void(std::string_view thread_name)> m_thread_terminated_callback;
 
+        // threads that finished their task park for up to m_max_idle_time, and pick up tasks before new threads are spawned.
+        // a task is handed over only if a parked thread is available for it, so every task still gets a thread of its own.
+        const std::chrono::milliseconds m_max_idle_time;
+        std::condition_variable m_idle_condition;
+        std::deque<task> m_handed_over_tasks;
+        size_t m_idle_workers;
+
         void enqueue_impl(std::unique_lock<std::mutex>& lock, task& task);
+        bool wait_for_next_task(task& task);
         void retire_worker(std::list<details::thread>::iterator it);
 
        public:
         thread_executor(const std::function<void(std::string_view thread_name)>& thread_started_callback = {},
                         const std::function<void(std::string_view thread_name)>& thread_terminated_callback = {});
+
+        explicit thread_executor(std::chrono::milliseconds max_idle_time,
+                                 const std::function<void(std::string_view thread_name)>& thread_started_callback = {},
+                                 const std::function<void(std::string_view thread_name)>& thread_terminated_callback = {});
         ~thread_executor() noexcept;
 
         void enqueue(task task) override;
@@ -30,6 +30,8 @@ namespace concurrencpp::details {
         void set_idle(size_t idle_thread) noexcept;
         void set_active(size_t idle_thread) noexcept;
 
+        bool has_idle_workers() const noexcept;
+
         size_t find_idle_worker(size_t caller_index) noexcept;
         void find_idle_workers(size_t caller_index, std::vector<size_t>& result_buffer, size_t max_count) noexcept;
     };
@@ -74,6 +76,11 @@ namespace concurrencpp {
         void shutdown() override;
 
         std::chrono::milliseconds max_worker_idle_time() const noexcept;
+
+        bool has_idle_workers() const noexcept;
+        bool enqueue_to_idle_worker(task& task);
+
+        size_t current_worker_index() const noexcept;
     };
 }  // namespace concurrencpp
 
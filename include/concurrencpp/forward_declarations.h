@@ -27,12 +27,30 @@ namespace concurrencpp {
     class thread_executor;
     class worker_thread_executor;
     class manual_executor;
+    class strand_executor;
+    class sharded_executor;
 
     template<typename type>
     class generator;
 
+    template<typename type>
+    class async_generator;
+
     class async_lock;
+    class scoped_async_lock;
+    class async_shared_mutex;
+    class scoped_async_shared_lock;
+    class scoped_async_unique_lock;
+    class async_semaphore;
+    class async_semaphore_permit;
+    class async_latch;
+    class async_barrier;
+    class async_manual_reset_event;
+    class async_auto_reset_event;
     class async_condition_variable;
+
+    template<class type>
+    class channel;
 }  // namespace concurrencpp
 
 #endif  // FORWARD_DECLARATIONS_H
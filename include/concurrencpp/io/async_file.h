@@ -0,0 +1,140 @@
+#ifndef CONCURRENCPP_ASYNC_FILE_H
+#define CONCURRENCPP_ASYNC_FILE_H
+
+#include "concurrencpp/io/constants.h"
+#include "concurrencpp/forward_declarations.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/results/result.h"
+#include "concurrencpp/results/promises.h"
+#include "concurrencpp/results/async_generator.h"
+
+#include <span>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+#include <sys/types.h>
+
+namespace concurrencpp::details {
+    /*
+     *  Keeps freed buffers of the same alignment around, so streaming a file doesn't allocate a buffer per chunk.
+     */
+    class CRCPP_API aligned_buffer_pool {
+
+       private:
+        const size_t m_alignment;
+        std::mutex m_lock;
+        std::vector<std::pair<std::byte*, size_t>> m_free_buffers;
+
+       public:
+        explicit aligned_buffer_pool(size_t alignment) noexcept;
+        ~aligned_buffer_pool() noexcept;
+
+        std::byte* allocate(size_t size);
+        void deallocate(std::byte* buffer, size_t size) noexcept;
+    };
+
+    struct async_file_state;
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    struct async_file_options {
+        bool direct_io = false;  // opens the file with O_DIRECT, bypassing the page cache
+        size_t alignment = details::consts::k_async_file_default_alignment;
+        size_t read_ahead = details::consts::k_async_file_default_read_ahead;  // chunks read_chunks keeps in flight
+    };
+
+    class CRCPP_API async_file_buffer {
+
+       private:
+        std::shared_ptr<details::aligned_buffer_pool> m_pool;
+        std::byte* m_data = nullptr;
+        size_t m_size = 0;
+
+       public:
+        async_file_buffer() noexcept = default;
+        async_file_buffer(std::shared_ptr<details::aligned_buffer_pool> pool, std::byte* data, size_t size) noexcept;
+        async_file_buffer(async_file_buffer&& rhs) noexcept;
+        ~async_file_buffer() noexcept;
+
+        async_file_buffer& operator=(async_file_buffer&& rhs) noexcept;
+
+        explicit operator bool() const noexcept {
+            return m_data != nullptr;
+        }
+
+        std::byte* data() const noexcept {
+            return m_data;
+        }
+
+        size_t size() const noexcept {
+            return m_size;
+        }
+
+        std::span<std::byte> span() const noexcept {
+            return {m_data, m_size};
+        }
+    };
+
+    /*
+     *  A file that is read and written at explicit offsets, without blocking the calling thread.
+     *  By default the blocking pread/pwrite calls run inside the executor the file was opened with (usually the
+     *  background executor). If that executor is an io_uring_executor, the reads and writes are submitted to its ring instead.
+     *  Operations that are still running keep the file descriptor open, even if the async_file object is destroyed.
+     */
+    class CRCPP_API async_file {
+
+       private:
+        std::shared_ptr<details::async_file_state> m_state;
+
+        explicit async_file(std::shared_ptr<details::async_file_state> state) noexcept;
+
+        void throw_if_empty(const char* error_msg) const;
+
+        static result<async_file> open_impl(std::shared_ptr<executor> executor,
+                                            std::string path,
+                                            int flags,
+                                            async_file_options options,
+                                            mode_t mode);
+
+        static async_generator<std::span<const std::byte>> read_chunks_impl(std::shared_ptr<details::async_file_state> state,
+                                                                            size_t chunk_size,
+                                                                            uint64_t offset);
+
+       public:
+        async_file() noexcept = default;
+        async_file(async_file&& rhs) noexcept = default;
+        async_file& operator=(async_file&& rhs) noexcept = default;
+
+        static result<async_file> open(std::shared_ptr<executor> executor,
+                                       std::string path,
+                                       int flags,
+                                       async_file_options options = {},
+                                       mode_t mode = 0644);
+
+        static result<async_file> open(runtime& runtime,
+                                       std::string path,
+                                       int flags,
+                                       async_file_options options = {},
+                                       mode_t mode = 0644);
+
+        explicit operator bool() const noexcept {
+            return static_cast<bool>(m_state);
+        }
+
+        int native_handle() const noexcept;
+
+        result<size_t> read_at(uint64_t offset, std::span<std::byte> buffer) const;
+        result<size_t> write_at(uint64_t offset, std::span<const std::byte> buffer) const;
+
+        async_generator<std::span<const std::byte>> read_chunks(size_t chunk_size, uint64_t offset = 0) const;
+
+        async_file_buffer allocate_buffer(size_t size) const;
+
+        void close() noexcept;
+    };
+}  // namespace concurrencpp
+
+#endif
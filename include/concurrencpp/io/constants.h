@@ -0,0 +1,35 @@
+#ifndef CONCURRENCPP_IO_CONSTS_H
+#define CONCURRENCPP_IO_CONSTS_H
+
+#include <cstddef>
+
+namespace concurrencpp::details::consts {
+    constexpr size_t k_async_file_default_alignment = 4'096;
+    constexpr size_t k_async_file_default_read_ahead = 4;
+    constexpr size_t k_async_file_max_pooled_buffers = 16;
+
+    constexpr size_t k_parallel_for_each_line_min_chunk_size = 64 * 1'024;
+    constexpr size_t k_parallel_for_each_line_max_chunk_size = 4 * 1'024 * 1'024;
+
+    inline const char* k_async_file_open_null_executor_err_msg = "concurrencpp::async_file::open() - given executor is null.";
+
+    inline const char* k_async_file_read_at_empty_err_msg = "concurrencpp::async_file::read_at() - async_file is empty.";
+
+    inline const char* k_async_file_write_at_empty_err_msg = "concurrencpp::async_file::write_at() - async_file is empty.";
+
+    inline const char* k_async_file_read_chunks_empty_err_msg = "concurrencpp::async_file::read_chunks() - async_file is empty.";
+
+    inline const char* k_async_file_allocate_buffer_empty_err_msg = "concurrencpp::async_file::allocate_buffer() - async_file is empty.";
+
+    inline const char* k_async_file_read_chunks_invalid_chunk_size_err_msg =
+        "concurrencpp::async_file::read_chunks() - chunk_size must be positive, and a multiple of the alignment when direct_io is used.";
+
+    inline const char* k_async_file_invalid_alignment_err_msg =
+        "concurrencpp::async_file::open() - options.alignment must be a power of two.";
+
+    inline const char* k_parallel_for_each_line_null_executor_err_msg = "concurrencpp::parallel_for_each_line() - given executor is null.";
+
+    inline const char* k_parallel_for_each_line_empty_file_err_msg = "concurrencpp::parallel_for_each_line() - mapped_file is empty.";
+}  // namespace concurrencpp::details::consts
+
+#endif
@@ -0,0 +1,142 @@
+#ifndef CONCURRENCPP_MAPPED_FILE_H
+#define CONCURRENCPP_MAPPED_FILE_H
+
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/io/constants.h"
+#include "concurrencpp/algorithms/impl/parallel_loop.h"
+
+#include <span>
+#include <memory>
+#include <string>
+#include <cstddef>
+#include <algorithm>
+#include <stdexcept>
+#include <string_view>
+
+namespace concurrencpp {
+    enum class mapped_file_advice { normal, sequential, random, will_need, dont_need };
+
+    /*
+     *  A read-only, private memory mapping of a whole file.
+     *  The content of the file is accessed in place, through the page cache, without being copied into user buffers.
+     */
+    class CRCPP_API mapped_file {
+
+       private:
+        const char* m_data = nullptr;
+        size_t m_size = 0;
+        bool m_open = false;
+
+        void unmap() noexcept;
+
+       public:
+        mapped_file() noexcept = default;
+        explicit mapped_file(const std::string& path);
+        mapped_file(mapped_file&& rhs) noexcept;
+        ~mapped_file() noexcept;
+
+        mapped_file& operator=(mapped_file&& rhs) noexcept;
+
+        explicit operator bool() const noexcept {
+            return m_open;
+        }
+
+        const char* data() const noexcept {
+            return m_data;
+        }
+
+        size_t size() const noexcept {
+            return m_size;
+        }
+
+        std::string_view view() const noexcept {
+            return {m_data, m_size};
+        }
+
+        std::span<const std::byte> bytes() const noexcept {
+            return {reinterpret_cast<const std::byte*>(m_data), m_size};
+        }
+
+        // a hint only: ranges are rounded to whole pages and failures are ignored
+        void advise(mapped_file_advice advice, size_t offset = 0, size_t length = std::string_view::npos) const noexcept;
+    };
+}  // namespace concurrencpp
+
+namespace concurrencpp::details {
+    inline size_t default_line_chunk_size(size_t file_size, size_t concurrency_level) noexcept {
+        const auto chunks = std::max(concurrency_level, static_cast<size_t>(1)) * 8;
+        return std::clamp(file_size / chunks,
+                          consts::k_parallel_for_each_line_min_chunk_size,
+                          consts::k_parallel_for_each_line_max_chunk_size);
+    }
+
+    /*
+     *  Returns the records that start inside [chunk_index * chunk_size, (chunk_index + 1) * chunk_size).
+     *  The last record is extended up to (and including) its delimiter, so every record belongs to exactly one chunk
+     *  and chunks can be carved independently of each other.
+     */
+    CRCPP_API std::string_view line_chunk(std::string_view content, size_t chunk_index, size_t chunk_size, char delimiter) noexcept;
+
+    template<class function_type>
+    void for_each_line(std::string_view chunk, char delimiter, const function_type& function) {
+        while (!chunk.empty()) {
+            const auto pos = chunk.find(delimiter);
+            if (pos == std::string_view::npos) {
+                function(chunk);  // the last line of a file that doesn't end with a delimiter
+                return;
+            }
+
+            function(chunk.substr(0, pos));
+            chunk.remove_prefix(pos + 1);
+        }
+    }
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    /*
+     *  Invokes function(line) for every line of file, in parallel, inside executor.
+     *  Lines are std::string_views into the mapping and don't contain the delimiter.
+     *  The file is split into chunks of roughly chunk_size bytes (0 lets the library pick a size), which are cut at line boundaries.
+     *  The pages of the next chunk are requested from the kernel (MADV_WILLNEED) before a chunk is processed.
+     *  file must outlive the returned lazy_result.
+     *  function might be invoked concurrently from several threads, so it's taken as const.
+     *  If function throws, the remaining chunks are skipped and the first exception is rethrown by the lazy_result.
+     */
+    template<class function_type>
+    lazy_result<void> parallel_for_each_line(std::shared_ptr<thread_pool_executor> executor,
+                                             const mapped_file& file,
+                                             function_type function,
+                                             char delimiter = '\n',
+                                             size_t chunk_size = 0) {
+        if (!static_cast<bool>(executor)) {
+            throw std::invalid_argument(details::consts::k_parallel_for_each_line_null_executor_err_msg);
+        }
+
+        if (!static_cast<bool>(file)) {
+            throw errors::empty_object(details::consts::k_parallel_for_each_line_empty_file_err_msg);
+        }
+
+        if (chunk_size == 0) {
+            chunk_size = details::default_line_chunk_size(file.size(), static_cast<size_t>(executor->max_concurrency_level()));
+        }
+
+        const auto chunk_count = (file.size() + chunk_size - 1) / chunk_size;
+
+        file.advise(mapped_file_advice::sequential);
+        file.advise(mapped_file_advice::will_need, 0, chunk_size);
+
+        return details::run_parallel_loop(
+            std::move(executor),
+            chunk_count,
+            1,
+            [&file, chunk_size, delimiter, function = std::move(function)](size_t begin, size_t end) {
+                const auto content = file.view();
+                for (auto i = begin; i < end; i++) {
+                    file.advise(mapped_file_advice::will_need, (i + 1) * chunk_size, chunk_size);
+                    details::for_each_line(details::line_chunk(content, i, chunk_size, delimiter), delimiter, function);
+                }
+            });
+    }
+}  // namespace concurrencpp
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef CONCURRENCPP_ASYNC_GENERATOR_H
+#define CONCURRENCPP_ASYNC_GENERATOR_H
+
+#include "concurrencpp/errors.h"
+#include "concurrencpp/results/constants.h"
+#include "concurrencpp/results/impl/async_generator_state.h"
+
+namespace concurrencpp {
+    template<typename type>
+    class async_generator {
+
+       public:
+        using promise_type = details::async_generator_state<type>;
+        using iterator = details::async_generator_iterator<type>;
+
+        static_assert(!std::is_same_v<type, void>, "concurrencpp::async_generator<type> - <<type>> can not be void.");
+
+       private:
+        details::coroutine_handle<promise_type> m_coro_handle;
+
+        void throw_if_empty(const char* error_msg) const {
+            if (!static_cast<bool>(m_coro_handle)) {
+                throw errors::empty_generator(error_msg);
+            }
+        }
+
+       public:
+        async_generator(details::coroutine_handle<promise_type> handle) noexcept : m_coro_handle(handle) {}
+
+        async_generator(async_generator&& rhs) noexcept : m_coro_handle(std::exchange(rhs.m_coro_handle, {})) {}
+
+        ~async_generator() noexcept {
+            if (static_cast<bool>(m_coro_handle)) {
+                m_coro_handle.destroy();
+            }
+        }
+
+        async_generator(const async_generator& rhs) = delete;
+
+        async_generator& operator=(async_generator&& rhs) = delete;
+        async_generator& operator=(const async_generator& rhs) = delete;
+
+        explicit operator bool() const noexcept {
+            return static_cast<bool>(m_coro_handle);
+        }
+
+        details::async_generator_next_awaiter<type> next() {
+            throw_if_empty(details::consts::k_empty_async_generator_next_err_msg);
+            return {m_coro_handle};
+        }
+
+        details::async_generator_begin_awaiter<type> begin() {
+            throw_if_empty(details::consts::k_empty_async_generator_begin_err_msg);
+            return {m_coro_handle};
+        }
+
+        static details::generator_end_iterator end() noexcept {
+            return {};
+        }
+    };
+}  // namespace concurrencpp
+
+#endif
@@ -100,6 +100,13 @@ namespace concurrencpp::details::consts {
      */
     inline const char* k_empty_generator_begin_err_msg = "concurrencpp::generator::begin - generator is empty.";
 
+    /*
+     * async_generator
+     */
+    inline const char* k_empty_async_generator_next_err_msg = "concurrencpp::async_generator::next - generator is empty.";
+
+    inline const char* k_empty_async_generator_begin_err_msg = "concurrencpp::async_generator::begin - generator is empty.";
+
     /*
      * parallel-coroutine
      */
@@ -0,0 +1,212 @@
+#ifndef CONCURRENCPP_ASYNC_GENERATOR_STATE_H
+#define CONCURRENCPP_ASYNC_GENERATOR_STATE_H
+
+#include "concurrencpp/forward_declarations.h"
+#include "concurrencpp/coroutines/coroutine.h"
+#include "concurrencpp/results/impl/generator_state.h"
+
+#include <exception>
+
+namespace concurrencpp::details {
+    /*
+     *  The generator and its consumer hand control to each other with symmetric transfer:
+     *  the consumer resumes the generator when it awaits the next value, and the generator resumes the consumer
+     *  when it yields or finishes. The body may co_await in between, in which case the consumer is resumed
+     *  by whatever thread resumed the generator.
+     */
+    template<typename type>
+    class async_generator_state {
+
+       public:
+        using value_type = std::remove_reference_t<type>;
+
+       private:
+        value_type* m_value = nullptr;
+        std::exception_ptr m_exception;
+        coroutine_handle<void> m_consumer_handle;
+
+        struct yield_awaiter {
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            coroutine_handle<void> await_suspend(coroutine_handle<async_generator_state> handle) const noexcept {
+                return handle.promise().m_consumer_handle;
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+       public:
+        async_generator<type> get_return_object() noexcept {
+            return async_generator<type> {coroutine_handle<async_generator_state<type>>::from_promise(*this)};
+        }
+
+        suspend_always initial_suspend() const noexcept {
+            return {};
+        }
+
+        yield_awaiter final_suspend() const noexcept {
+            return {};
+        }
+
+        yield_awaiter yield_value(value_type& ref) noexcept {
+            m_value = std::addressof(ref);
+            return {};
+        }
+
+        yield_awaiter yield_value(value_type&& ref) noexcept {
+            m_value = std::addressof(ref);
+            return {};
+        }
+
+        void unhandled_exception() noexcept {
+            m_exception = std::current_exception();
+        }
+
+        void return_void() const noexcept {}
+
+        void set_consumer(coroutine_handle<void> consumer_handle) noexcept {
+            m_consumer_handle = consumer_handle;
+        }
+
+        value_type& value() const noexcept {
+            assert(m_value != nullptr);
+            assert(reinterpret_cast<std::intptr_t>(m_value) % alignof(value_type) == 0);
+            return *m_value;
+        }
+
+        void throw_if_exception() const {
+            if (static_cast<bool>(m_exception)) {
+                std::rethrow_exception(m_exception);
+            }
+        }
+    };
+
+    template<typename type>
+    class async_generator_awaiter_base {
+
+       protected:
+        coroutine_handle<async_generator_state<type>> m_coro_handle;
+
+       public:
+        async_generator_awaiter_base(coroutine_handle<async_generator_state<type>> handle) noexcept : m_coro_handle(handle) {
+            assert(static_cast<bool>(m_coro_handle));
+        }
+
+        bool await_ready() const noexcept {
+            return m_coro_handle.done();
+        }
+
+        coroutine_handle<void> await_suspend(coroutine_handle<void> caller_handle) noexcept {
+            m_coro_handle.promise().set_consumer(caller_handle);
+            return m_coro_handle;
+        }
+    };
+
+    template<typename type>
+    class async_generator_next_awaiter : public async_generator_awaiter_base<type> {
+
+       public:
+        using async_generator_awaiter_base<type>::async_generator_awaiter_base;
+
+        std::remove_reference_t<type>* await_resume() const {
+            if (this->m_coro_handle.done()) {
+                this->m_coro_handle.promise().throw_if_exception();
+                return nullptr;
+            }
+
+            return std::addressof(this->m_coro_handle.promise().value());
+        }
+    };
+
+    template<typename type>
+    class async_generator_iterator {
+
+       private:
+        coroutine_handle<async_generator_state<type>> m_coro_handle;
+
+        class increment_awaiter : public async_generator_awaiter_base<type> {
+
+           private:
+            async_generator_iterator& m_iterator;
+
+           public:
+            increment_awaiter(async_generator_iterator& iterator) noexcept :
+                async_generator_awaiter_base<type>(iterator.m_coro_handle), m_iterator(iterator) {}
+
+            async_generator_iterator& await_resume() const {
+                if (this->m_coro_handle.done()) {
+                    this->m_coro_handle.promise().throw_if_exception();
+                }
+
+                return m_iterator;
+            }
+        };
+
+       public:
+        using value_type = std::remove_reference_t<type>;
+        using reference = value_type&;
+        using pointer = value_type*;
+        using iterator_category = std::input_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+
+       public:
+        async_generator_iterator(coroutine_handle<async_generator_state<type>> handle) noexcept : m_coro_handle(handle) {
+            assert(static_cast<bool>(m_coro_handle));
+        }
+
+        increment_awaiter operator++() noexcept {
+            assert(static_cast<bool>(m_coro_handle));
+            assert(!m_coro_handle.done());
+            return {*this};
+        }
+
+        reference operator*() const noexcept {
+            assert(static_cast<bool>(m_coro_handle));
+            return m_coro_handle.promise().value();
+        }
+
+        pointer operator->() const noexcept {
+            assert(static_cast<bool>(m_coro_handle));
+            return std::addressof(operator*());
+        }
+
+        friend bool operator==(const async_generator_iterator& it0, const async_generator_iterator& it1) noexcept {
+            return it0.m_coro_handle == it1.m_coro_handle;
+        }
+
+        friend bool operator==(const async_generator_iterator& it, generator_end_iterator) noexcept {
+            return it.m_coro_handle.done();
+        }
+
+        friend bool operator==(generator_end_iterator end_it, const async_generator_iterator& it) noexcept {
+            return (it == end_it);
+        }
+
+        friend bool operator!=(const async_generator_iterator& it, generator_end_iterator end_it) noexcept {
+            return !(it == end_it);
+        }
+
+        friend bool operator!=(generator_end_iterator end_it, const async_generator_iterator& it) noexcept {
+            return it != end_it;
+        }
+    };
+
+    template<typename type>
+    class async_generator_begin_awaiter : public async_generator_awaiter_base<type> {
+
+       public:
+        using async_generator_awaiter_base<type>::async_generator_awaiter_base;
+
+        async_generator_iterator<type> await_resume() const {
+            if (this->m_coro_handle.done()) {
+                this->m_coro_handle.promise().throw_if_exception();
+            }
+
+            return {this->m_coro_handle};
+        }
+    };
+}  // namespace concurrencpp::details
+
+#endif
@@ -4,6 +4,8 @@
 #include "concurrencpp/forward_declarations.h"
 #include "concurrencpp/coroutines/coroutine.h"
 
+#include <span>
+
 namespace concurrencpp::details {
     template<typename type>
     class generator_state {
@@ -12,9 +14,25 @@ namespace concurrencpp::details {
         using value_type = std::remove_reference_t<type>;
 
        private:
+        /*
+         *  m_value points to the current value, m_block_end points one past the last value of the current block.
+         *  a single value is a block of one, so the iterator resumes the coroutine only when the current block is exhausted.
+         */
         value_type* m_value = nullptr;
+        value_type* m_block_end = nullptr;
         std::exception_ptr m_exception;
 
+        struct yield_awaiter {
+            const bool m_empty_block;
+
+            bool await_ready() const noexcept {
+                return m_empty_block;
+            }
+
+            void await_suspend(coroutine_handle<void>) const noexcept {}
+            void await_resume() const noexcept {}
+        };
+
        public:
         generator<type> get_return_object() noexcept {
             return generator<type> {coroutine_handle<generator_state<type>>::from_promise(*this)};
@@ -30,22 +48,42 @@ namespace concurrencpp::details {
 
         suspend_always yield_value(value_type& ref) noexcept {
             m_value = std::addressof(ref);
+            m_block_end = m_value + 1;
             return {};
         }
 
         suspend_always yield_value(value_type&& ref) noexcept {
             m_value = std::addressof(ref);
+            m_block_end = m_value + 1;
             return {};
         }
 
+        yield_awaiter yield_value(std::span<value_type> block) noexcept {
+            // an empty block has no value to point to, so the coroutine just keeps running
+            if (block.empty()) {
+                return {true};
+            }
+
+            m_value = block.data();
+            m_block_end = block.data() + block.size();
+            return {false};
+        }
+
         void unhandled_exception() noexcept {
             m_exception = std::current_exception();
         }
 
         void return_void() const noexcept {}
 
+        bool advance_in_block() noexcept {
+            assert(m_value != nullptr);
+            assert(m_value != m_block_end);
+            return ++m_value != m_block_end;
+        }
+
         value_type& value() const noexcept {
             assert(m_value != nullptr);
+            assert(m_value != m_block_end);
             assert(reinterpret_cast<std::intptr_t>(m_value) % alignof(value_type) == 0);
             return *m_value;
         }
@@ -80,6 +118,11 @@ namespace concurrencpp::details {
         generator_iterator& operator++() {
             assert(static_cast<bool>(m_coro_handle));
             assert(!m_coro_handle.done());
+
+            if (m_coro_handle.promise().advance_in_block()) {
+                return *this;
+            }
+
             m_coro_handle.resume();
 
             if (m_coro_handle.done()) {
@@ -0,0 +1,39 @@
+#ifndef CONCURRENCPP_RESUMPTION_BATCH_H
+#define CONCURRENCPP_RESUMPTION_BATCH_H
+
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/coroutines/coroutine.h"
+
+#include <array>
+
+namespace concurrencpp::details {
+    /*
+     *  Collects suspended coroutines that should be resumed inside their resume executors.
+     *  Consecutive coroutines that share a resume executor are enqueued to it with one call to executor::enqueue(std::span<task>).
+     *  Tasks are kept in fixed inline storage, which is flushed when it's full, so collecting them never allocates.
+     *  A coroutine that can't be enqueued is resumed inline with *interrupted = true, like with await_via_functor.
+     */
+    class CRCPP_API resumption_batch {
+
+       public:
+        static constexpr size_t k_capacity = 16;
+
+       private:
+        std::array<task, k_capacity> m_tasks;
+        size_t m_size = 0;
+        std::shared_ptr<executor> m_executor;
+
+       public:
+        resumption_batch() noexcept = default;
+        ~resumption_batch() noexcept;
+
+        resumption_batch(const resumption_batch&) = delete;
+        resumption_batch(resumption_batch&&) = delete;
+
+        void add(const std::shared_ptr<executor>& resume_executor, coroutine_handle<void> caller_handle, bool* interrupted) noexcept;
+        void flush() noexcept;
+    };
+}  // namespace concurrencpp::details
+
+#endif
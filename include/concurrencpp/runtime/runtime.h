@@ -34,6 +34,8 @@ namespace concurrencpp {
 
         std::chrono::milliseconds max_timer_queue_waiting_time;
 
+        std::chrono::milliseconds max_thread_executor_idle_time;
+
         std::function<void(std::string_view thread_name)> thread_started_callback;
         std::function<void(std::string_view thread_name)> thread_terminated_callback;
 
@@ -0,0 +1,67 @@
+#ifndef CONCURRENCPP_ASYNC_BARRIER_H
+#define CONCURRENCPP_ASYNC_BARRIER_H
+
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/results/result.h"
+#include "concurrencpp/forward_declarations.h"
+
+#include <atomic>
+#include <functional>
+
+namespace concurrencpp::details {
+    class CRCPP_API async_barrier_awaiter {
+
+        friend class concurrencpp::async_barrier;
+
+       private:
+        async_barrier& m_parent;
+        std::shared_ptr<executor> m_resume_executor;
+        coroutine_handle<void> m_caller_handle;
+        bool m_interrupted = false;
+
+       public:
+        async_barrier_awaiter* next = nullptr;
+
+       public:
+        async_barrier_awaiter(async_barrier& parent, std::shared_ptr<executor> resume_executor) noexcept;
+        async_barrier_awaiter(async_barrier_awaiter&& rhs) noexcept;
+
+        constexpr bool await_ready() const noexcept {
+            return false;
+        }
+
+        bool await_suspend(coroutine_handle<void> caller_handle) noexcept;
+        void await_resume() const;
+
+        result<void> run();
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    class CRCPP_API async_barrier {
+
+        friend class details::async_barrier_awaiter;
+
+       private:
+        std::atomic_size_t m_counter;
+        std::atomic_size_t m_expected;
+        std::atomic<details::async_barrier_awaiter*> m_waiters;  // LIFO stack of the current phase's waiters
+        const std::function<void()> m_completion;
+
+        bool arrive(details::async_barrier_awaiter* awaiter) noexcept;
+        void complete_phase(details::async_barrier_awaiter* last_arriver) noexcept;
+
+       public:
+        async_barrier(size_t expected, std::function<void()> completion = {});
+        ~async_barrier() noexcept;
+
+        async_barrier(const async_barrier&) = delete;
+        async_barrier(async_barrier&&) = delete;
+
+        details::async_barrier_awaiter arrive_and_wait(std::shared_ptr<executor> resume_executor);
+        void arrive_and_drop() noexcept;
+    };
+}  // namespace concurrencpp
+
+#endif
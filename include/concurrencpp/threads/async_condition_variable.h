@@ -9,23 +9,25 @@
 
 namespace concurrencpp::details {
     class CRCPP_API cv_awaiter {
+
+        friend class concurrencpp::async_condition_variable;
+
        private:
         async_condition_variable& m_parent;
         scoped_async_lock& m_lock;
-        coroutine_handle<void> m_caller_handle;
+        async_lock_awaiter m_lock_awaiter;  // notifiers hand the lock over to this node directly
 
        public:
         cv_awaiter* next = nullptr;
 
-        cv_awaiter(async_condition_variable& parent, scoped_async_lock& lock) noexcept;
+        cv_awaiter(async_condition_variable& parent, scoped_async_lock& lock, std::shared_ptr<executor> resume_executor) noexcept;
 
         constexpr bool await_ready() const noexcept {
             return false;
         }
 
         void await_suspend(details::coroutine_handle<void> caller_handle);
-        void await_resume() const noexcept {}
-        void resume() noexcept;
+        void await_resume();
     };
 }  // namespace concurrencpp::details
 
@@ -0,0 +1,127 @@
+#ifndef CONCURRENCPP_ASYNC_EVENT_H
+#define CONCURRENCPP_ASYNC_EVENT_H
+
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/results/result.h"
+#include "concurrencpp/forward_declarations.h"
+
+#include <mutex>
+#include <atomic>
+
+namespace concurrencpp::details {
+    class CRCPP_API async_manual_reset_event_awaiter {
+
+        friend class concurrencpp::async_manual_reset_event;
+
+       private:
+        async_manual_reset_event& m_parent;
+        std::shared_ptr<executor> m_resume_executor;
+        coroutine_handle<void> m_caller_handle;
+        bool m_interrupted = false;
+
+       public:
+        async_manual_reset_event_awaiter* next = nullptr;
+
+       public:
+        async_manual_reset_event_awaiter(async_manual_reset_event& parent, std::shared_ptr<executor> resume_executor) noexcept;
+        async_manual_reset_event_awaiter(async_manual_reset_event_awaiter&& rhs) noexcept;
+
+        bool await_ready() const noexcept;
+        bool await_suspend(coroutine_handle<void> caller_handle) noexcept;
+        void await_resume() const;
+
+        result<void> run();
+    };
+
+    class CRCPP_API async_auto_reset_event_awaiter {
+
+        friend class concurrencpp::async_auto_reset_event;
+
+       private:
+        async_auto_reset_event& m_parent;
+        std::shared_ptr<executor> m_resume_executor;
+        coroutine_handle<void> m_caller_handle;
+        bool m_interrupted = false;
+
+        void resume() noexcept;
+
+       public:
+        async_auto_reset_event_awaiter* next = nullptr;
+
+       public:
+        async_auto_reset_event_awaiter(async_auto_reset_event& parent, std::shared_ptr<executor> resume_executor) noexcept;
+        async_auto_reset_event_awaiter(async_auto_reset_event_awaiter&& rhs) noexcept;
+
+        bool await_ready() noexcept;
+        bool await_suspend(coroutine_handle<void> caller_handle) noexcept;
+        void await_resume();
+
+        result<void> run();
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    class CRCPP_API async_manual_reset_event {
+
+        friend class details::async_manual_reset_event_awaiter;
+
+       private:
+        /*
+         *  m_state is either k_set, or a LIFO stack of suspended waiters (nullptr if none).
+         */
+        std::atomic<details::async_manual_reset_event_awaiter*> m_state;
+
+        static details::async_manual_reset_event_awaiter* const k_set;
+
+        bool enqueue_awaiter(details::async_manual_reset_event_awaiter& awaiter) noexcept;
+
+       public:
+        async_manual_reset_event(bool initially_set = false) noexcept;
+        ~async_manual_reset_event() noexcept;
+
+        async_manual_reset_event(const async_manual_reset_event&) = delete;
+        async_manual_reset_event(async_manual_reset_event&&) = delete;
+
+        void set() noexcept;
+        void reset() noexcept;
+        bool is_set() const noexcept;
+
+        details::async_manual_reset_event_awaiter wait(std::shared_ptr<executor> resume_executor);
+    };
+
+    class CRCPP_API async_auto_reset_event {
+
+        friend class details::async_auto_reset_event_awaiter;
+
+       private:
+        /*
+         *  m_state is either k_set, or a LIFO stack of newly suspended waiters (nullptr if none).
+         *  waiters are pushed without locking. set() takes m_lock, moves the stack into the FIFO m_waiters
+         *  and resumes one waiter, so nodes are never popped concurrently.
+         */
+        std::atomic<details::async_auto_reset_event_awaiter*> m_state;
+        std::mutex m_lock;
+        details::async_auto_reset_event_awaiter* m_waiters;  // FIFO list of waiters, guarded by m_lock
+
+        static details::async_auto_reset_event_awaiter* const k_set;
+
+        bool try_consume() noexcept;
+        bool enqueue_awaiter(details::async_auto_reset_event_awaiter& awaiter) noexcept;
+
+       public:
+        async_auto_reset_event(bool initially_set = false) noexcept;
+        ~async_auto_reset_event() noexcept;
+
+        async_auto_reset_event(const async_auto_reset_event&) = delete;
+        async_auto_reset_event(async_auto_reset_event&&) = delete;
+
+        void set();
+        void reset() noexcept;
+        bool is_set() const noexcept;
+
+        details::async_auto_reset_event_awaiter wait(std::shared_ptr<executor> resume_executor);
+    };
+}  // namespace concurrencpp
+
+#endif
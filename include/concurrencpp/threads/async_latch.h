@@ -0,0 +1,70 @@
+#ifndef CONCURRENCPP_ASYNC_LATCH_H
+#define CONCURRENCPP_ASYNC_LATCH_H
+
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/results/result.h"
+#include "concurrencpp/forward_declarations.h"
+
+#include <atomic>
+
+namespace concurrencpp::details {
+    class CRCPP_API async_latch_awaiter {
+
+        friend class concurrencpp::async_latch;
+
+       private:
+        async_latch& m_parent;
+        std::shared_ptr<executor> m_resume_executor;
+        coroutine_handle<void> m_caller_handle;
+        bool m_interrupted = false;
+
+       public:
+        async_latch_awaiter* next = nullptr;
+
+       public:
+        async_latch_awaiter(async_latch& parent, std::shared_ptr<executor> resume_executor) noexcept;
+        async_latch_awaiter(async_latch_awaiter&& rhs) noexcept;
+
+        bool await_ready() const noexcept;
+        bool await_suspend(coroutine_handle<void> caller_handle) noexcept;
+        void await_resume() const;
+
+        result<void> run();
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    class CRCPP_API async_latch {
+
+        friend class details::async_latch_awaiter;
+
+       private:
+        std::atomic_size_t m_counter;
+
+        /*
+         *  m_waiters is either a LIFO stack of suspended waiters, or k_ready once the counter reached zero.
+         */
+        std::atomic<details::async_latch_awaiter*> m_waiters;
+
+        static details::async_latch_awaiter* const k_ready;
+
+        bool enqueue_awaiter(details::async_latch_awaiter& awaiter) noexcept;
+        void resume_waiters() noexcept;
+
+       public:
+        async_latch(size_t expected) noexcept;
+        ~async_latch() noexcept;
+
+        async_latch(const async_latch&) = delete;
+        async_latch(async_latch&&) = delete;
+
+        void count_down(size_t update = 1) noexcept;
+        bool try_wait() const noexcept;
+
+        details::async_latch_awaiter wait(std::shared_ptr<executor> resume_executor);
+        details::async_latch_awaiter arrive_and_wait(std::shared_ptr<executor> resume_executor, size_t update = 1);
+    };
+}  // namespace concurrencpp
+
+#endif
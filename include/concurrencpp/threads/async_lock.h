@@ -1,63 +1,85 @@
 #ifndef CONCURRENCPP_ASYNC_LOCK_H
 #define CONCURRENCPP_ASYNC_LOCK_H
 
-#include "concurrencpp/utils/slist.h"
 #include "concurrencpp/platform_defs.h"
 #include "concurrencpp/executors/executor.h"
 #include "concurrencpp/results/lazy_result.h"
 #include "concurrencpp/forward_declarations.h"
 
+#include <atomic>
+
 namespace concurrencpp::details {
-    class async_lock_awaiter {
+    class cv_awaiter;
+
+    class CRCPP_API async_lock_awaiter {
 
         friend class concurrencpp::async_lock;
+        friend class concurrencpp::async_condition_variable;
+        friend class details::cv_awaiter;
 
        private:
         async_lock& m_parent;
-        std::unique_lock<std::mutex> m_lock;
-        coroutine_handle<void> m_resume_handle;
+        std::shared_ptr<executor> m_resume_executor;
+        coroutine_handle<void> m_caller_handle;
+        const bool m_with_raii_guard;
+        bool m_interrupted = false;
+
+        void resume() noexcept;
 
        public:
         async_lock_awaiter* next = nullptr;
 
        public:
-        async_lock_awaiter(async_lock& parent, std::unique_lock<std::mutex>& lock) noexcept;
-
-        constexpr bool await_ready() const noexcept {
-            return false;
-        }
-
-        void await_suspend(coroutine_handle<void> handle);
+        async_lock_awaiter(async_lock& parent, std::shared_ptr<executor> resume_executor, bool with_raii_guard) noexcept;
+        async_lock_awaiter(async_lock_awaiter&& rhs) noexcept;
 
-        constexpr void await_resume() const noexcept {}
+        bool await_ready() noexcept;
+        bool await_suspend(coroutine_handle<void> caller_handle) noexcept;
+        scoped_async_lock await_resume();
 
-        void retry() noexcept;
+        result<scoped_async_lock> run();
     };
 }  // namespace concurrencpp::details
 
 namespace concurrencpp {
-    class scoped_async_lock;
-
     class CRCPP_API async_lock {
 
         friend class scoped_async_lock;
+        friend class async_condition_variable;
         friend class details::async_lock_awaiter;
 
        private:
-        std::mutex m_awaiter_lock;
-        details::slist<details::async_lock_awaiter> m_awaiters;
-        bool m_locked = false;
+        /*
+         *  m_state is one of:
+         *  k_not_locked - the lock is free
+         *  nullptr - the lock is owned, no coroutine waits for it
+         *  async_lock_awaiter* - the lock is owned, the pointer is the head of a LIFO stack of new waiters
+         */
+        std::atomic<details::async_lock_awaiter*> m_state;
+        details::async_lock_awaiter* m_waiters;  // FIFO list of waiters, owned by the current lock owner
+
+        static details::async_lock_awaiter* const k_not_locked;
 
 #ifdef CRCPP_DEBUG_MODE
         std::atomic_intptr_t m_thread_count_in_critical_section {0};
 #endif
 
-        lazy_result<scoped_async_lock> lock_impl(std::shared_ptr<executor> resume_executor, bool with_raii_guard);
+        bool try_acquire() noexcept;
+        bool enqueue_awaiter(details::async_lock_awaiter& awaiter) noexcept;
+        void enqueue_awaiters(details::async_lock_awaiter& first) noexcept;
+        void release() noexcept;
+
+        lazy_result<scoped_async_lock> lock_impl(std::shared_ptr<executor> resume_executor);
 
        public:
+        async_lock() noexcept;
         ~async_lock() noexcept;
 
+        async_lock(const async_lock&) = delete;
+        async_lock(async_lock&&) = delete;
+
         lazy_result<scoped_async_lock> lock(std::shared_ptr<executor> resume_executor);
+        details::async_lock_awaiter lock_awaitable(std::shared_ptr<executor> resume_executor);
         lazy_result<bool> try_lock();
         void unlock();
     };
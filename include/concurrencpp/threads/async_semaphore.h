@@ -0,0 +1,103 @@
+#ifndef CONCURRENCPP_ASYNC_SEMAPHORE_H
+#define CONCURRENCPP_ASYNC_SEMAPHORE_H
+
+#include "concurrencpp/utils/slist.h"
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/results/result.h"
+#include "concurrencpp/forward_declarations.h"
+
+#include <mutex>
+#include <atomic>
+
+namespace concurrencpp::details {
+    class CRCPP_API async_semaphore_awaiter {
+
+        friend class concurrencpp::async_semaphore;
+
+       private:
+        async_semaphore& m_parent;
+        std::shared_ptr<executor> m_resume_executor;
+        coroutine_handle<void> m_caller_handle;
+        const size_t m_count;
+        bool m_interrupted = false;
+
+        void resume() noexcept;
+
+       public:
+        async_semaphore_awaiter* next = nullptr;
+
+       public:
+        async_semaphore_awaiter(async_semaphore& parent, std::shared_ptr<executor> resume_executor, size_t count) noexcept;
+        async_semaphore_awaiter(async_semaphore_awaiter&& rhs) noexcept;
+
+        bool await_ready() noexcept;
+        bool await_suspend(coroutine_handle<void> caller_handle);
+        async_semaphore_permit await_resume();
+
+        result<async_semaphore_permit> run();
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    class CRCPP_API async_semaphore {
+
+        friend class details::async_semaphore_awaiter;
+
+       private:
+        /*
+         *  m_state layout: [available permits | waiters bit].
+         *  the waiters bit is set while coroutines wait in m_waiters, which makes acquirers queue behind them (FIFO)
+         *  and makes releasers hand the released permits to the waiters under m_lock.
+         */
+        static constexpr size_t k_waiters = 1;
+        static constexpr size_t k_permit = 2;
+
+        std::atomic_size_t m_state;
+        std::mutex m_lock;
+        details::slist<details::async_semaphore_awaiter> m_waiters;
+
+        bool enqueue_awaiter(details::async_semaphore_awaiter& awaiter);
+        void resume_waiters();
+
+       public:
+        async_semaphore(size_t initial_permits) noexcept;
+        ~async_semaphore() noexcept;
+
+        async_semaphore(const async_semaphore&) = delete;
+        async_semaphore(async_semaphore&&) = delete;
+
+        details::async_semaphore_awaiter acquire(std::shared_ptr<executor> resume_executor, size_t count = 1);
+        bool try_acquire(size_t count = 1) noexcept;
+        void release(size_t count = 1);
+
+        size_t available_permits() const noexcept;
+    };
+
+    class CRCPP_API async_semaphore_permit {
+
+       private:
+        async_semaphore* m_semaphore = nullptr;
+        size_t m_count = 0;
+
+       public:
+        async_semaphore_permit() noexcept = default;
+        async_semaphore_permit(async_semaphore_permit&& rhs) noexcept;
+        async_semaphore_permit(async_semaphore& semaphore, size_t count) noexcept;
+
+        ~async_semaphore_permit() noexcept;
+
+        async_semaphore_permit& operator=(async_semaphore_permit&& rhs) noexcept;
+
+        void release();
+
+        size_t count() const noexcept;
+        explicit operator bool() const noexcept;
+
+        void swap(async_semaphore_permit& rhs) noexcept;
+        async_semaphore* detach() noexcept;
+        async_semaphore* semaphore() const noexcept;
+    };
+}  // namespace concurrencpp
+
+#endif
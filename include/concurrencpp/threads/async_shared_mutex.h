@@ -0,0 +1,158 @@
+#ifndef CONCURRENCPP_ASYNC_SHARED_MUTEX_H
+#define CONCURRENCPP_ASYNC_SHARED_MUTEX_H
+
+#include "concurrencpp/utils/slist.h"
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/results/result.h"
+#include "concurrencpp/forward_declarations.h"
+
+#include <mutex>
+#include <atomic>
+
+namespace concurrencpp::details {
+    class CRCPP_API async_shared_mutex_awaiter {
+
+        friend class concurrencpp::async_shared_mutex;
+
+       protected:
+        async_shared_mutex& m_parent;
+        std::shared_ptr<executor> m_resume_executor;
+        coroutine_handle<void> m_caller_handle;
+        const bool m_shared;
+        bool m_interrupted = false;
+
+        void resume() noexcept;
+        void throw_if_interrupted();
+
+       public:
+        async_shared_mutex_awaiter* next = nullptr;
+
+       public:
+        async_shared_mutex_awaiter(async_shared_mutex& parent, std::shared_ptr<executor> resume_executor, bool shared) noexcept;
+        async_shared_mutex_awaiter(async_shared_mutex_awaiter&& rhs) noexcept;
+
+        bool await_ready() noexcept;
+        bool await_suspend(coroutine_handle<void> caller_handle);
+    };
+
+    class CRCPP_API async_shared_lock_awaiter : public async_shared_mutex_awaiter {
+
+       public:
+        async_shared_lock_awaiter(async_shared_mutex& parent, std::shared_ptr<executor> resume_executor) noexcept;
+        async_shared_lock_awaiter(async_shared_lock_awaiter&& rhs) noexcept = default;
+
+        scoped_async_shared_lock await_resume();
+        result<scoped_async_shared_lock> run();
+    };
+
+    class CRCPP_API async_unique_lock_awaiter : public async_shared_mutex_awaiter {
+
+       public:
+        async_unique_lock_awaiter(async_shared_mutex& parent, std::shared_ptr<executor> resume_executor) noexcept;
+        async_unique_lock_awaiter(async_unique_lock_awaiter&& rhs) noexcept = default;
+
+        scoped_async_unique_lock await_resume();
+        result<scoped_async_unique_lock> run();
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    class CRCPP_API async_shared_mutex {
+
+        friend class details::async_shared_mutex_awaiter;
+
+       private:
+        /*
+         *  m_state layout: [reader count | pending bit | writer bit].
+         *  the pending bit is set while coroutines wait in one of the waiter lists, which forces
+         *  new lockers and the last unlocker into the slow path that is guarded by m_lock.
+         */
+        static constexpr size_t k_writer = 1;
+        static constexpr size_t k_pending = 2;
+        static constexpr size_t k_reader = 4;
+
+        std::atomic_size_t m_state;
+        std::mutex m_lock;
+        details::slist<details::async_shared_mutex_awaiter> m_waiting_readers;
+        size_t m_waiting_reader_count;
+        details::slist<details::async_shared_mutex_awaiter> m_waiting_writers;
+
+        size_t waiters_mask() const noexcept;
+
+        bool enqueue_reader(details::async_shared_mutex_awaiter& awaiter);
+        bool enqueue_writer(details::async_shared_mutex_awaiter& awaiter);
+
+        void on_readers_drained();
+        void on_writer_released();
+
+        static void resume_readers(details::slist<details::async_shared_mutex_awaiter>& readers) noexcept;
+
+       public:
+        async_shared_mutex() noexcept;
+        ~async_shared_mutex() noexcept;
+
+        async_shared_mutex(const async_shared_mutex&) = delete;
+        async_shared_mutex(async_shared_mutex&&) = delete;
+
+        details::async_unique_lock_awaiter lock(std::shared_ptr<executor> resume_executor);
+        bool try_lock() noexcept;
+        void unlock();
+
+        details::async_shared_lock_awaiter lock_shared(std::shared_ptr<executor> resume_executor);
+        bool try_lock_shared() noexcept;
+        void unlock_shared();
+    };
+
+    class CRCPP_API scoped_async_shared_lock {
+
+       private:
+        async_shared_mutex* m_mutex = nullptr;
+        bool m_owns = false;
+
+       public:
+        scoped_async_shared_lock() noexcept = default;
+        scoped_async_shared_lock(scoped_async_shared_lock&& rhs) noexcept;
+        scoped_async_shared_lock(async_shared_mutex& mutex, std::adopt_lock_t) noexcept;
+
+        ~scoped_async_shared_lock() noexcept;
+
+        scoped_async_shared_lock& operator=(scoped_async_shared_lock&& rhs) noexcept;
+
+        void unlock();
+
+        bool owns_lock() const noexcept;
+        explicit operator bool() const noexcept;
+
+        void swap(scoped_async_shared_lock& rhs) noexcept;
+        async_shared_mutex* release() noexcept;
+        async_shared_mutex* mutex() const noexcept;
+    };
+
+    class CRCPP_API scoped_async_unique_lock {
+
+       private:
+        async_shared_mutex* m_mutex = nullptr;
+        bool m_owns = false;
+
+       public:
+        scoped_async_unique_lock() noexcept = default;
+        scoped_async_unique_lock(scoped_async_unique_lock&& rhs) noexcept;
+        scoped_async_unique_lock(async_shared_mutex& mutex, std::adopt_lock_t) noexcept;
+
+        ~scoped_async_unique_lock() noexcept;
+
+        scoped_async_unique_lock& operator=(scoped_async_unique_lock&& rhs) noexcept;
+
+        void unlock();
+
+        bool owns_lock() const noexcept;
+        explicit operator bool() const noexcept;
+
+        void swap(scoped_async_unique_lock& rhs) noexcept;
+        async_shared_mutex* release() noexcept;
+        async_shared_mutex* mutex() const noexcept;
+    };
+}  // namespace concurrencpp
+
+#endif
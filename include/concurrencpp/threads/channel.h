@@ -0,0 +1,610 @@
+#ifndef CONCURRENCPP_CHANNEL_H
+#define CONCURRENCPP_CHANNEL_H
+
+#include "concurrencpp/errors.h"
+#include "concurrencpp/utils/slist.h"
+#include "concurrencpp/platform_defs.h"
+#include "concurrencpp/threads/constants.h"
+#include "concurrencpp/threads/cache_line.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/results/promises.h"
+#include "concurrencpp/results/impl/resumption_batch.h"
+#include "concurrencpp/forward_declarations.h"
+
+#include <new>
+#include <mutex>
+#include <deque>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <optional>
+
+namespace concurrencpp::details {
+    /*
+     *  Bounded MPMC ring buffer (D. Vyukov). Every cell carries a sequence number that tells producers and consumers
+     *  which lap of the ring the cell is ready for, so a push or a pop claims its cell with a single CAS on its own index.
+     *  The sequence of a cell is 2 * pos when it's free for the push at pos and 2 * pos + 1 when it holds the value pushed at pos,
+     *  so a ring of capacity 1 can tell a full cell from a cell that's free for the next lap.
+     */
+    template<class type>
+    class channel_ring_buffer {
+
+       private:
+        struct cell {
+            std::atomic_size_t sequence;
+            alignas(type) unsigned char storage[sizeof(type)];
+
+            type* get() noexcept {
+                return std::launder(reinterpret_cast<type*>(storage));
+            }
+        };
+
+        const size_t m_capacity;
+        const std::unique_ptr<cell[]> m_cells;
+        alignas(CRCPP_CACHE_LINE_ALIGNMENT) std::atomic_size_t m_enqueue_pos {0};
+        alignas(CRCPP_CACHE_LINE_ALIGNMENT) std::atomic_size_t m_dequeue_pos {0};
+
+       public:
+        explicit channel_ring_buffer(size_t capacity) : m_capacity(capacity), m_cells(std::make_unique<cell[]>(capacity)) {
+            for (size_t i = 0; i < capacity; i++) {
+                m_cells[i].sequence.store(i * 2, std::memory_order_relaxed);
+            }
+        }
+
+        ~channel_ring_buffer() noexcept {
+            while (try_pop().has_value()) {
+            }
+        }
+
+        // value is moved from only if the push succeeds
+        bool try_push(type& value) noexcept {
+            auto pos = m_enqueue_pos.load(std::memory_order_relaxed);
+
+            while (true) {
+                auto& cell = m_cells[pos % m_capacity];
+                const auto sequence = cell.sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos * 2);
+
+                if (diff == 0) {
+                    if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        new (cell.storage) type(std::move(value));
+                        cell.sequence.store(pos * 2 + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;  // full
+                } else {
+                    pos = m_enqueue_pos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        std::optional<type> try_pop() noexcept {
+            auto pos = m_dequeue_pos.load(std::memory_order_relaxed);
+
+            while (true) {
+                auto& cell = m_cells[pos % m_capacity];
+                const auto sequence = cell.sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos * 2 + 1);
+
+                if (diff == 0) {
+                    if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        std::optional<type> value(std::move(*cell.get()));
+                        cell.get()->~type();
+                        cell.sequence.store((pos + m_capacity) * 2, std::memory_order_release);
+                        return value;
+                    }
+                } else if (diff < 0) {
+                    return std::nullopt;  // empty
+                } else {
+                    pos = m_dequeue_pos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+    };
+
+    template<class type>
+    class channel_send_awaiter {
+
+        friend class concurrencpp::channel<type>;
+
+       private:
+        channel<type>& m_parent;
+        std::shared_ptr<executor> m_resume_executor;
+        coroutine_handle<void> m_caller_handle;
+        type m_value;
+        bool m_sent = false;
+        bool m_interrupted = false;
+
+        static result<bool> run_channel_send_awaiter(channel_send_awaiter awaiter) {
+            co_return co_await awaiter;
+        }
+
+       public:
+        channel_send_awaiter* next = nullptr;
+
+       public:
+        channel_send_awaiter(channel<type>& parent, std::shared_ptr<executor> resume_executor, type value) noexcept :
+            m_parent(parent), m_resume_executor(std::move(resume_executor)), m_value(std::move(value)) {}
+
+        channel_send_awaiter(channel_send_awaiter&& rhs) noexcept :
+            m_parent(rhs.m_parent), m_resume_executor(std::move(rhs.m_resume_executor)), m_value(std::move(rhs.m_value)) {
+            assert(!static_cast<bool>(rhs.m_caller_handle) && "concurrencpp::channel_send_awaiter is moved while being awaited.");
+        }
+
+        bool await_ready() {
+            if (m_parent.is_closed()) {
+                return true;
+            }
+
+            m_sent = m_parent.try_send(std::move(m_value));
+            return m_sent;
+        }
+
+        bool await_suspend(coroutine_handle<void> caller_handle) {
+            assert(static_cast<bool>(caller_handle));
+            assert(!caller_handle.done());
+
+            m_caller_handle = caller_handle;
+            return m_parent.enqueue_sender(*this);
+        }
+
+        bool await_resume() const {
+            if (m_interrupted) {
+                throw errors::broken_task(details::consts::k_broken_task_exception_error_msg);
+            }
+
+            return m_sent;
+        }
+
+        result<bool> run() {
+            return run_channel_send_awaiter(std::move(*this));
+        }
+    };
+
+    template<class type>
+    class channel_receive_awaiter {
+
+        friend class concurrencpp::channel<type>;
+
+       protected:
+        channel<type>& m_parent;
+        std::shared_ptr<executor> m_resume_executor;
+        coroutine_handle<void> m_caller_handle;
+        std::optional<type> m_value;
+        bool m_interrupted = false;
+
+        void throw_if_interrupted() {
+            if (!m_interrupted) {
+                return;
+            }
+
+            // the value was handed to this awaiter but resume_executor could not resume it, try to give it back.
+            if (m_value.has_value()) {
+                m_parent.requeue(*m_value);
+            }
+
+            throw errors::broken_task(details::consts::k_broken_task_exception_error_msg);
+        }
+
+        static result<std::optional<type>> run_channel_receive_awaiter(channel_receive_awaiter awaiter) {
+            co_return co_await awaiter;
+        }
+
+       public:
+        channel_receive_awaiter* next = nullptr;
+
+       public:
+        channel_receive_awaiter(channel<type>& parent, std::shared_ptr<executor> resume_executor) noexcept :
+            m_parent(parent), m_resume_executor(std::move(resume_executor)) {}
+
+        channel_receive_awaiter(channel_receive_awaiter&& rhs) noexcept :
+            m_parent(rhs.m_parent), m_resume_executor(std::move(rhs.m_resume_executor)) {
+            assert(!static_cast<bool>(rhs.m_caller_handle) && "concurrencpp::channel_receive_awaiter is moved while being awaited.");
+        }
+
+        bool await_ready() {
+            m_value = m_parent.try_receive();
+            if (m_value.has_value()) {
+                return true;
+            }
+
+            if (!m_parent.is_closed()) {
+                return false;
+            }
+
+            // values sent before the channel was closed are still delivered
+            m_value = m_parent.try_receive();
+            return true;
+        }
+
+        bool await_suspend(coroutine_handle<void> caller_handle) {
+            assert(static_cast<bool>(caller_handle));
+            assert(!caller_handle.done());
+
+            m_caller_handle = caller_handle;
+            return m_parent.enqueue_receiver(*this);
+        }
+
+        std::optional<type> await_resume() {
+            throw_if_interrupted();
+            return std::move(m_value);
+        }
+
+        result<std::optional<type>> run() {
+            return run_channel_receive_awaiter(std::move(*this));
+        }
+    };
+
+    template<class type>
+    class channel_receive_many_awaiter : public channel_receive_awaiter<type> {
+
+       private:
+        const size_t m_max_count;
+
+        static result<std::vector<type>> run_channel_receive_many_awaiter(channel_receive_many_awaiter awaiter) {
+            co_return co_await awaiter;
+        }
+
+       public:
+        channel_receive_many_awaiter(channel<type>& parent, std::shared_ptr<executor> resume_executor, size_t max_count) noexcept :
+            channel_receive_awaiter<type>(parent, std::move(resume_executor)), m_max_count(max_count) {}
+
+        channel_receive_many_awaiter(channel_receive_many_awaiter&& rhs) noexcept = default;
+
+        std::vector<type> await_resume() {
+            this->throw_if_interrupted();
+
+            std::vector<type> values;
+            if (!this->m_value.has_value()) {
+                return values;  // closed and drained
+            }
+
+            values.reserve(m_max_count);
+            values.emplace_back(std::move(*this->m_value));
+            this->m_parent.pop_many(values, m_max_count);
+            return values;
+        }
+
+        result<std::vector<type>> run() {
+            return run_channel_receive_many_awaiter(std::move(*this));
+        }
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    template<class type>
+    class channel {
+
+        static_assert(std::is_nothrow_move_constructible_v<type>,
+                      "concurrencpp::channel<type> - <<type>> must be nothrow move constructible.");
+
+        friend class details::channel_send_awaiter<type>;
+        friend class details::channel_receive_awaiter<type>;
+        friend class details::channel_receive_many_awaiter<type>;
+
+       public:
+        static constexpr size_t unbounded = std::numeric_limits<size_t>::max();
+
+       private:
+        const size_t m_capacity;
+
+        /*
+         *  bounded mode: values live in a lock-free ring. unbounded mode: values live in m_queue, guarded by m_queue_lock.
+         *  in bounded mode, m_queue only holds values that were given back by receivers that couldn't be resumed.
+         *  these came from the head of the channel, so they are received before anything in the ring.
+         */
+        const std::unique_ptr<details::channel_ring_buffer<type>> m_ring;
+        std::mutex m_queue_lock;
+        std::deque<type> m_queue;
+        std::atomic_size_t m_requeued_count {0};
+
+        /*
+         *  senders wait only when the ring is full and receivers wait only when it's empty.
+         *  a waiter announces itself in m_waiter_count and re-checks the ring under m_lock before suspending.
+         *  every successful push or pop checks m_waiter_count after a full fence, and if it's not zero,
+         *  moves values between the ring and the waiters under m_lock. so when neither side waits, send and receive
+         *  never touch m_lock.
+         */
+        alignas(CRCPP_CACHE_LINE_ALIGNMENT) std::atomic_size_t m_waiter_count {0};
+        std::atomic_bool m_closed {false};
+        std::mutex m_lock;
+        details::slist<details::channel_send_awaiter<type>> m_senders;
+        details::slist<details::channel_receive_awaiter<type>> m_receivers;
+
+        // value is moved from only if the push succeeds
+        bool push(type& value) {
+            if (static_cast<bool>(m_ring)) {
+                return m_ring->try_push(value);
+            }
+
+            std::unique_lock<std::mutex> lock(m_queue_lock);
+            m_queue.emplace_back(std::move(value));
+            return true;
+        }
+
+        std::optional<type> pop_queue() {
+            std::unique_lock<std::mutex> lock(m_queue_lock);
+            if (m_queue.empty()) {
+                return std::nullopt;
+            }
+
+            std::optional<type> value(std::move(m_queue.front()));
+            m_queue.pop_front();
+            return value;
+        }
+
+        std::optional<type> pop() {
+            if (!static_cast<bool>(m_ring)) {
+                return pop_queue();
+            }
+
+            if (m_requeued_count.load(std::memory_order_acquire) != 0) {
+                auto value = pop_queue();
+                if (value.has_value()) {
+                    m_requeued_count.fetch_sub(1, std::memory_order_relaxed);
+                    return value;
+                }
+            }
+
+            return m_ring->try_pop();
+        }
+
+        void on_transfer() {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_waiter_count.load(std::memory_order_relaxed) != 0) {
+                serve_waiters();
+            }
+        }
+
+        void serve_waiters() {
+            details::slist<details::channel_send_awaiter<type>> ready_senders;
+            details::slist<details::channel_receive_awaiter<type>> ready_receivers;
+
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                bool progress = true;
+
+                while (progress) {
+                    progress = false;
+
+                    while (!m_senders.empty() && push(m_senders.front()->m_value)) {
+                        const auto sender = m_senders.pop_front();
+                        sender->next = nullptr;
+                        sender->m_sent = true;
+                        ready_senders.push_back(*sender);
+                        m_waiter_count.fetch_sub(1, std::memory_order_relaxed);
+                        progress = true;
+                    }
+
+                    while (!m_receivers.empty()) {
+                        auto value = pop();
+                        if (!value.has_value()) {
+                            break;
+                        }
+
+                        const auto receiver = m_receivers.pop_front();
+                        receiver->next = nullptr;
+                        receiver->m_value.emplace(std::move(*value));
+                        ready_receivers.push_back(*receiver);
+                        m_waiter_count.fetch_sub(1, std::memory_order_relaxed);
+                        progress = true;
+                    }
+                }
+            }
+
+            resume(ready_senders, ready_receivers);
+        }
+
+        static void resume(details::slist<details::channel_send_awaiter<type>>& senders,
+                           details::slist<details::channel_receive_awaiter<type>>& receivers) noexcept {
+            details::resumption_batch batch;
+
+            while (const auto sender = senders.pop_front()) {
+                batch.add(sender->m_resume_executor, sender->m_caller_handle, &sender->m_interrupted);
+            }
+
+            while (const auto receiver = receivers.pop_front()) {
+                batch.add(receiver->m_resume_executor, receiver->m_caller_handle, &receiver->m_interrupted);
+            }
+        }
+
+        bool enqueue_sender(details::channel_send_awaiter<type>& awaiter) {
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                if (m_closed.load(std::memory_order_relaxed)) {
+                    return false;
+                }
+
+                m_waiter_count.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (!push(awaiter.m_value)) {
+                    m_senders.push_back(awaiter);
+                    return true;
+                }
+
+                m_waiter_count.fetch_sub(1, std::memory_order_relaxed);
+                awaiter.m_sent = true;
+            }
+
+            on_transfer();
+            return false;
+        }
+
+        bool enqueue_receiver(details::channel_receive_awaiter<type>& awaiter) {
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                m_waiter_count.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                awaiter.m_value = pop();
+                if (!awaiter.m_value.has_value() && !m_closed.load(std::memory_order_relaxed)) {
+                    m_receivers.push_back(awaiter);
+                    return true;
+                }
+
+                m_waiter_count.fetch_sub(1, std::memory_order_relaxed);
+                if (!awaiter.m_value.has_value()) {
+                    return false;  // closed and drained
+                }
+            }
+
+            on_transfer();
+            return false;
+        }
+
+        // gives back a value that was popped for a receiver that couldn't be resumed. the value goes back to the front,
+        // even if the ring has filled up in the meantime, so it's neither lost nor reordered.
+        void requeue(type& value) {
+            {
+                std::unique_lock<std::mutex> lock(m_queue_lock);
+                m_queue.emplace_front(std::move(value));
+            }
+
+            if (static_cast<bool>(m_ring)) {
+                m_requeued_count.fetch_add(1, std::memory_order_release);
+            }
+
+            on_transfer();
+        }
+
+        void pop_many(std::vector<type>& values, size_t max_count) {
+            const auto prev_size = values.size();
+            while (values.size() < max_count) {
+                auto value = pop();
+                if (!value.has_value()) {
+                    break;
+                }
+
+                values.emplace_back(std::move(*value));
+            }
+
+            if (values.size() != prev_size) {
+                on_transfer();
+            }
+        }
+
+        static std::unique_ptr<details::channel_ring_buffer<type>> make_ring(size_t capacity) {
+            if (capacity == 0) {
+                throw std::invalid_argument(details::consts::k_channel_constructor_zero_capacity_err_msg);
+            }
+
+            if (capacity == unbounded) {
+                return {};
+            }
+
+            return std::make_unique<details::channel_ring_buffer<type>>(capacity);
+        }
+
+       public:
+        explicit channel(size_t capacity) : m_capacity(capacity), m_ring(make_ring(capacity)) {}
+
+        ~channel() noexcept {
+#ifdef CRCPP_DEBUG_MODE
+            std::unique_lock<std::mutex> lock(m_lock);
+            assert(m_senders.empty() && m_receivers.empty() && "concurrencpp::channel is deleted while being used.");
+#endif
+        }
+
+        channel(const channel&) = delete;
+        channel(channel&&) = delete;
+
+        details::channel_send_awaiter<type> send(std::shared_ptr<executor> resume_executor, type value) {
+            if (!static_cast<bool>(resume_executor)) {
+                throw std::invalid_argument(details::consts::k_channel_send_null_resume_executor_err_msg);
+            }
+
+            return {*this, std::move(resume_executor), std::move(value)};
+        }
+
+        details::channel_receive_awaiter<type> receive(std::shared_ptr<executor> resume_executor) {
+            if (!static_cast<bool>(resume_executor)) {
+                throw std::invalid_argument(details::consts::k_channel_receive_null_resume_executor_err_msg);
+            }
+
+            return {*this, std::move(resume_executor)};
+        }
+
+        details::channel_receive_many_awaiter<type> receive_many(std::shared_ptr<executor> resume_executor, size_t max_count) {
+            if (!static_cast<bool>(resume_executor)) {
+                throw std::invalid_argument(details::consts::k_channel_receive_many_null_resume_executor_err_msg);
+            }
+
+            if (max_count == 0) {
+                throw std::invalid_argument(details::consts::k_channel_receive_many_zero_max_count_err_msg);
+            }
+
+            return {*this, std::move(resume_executor), max_count};
+        }
+
+        // value is moved from only if it was sent
+        bool try_send(type&& value) {
+            if (is_closed() || !push(value)) {
+                return false;
+            }
+
+            on_transfer();
+            return true;
+        }
+
+        bool try_send(const type& value) {
+            type copy(value);
+            return try_send(std::move(copy));
+        }
+
+        std::optional<type> try_receive() {
+            auto value = pop();
+            if (value.has_value()) {
+                on_transfer();
+            }
+
+            return value;
+        }
+
+        std::vector<type> try_receive_many(size_t max_count) {
+            std::vector<type> values;
+            pop_many(values, max_count);
+            return values;
+        }
+
+        void close() {
+            details::slist<details::channel_send_awaiter<type>> senders;
+            details::slist<details::channel_receive_awaiter<type>> receivers;
+
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                if (m_closed.exchange(true, std::memory_order_seq_cst)) {
+                    return;
+                }
+
+                // senders that still wait are resumed with false, receivers get whatever is left in the buffer first
+                while (const auto sender = m_senders.pop_front()) {
+                    sender->next = nullptr;
+                    senders.push_back(*sender);
+                    m_waiter_count.fetch_sub(1, std::memory_order_relaxed);
+                }
+
+                while (const auto receiver = m_receivers.pop_front()) {
+                    receiver->next = nullptr;
+                    receiver->m_value = pop();
+                    receivers.push_back(*receiver);
+                    m_waiter_count.fetch_sub(1, std::memory_order_relaxed);
+                }
+            }
+
+            resume(senders, receivers);
+        }
+
+        bool is_closed() const noexcept {
+            return m_closed.load(std::memory_order_acquire);
+        }
+
+        size_t capacity() const noexcept {
+            return m_capacity;
+        }
+    };
+}  // namespace concurrencpp
+
+#endif
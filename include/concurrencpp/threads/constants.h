@@ -20,12 +20,64 @@ namespace concurrencpp::details::consts {
     inline const char* k_scoped_async_lock_unlock_invalid_lock_err_msg =
         "concurrencpp::scoped_async_lock::unlock() - trying to unlock an unowned lock.";
 
+    inline const char* k_async_shared_mutex_lock_null_resume_executor_err_msg =
+        "concurrencpp::async_shared_mutex::lock() - given resume executor is null.";
+
+    inline const char* k_async_shared_mutex_lock_shared_null_resume_executor_err_msg =
+        "concurrencpp::async_shared_mutex::lock_shared() - given resume executor is null.";
+
+    inline const char* k_async_shared_mutex_unlock_invalid_lock_err_msg =
+        "concurrencpp::async_shared_mutex::unlock() - trying to unlock an unowned lock.";
+
+    inline const char* k_async_shared_mutex_unlock_shared_invalid_lock_err_msg =
+        "concurrencpp::async_shared_mutex::unlock_shared() - trying to unlock an unowned lock.";
+
+    inline const char* k_scoped_async_shared_lock_unlock_invalid_lock_err_msg =
+        "concurrencpp::scoped_async_shared_lock::unlock() - trying to unlock an unowned lock.";
+
+    inline const char* k_scoped_async_unique_lock_unlock_invalid_lock_err_msg =
+        "concurrencpp::scoped_async_unique_lock::unlock() - trying to unlock an unowned lock.";
+
+    inline const char* k_async_semaphore_acquire_null_resume_executor_err_msg =
+        "concurrencpp::async_semaphore::acquire() - given resume executor is null.";
+
+    inline const char* k_async_semaphore_permit_release_empty_permit_err_msg =
+        "concurrencpp::async_semaphore_permit::release() - *this doesn't hold any permits.";
+
+    inline const char* k_async_latch_wait_null_resume_executor_err_msg = "concurrencpp::async_latch::wait() - given resume executor is null.";
+
+    inline const char* k_async_latch_arrive_and_wait_null_resume_executor_err_msg =
+        "concurrencpp::async_latch::arrive_and_wait() - given resume executor is null.";
+
+    inline const char* k_async_barrier_constructor_zero_expected_err_msg =
+        "concurrencpp::async_barrier::async_barrier() - expected number of participants is zero.";
+
+    inline const char* k_async_barrier_arrive_and_wait_null_resume_executor_err_msg =
+        "concurrencpp::async_barrier::arrive_and_wait() - given resume executor is null.";
+
+    inline const char* k_async_manual_reset_event_wait_null_resume_executor_err_msg =
+        "concurrencpp::async_manual_reset_event::wait() - given resume executor is null.";
+
+    inline const char* k_async_auto_reset_event_wait_null_resume_executor_err_msg =
+        "concurrencpp::async_auto_reset_event::wait() - given resume executor is null.";
+
     inline const char* k_async_condition_variable_await_invalid_resume_executor_err_msg =
         "concurrencpp::async_condition_variable::await() - resume_executor is null.";
 
     inline const char* k_async_condition_variable_await_lock_unlocked_err_msg =
         "concurrencpp::async_condition_variable::await() - lock is unlocked.";
 
+    inline const char* k_channel_constructor_zero_capacity_err_msg = "concurrencpp::channel::channel() - capacity is zero.";
+
+    inline const char* k_channel_send_null_resume_executor_err_msg = "concurrencpp::channel::send() - given resume executor is null.";
+
+    inline const char* k_channel_receive_null_resume_executor_err_msg = "concurrencpp::channel::receive() - given resume executor is null.";
+
+    inline const char* k_channel_receive_many_null_resume_executor_err_msg =
+        "concurrencpp::channel::receive_many() - given resume executor is null.";
+
+    inline const char* k_channel_receive_many_zero_max_count_err_msg = "concurrencpp::channel::receive_many() - max_count is zero.";
+
 }  // namespace concurrencpp::details::consts
 
 #endif
\ No newline at end of file
@@ -7,11 +7,18 @@ namespace concurrencpp::details::consts {
     inline const char* k_timer_empty_get_executor_err_msg = "concurrencpp::timer::get_executor() - timer is empty.";
     inline const char* k_timer_empty_get_timer_queue_err_msg = "concurrencpp::timer::get_timer_queue() - timer is empty.";
     inline const char* k_timer_empty_set_frequency_err_msg = "concurrencpp::timer::set_frequency() - timer is empty.";
+    inline const char* k_timer_empty_get_missed_tick_policy_err_msg = "concurrencpp::timer::get_missed_tick_policy() - timer is empty.";
+    inline const char* k_timer_empty_get_skipped_ticks_err_msg = "concurrencpp::timer::get_skipped_ticks() - timer is empty.";
 
     inline const char* k_timer_queue_make_timer_executor_null_err_msg = "concurrencpp::timer_queue::make_timer() - executor is null.";
     inline const char* k_timer_queue_make_oneshot_timer_executor_null_err_msg =
         "concurrencpp::timer_queue::make_one_shot_timer() - executor is null.";
+    inline const char* k_timer_queue_make_timers_executor_null_err_msg = "concurrencpp::timer_queue::make_timers() - executor is null.";
+    inline const char* k_timer_queue_make_oneshot_timers_executor_null_err_msg =
+        "concurrencpp::timer_queue::make_one_shot_timers() - executor is null.";
     inline const char* k_timer_queue_make_delay_object_executor_null_err_msg = "concurrencpp::timer_queue::make_delay_object() - executor is null.";
+    inline const char* k_timer_queue_make_delay_awaitable_executor_null_err_msg =
+        "concurrencpp::timer_queue::make_delay_awaitable() - executor is null.";
     inline const char* k_timer_queue_shutdown_err_msg = "concurrencpp::timer_queue has been shut down.";
 }  // namespace concurrencpp::details::consts
 
@@ -8,6 +8,10 @@
 #include <memory>
 #include <chrono>
 
+namespace concurrencpp {
+    enum class missed_tick_policy { fire_once, fire_all, skip };
+}  // namespace concurrencpp
+
 namespace concurrencpp::details {
     class CRCPP_API timer_state_base : public std::enable_shared_from_this<timer_state_base> {
 
@@ -21,9 +25,13 @@ namespace concurrencpp::details {
         const std::shared_ptr<executor> m_executor;
         const size_t m_due_time;
         std::atomic_size_t m_frequency;
+        std::atomic_size_t m_skipped_ticks;
         time_point m_deadline;  // set by the c.tor, changed only by the timer_queue thread.
         std::atomic_bool m_cancelled;
         const bool m_is_oneshot;
+        const missed_tick_policy m_missed_tick_policy;
+
+        size_t advance_deadline(time_point now, size_t frequency) noexcept;
 
         static time_point make_deadline(milliseconds diff) noexcept {
             return clock_type::now() + diff;
@@ -34,13 +42,14 @@ namespace concurrencpp::details {
                          size_t frequency,
                          std::shared_ptr<concurrencpp::executor> executor,
                          std::weak_ptr<concurrencpp::timer_queue> timer_queue,
-                         bool is_oneshot) noexcept;
+                         bool is_oneshot,
+                         missed_tick_policy missed_tick_policy) noexcept;
 
         virtual ~timer_state_base() noexcept = default;
 
-        virtual void execute() = 0;
+        virtual void execute(size_t tick_count) = 0;
 
-        void fire();
+        void fire(time_point now);
 
         bool expired(const time_point now) const noexcept {
             return m_deadline <= now;
@@ -62,6 +71,14 @@ namespace concurrencpp::details {
             return m_is_oneshot;
         }
 
+        missed_tick_policy get_missed_tick_policy() const noexcept {
+            return m_missed_tick_policy;
+        }
+
+        size_t get_skipped_ticks() const noexcept {
+            return m_skipped_ticks.load(std::memory_order_relaxed);
+        }
+
         std::shared_ptr<executor> get_executor() const noexcept {
             return m_executor;
         }
@@ -96,16 +113,19 @@ namespace concurrencpp::details {
                     std::shared_ptr<concurrencpp::executor> executor,
                     std::weak_ptr<concurrencpp::timer_queue> timer_queue,
                     bool is_oneshot,
+                    missed_tick_policy missed_tick_policy,
                     given_callable_type&& callable) :
-            timer_state_base(due_time, frequency, std::move(executor), std::move(timer_queue), is_oneshot),
+            timer_state_base(due_time, frequency, std::move(executor), std::move(timer_queue), is_oneshot, missed_tick_policy),
             m_callable(std::forward<given_callable_type>(callable)) {}
 
-        void execute() override {
-            if (cancelled()) {
-                return;
-            }
+        void execute(size_t tick_count) override {
+            for (size_t i = 0; i < tick_count; i++) {
+                if (cancelled()) {
+                    return;
+                }
 
-            m_callable();
+                m_callable();
+            }
         }
     };
 }  // namespace concurrencpp::details
@@ -113,6 +133,8 @@ namespace concurrencpp::details {
 namespace concurrencpp {
     class CRCPP_API timer {
 
+        friend class timer_queue;
+
        private:
         std::shared_ptr<details::timer_state_base> m_state;
 
@@ -139,6 +161,9 @@ namespace concurrencpp {
         std::chrono::milliseconds get_frequency() const;
         void set_frequency(std::chrono::milliseconds new_frequency);
 
+        missed_tick_policy get_missed_tick_policy() const;
+        size_t get_skipped_ticks() const;
+
         explicit operator bool() const noexcept {
             return static_cast<bool>(m_state);
         }
@@ -5,20 +5,133 @@
 #include "constants.h"
 #include "concurrencpp/errors.h"
 #include "concurrencpp/utils/bind.h"
+#include "concurrencpp/utils/slist.h"
 #include "concurrencpp/threads/thread.h"
 #include "concurrencpp/results/lazy_result.h"
+#include "concurrencpp/coroutines/coroutine.h"
 
 #include <mutex>
+#include <span>
 #include <memory>
 #include <chrono>
 #include <vector>
+#include <ranges>
+#include <type_traits>
 #include <condition_variable>
 
 #include <cassert>
 
 namespace concurrencpp::details {
     enum class timer_request { add, remove };
-}
+
+    class CRCPP_API delay_awaitable {
+
+        friend class delay_queue;
+        friend class concurrencpp::timer_queue;
+
+       public:
+        using clock_type = std::chrono::high_resolution_clock;
+        using time_point = std::chrono::time_point<clock_type>;
+
+       private:
+        // firing: popped by the timer queue, which still reads the node until it stores fired
+        enum class status { idle, pending, firing, fired };
+
+        timer_queue& m_parent_queue;
+        executor& m_executor;
+        const std::chrono::milliseconds m_due_time;
+        time_point m_deadline;
+        coroutine_handle<void> m_caller_handle;
+        size_t m_heap_index = static_cast<size_t>(-1);  // guarded by timer_queue::m_lock
+        std::atomic<status> m_status {status::idle};
+        bool m_interrupted = false;
+
+        void fire() noexcept;
+        void interrupt() noexcept;
+
+       public:
+        delay_awaitable* next = nullptr;
+
+        delay_awaitable(timer_queue& parent_queue, executor& executor, std::chrono::milliseconds due_time) noexcept;
+        ~delay_awaitable() noexcept;
+
+        delay_awaitable(const delay_awaitable&) = delete;
+        delay_awaitable(delay_awaitable&&) = delete;
+
+        delay_awaitable& operator=(const delay_awaitable&) = delete;
+        delay_awaitable& operator=(delay_awaitable&&) = delete;
+
+        constexpr bool await_ready() const noexcept {
+            return false;
+        }
+
+        bool await_suspend(coroutine_handle<void> caller_handle);
+        void await_resume() const;
+    };
+
+    class CRCPP_API delay_queue {
+
+        using time_point = delay_awaitable::time_point;
+
+       private:
+        std::vector<delay_awaitable*> m_heap;
+
+        void place(delay_awaitable* node, size_t index) noexcept;
+        void sift_up(size_t index) noexcept;
+        void sift_down(size_t index) noexcept;
+        void remove_at(size_t index) noexcept;
+
+       public:
+        bool empty() const noexcept {
+            return m_heap.empty();
+        }
+
+        time_point next_deadline() const noexcept;
+
+        bool push(delay_awaitable& node);
+        void remove(delay_awaitable& node) noexcept;
+
+        slist<delay_awaitable> pop_expired(time_point now) noexcept;
+        slist<delay_awaitable> pop_all() noexcept;
+    };
+}  // namespace concurrencpp::details
+
+namespace concurrencpp {
+    template<class callable_type>
+    struct timer_descriptor {
+        std::chrono::milliseconds due_time;
+        std::chrono::milliseconds frequency;
+        std::shared_ptr<concurrencpp::executor> executor;
+        callable_type callable;
+        missed_tick_policy policy = missed_tick_policy::fire_once;
+    };
+
+    template<class callable_type>
+    struct one_shot_timer_descriptor {
+        std::chrono::milliseconds due_time;
+        std::shared_ptr<concurrencpp::executor> executor;
+        callable_type callable;
+    };
+}  // namespace concurrencpp
+
+namespace concurrencpp::details {
+    template<class type, template<class> class descriptor_template>
+    struct is_descriptor_of : std::false_type {};
+
+    template<class callable_type, template<class> class descriptor_template>
+    struct is_descriptor_of<descriptor_template<callable_type>, descriptor_template> : std::true_type {};
+
+    // a contiguous range of mutable descriptors, like a std::vector or a std::span. the callables are moved out of it
+    template<class range_type, template<class> class descriptor_template>
+    concept descriptor_range = std::ranges::contiguous_range<range_type> && std::ranges::sized_range<range_type> &&
+        !std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<range_type>>> &&
+        is_descriptor_of<std::ranges::range_value_t<range_type>, descriptor_template>::value;
+
+    template<class range_type>
+    auto as_descriptor_span(range_type& descriptors) noexcept {
+        return std::span<std::ranges::range_value_t<range_type>>(std::ranges::data(descriptors), std::ranges::size(descriptors));
+    }
+}  // namespace concurrencpp::details
 
 namespace concurrencpp {
     class CRCPP_API timer_queue : public std::enable_shared_from_this<timer_queue> {
@@ -30,6 +143,7 @@ namespace concurrencpp {
         using request_queue = std::vector<std::pair<timer_ptr, details::timer_request>>;
 
         friend class concurrencpp::timer;
+        friend class details::delay_awaitable;
 
        private:
         std::atomic_bool m_atomic_abort;
@@ -37,6 +151,8 @@ namespace concurrencpp {
         request_queue m_request_queue;
         details::thread m_worker;
         std::condition_variable m_condition;
+        details::delay_queue m_delays;
+        bool m_delays_changed;
         bool m_abort;
         bool m_idle;
         const std::chrono::milliseconds m_max_waiting_time;
@@ -49,6 +165,10 @@ namespace concurrencpp {
         void remove_internal_timer(timer_ptr existing_timer);
 
         void add_timer(std::unique_lock<std::mutex>& lock, timer_ptr new_timer);
+        void add_timers(std::span<timer_ptr> new_timers);
+
+        bool add_delay(details::delay_awaitable& delay);
+        void remove_delay(details::delay_awaitable& delay) noexcept;
 
         lazy_result<void> make_delay_object_impl(std::chrono::milliseconds due_time,
                                                  std::shared_ptr<concurrencpp::timer_queue> self,
@@ -59,6 +179,7 @@ namespace concurrencpp {
                                   size_t frequency,
                                   std::shared_ptr<concurrencpp::executor> executor,
                                   bool is_oneshot,
+                                  missed_tick_policy missed_tick_policy,
                                   callable_type&& callable) {
             assert(static_cast<bool>(executor));
 
@@ -69,6 +190,7 @@ namespace concurrencpp {
                                                                                     std::move(executor),
                                                                                     weak_from_this(),
                                                                                     is_oneshot,
+                                                                                    missed_tick_policy,
                                                                                     std::forward<callable_type>(callable));
             {
                 std::unique_lock<std::mutex> lock(m_lock);
@@ -78,6 +200,52 @@ namespace concurrencpp {
             return timer_state;
         }
 
+        template<class descriptor_type>
+        std::vector<timer> make_timers_impl(std::span<descriptor_type> descriptors, bool is_oneshot, const char* executor_null_error) {
+            for (const auto& descriptor : descriptors) {
+                if (!static_cast<bool>(descriptor.executor)) {
+                    throw std::invalid_argument(executor_null_error);
+                }
+            }
+
+            if (descriptors.empty()) {
+                return {};
+            }
+
+            using decayed_type = typename std::decay_t<decltype(descriptors[0].callable)>;
+
+            std::vector<timer_ptr> timer_states;
+            timer_states.reserve(descriptors.size());
+
+            for (auto& descriptor : descriptors) {
+                size_t frequency = 0;
+                auto policy = missed_tick_policy::fire_once;
+                if constexpr (requires { descriptor.frequency; }) {
+                    frequency = descriptor.frequency.count();
+                    policy = descriptor.policy;
+                }
+
+                timer_states.emplace_back(std::make_shared<details::timer_state<decayed_type>>(descriptor.due_time.count(),
+                                                                                              frequency,
+                                                                                              descriptor.executor,
+                                                                                              weak_from_this(),
+                                                                                              is_oneshot,
+                                                                                              policy,
+                                                                                              std::move(descriptor.callable)));
+            }
+
+            add_timers(timer_states);
+
+            std::vector<timer> timers;
+            timers.reserve(timer_states.size());
+
+            for (auto& timer_state : timer_states) {
+                timers.emplace_back(std::move(timer_state));
+            }
+
+            return timers;
+        }
+
         void work_loop();
 
        public:
@@ -103,6 +271,26 @@ namespace concurrencpp {
                                    frequency.count(),
                                    std::move(executor),
                                    false,
+                                   missed_tick_policy::fire_once,
+                                   details::bind(std::forward<callable_type>(callable), std::forward<argumet_types>(arguments)...));
+        }
+
+        template<class callable_type, class... argumet_types>
+        timer make_timer(std::chrono::milliseconds due_time,
+                         std::chrono::milliseconds frequency,
+                         missed_tick_policy missed_tick_policy,
+                         std::shared_ptr<concurrencpp::executor> executor,
+                         callable_type&& callable,
+                         argumet_types&&... arguments) {
+            if (!static_cast<bool>(executor)) {
+                throw std::invalid_argument(details::consts::k_timer_queue_make_timer_executor_null_err_msg);
+            }
+
+            return make_timer_impl(due_time.count(),
+                                   frequency.count(),
+                                   std::move(executor),
+                                   false,
+                                   missed_tick_policy,
                                    details::bind(std::forward<callable_type>(callable), std::forward<argumet_types>(arguments)...));
         }
 
@@ -119,11 +307,33 @@ namespace concurrencpp {
                                    0,
                                    std::move(executor),
                                    true,
+                                   missed_tick_policy::fire_once,
                                    details::bind(std::forward<callable_type>(callable), std::forward<argumet_types>(arguments)...));
         }
 
+        template<class range_type>
+        requires details::descriptor_range<range_type, timer_descriptor>
+        std::vector<timer> make_timers(range_type&& descriptors) {
+            return make_timers_impl(details::as_descriptor_span(descriptors),
+                                    false,
+                                    details::consts::k_timer_queue_make_timers_executor_null_err_msg);
+        }
+
+        template<class range_type>
+        requires details::descriptor_range<range_type, one_shot_timer_descriptor>
+        std::vector<timer> make_one_shot_timers(range_type&& descriptors) {
+            return make_timers_impl(details::as_descriptor_span(descriptors),
+                                    true,
+                                    details::consts::k_timer_queue_make_oneshot_timers_executor_null_err_msg);
+        }
+
+        void cancel_timers(std::span<timer> timers);
+
         lazy_result<void> make_delay_object(std::chrono::milliseconds due_time, std::shared_ptr<concurrencpp::executor> executor);
 
+        details::delay_awaitable make_delay_awaitable(std::chrono::milliseconds due_time,
+                                                      const std::shared_ptr<concurrencpp::executor>& executor);
+
         std::chrono::milliseconds max_worker_idle_time() const noexcept;
     };
 }  // namespace concurrencpp
@@ -33,6 +33,11 @@ namespace concurrencpp::details {
             return m_head == nullptr;
         }
 
+        node_type* front() const noexcept {
+            assert_state();
+            return m_head;
+        }
+
         void push_back(node_type& node) noexcept {
             assert_state();
 
@@ -0,0 +1,461 @@
+#include "concurrencpp/executors/epoll_executor.h"
+
+#include "concurrencpp/errors.h"
+#include "concurrencpp/results/constants.h"
+#include "concurrencpp/executors/constants.h"
+
+#include <array>
+#include <cerrno>
+#include <system_error>
+
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+using concurrencpp::epoll_executor;
+using concurrencpp::details::epoll_awaitable;
+using concurrencpp::details::epoll_registration;
+
+namespace concurrencpp::details {
+    namespace {
+        constexpr uint32_t k_readable_events = EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR;
+        constexpr uint32_t k_writable_events = EPOLLOUT | EPOLLHUP | EPOLLERR;
+        constexpr size_t k_max_events = 64;
+
+        [[noreturn]] void throw_system_error(int error_code, const char* what) {
+            throw std::system_error(error_code, std::system_category(), what);
+        }
+
+        int make_epoll_fd() {
+            const auto fd = ::epoll_create1(EPOLL_CLOEXEC);
+            if (fd == -1) {
+                throw_system_error(errno, "concurrencpp::epoll_executor - epoll_create1() failed.");
+            }
+
+            return fd;
+        }
+
+        int make_wake_fd(int epoll_fd) {
+            const auto fd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+            if (fd == -1) {
+                const auto error = errno;
+                ::close(epoll_fd);
+                throw_system_error(error, "concurrencpp::epoll_executor - eventfd() failed.");
+            }
+
+            epoll_event event {};
+            event.events = EPOLLIN | EPOLLET;
+            event.data.fd = fd;
+
+            if (::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) == -1) {
+                const auto error = errno;
+                ::close(fd);
+                ::close(epoll_fd);
+                throw_system_error(error, "concurrencpp::epoll_executor - epoll_ctl() failed.");
+            }
+
+            return fd;
+        }
+    }  // namespace
+
+    // hands an awaitable that was suspended on a foreign thread to the executor thread
+    class epoll_register_functor {
+
+       private:
+        epoll_awaitable* m_awaitable;
+
+       public:
+        epoll_register_functor(epoll_awaitable* awaitable) noexcept : m_awaitable(awaitable) {}
+
+        epoll_register_functor(epoll_register_functor&& rhs) noexcept : m_awaitable(std::exchange(rhs.m_awaitable, nullptr)) {}
+
+        ~epoll_register_functor() noexcept {
+            if (m_awaitable == nullptr) {
+                return;
+            }
+
+            m_awaitable->resume(epoll_awaitable::status::interrupted);
+        }
+
+        void operator()() noexcept {
+            const auto awaitable = std::exchange(m_awaitable, nullptr);
+            assert(awaitable != nullptr);
+
+            if (!awaitable->m_executor.register_awaitable(*awaitable)) {
+                awaitable->m_caller_handle();
+            }
+        }
+    };
+}  // namespace concurrencpp::details
+
+/*
+    epoll_awaitable
+*/
+
+epoll_awaitable::epoll_awaitable(epoll_executor& executor, int fd, bool writable, std::optional<clock_type::time_point> deadline) noexcept
+    :
+    m_executor(executor),
+    m_fd(fd), m_writable(writable), m_deadline(deadline) {}
+
+void epoll_awaitable::resume(status status, int error) noexcept {
+    m_status = status;
+    m_error = error;
+    m_caller_handle();
+}
+
+bool epoll_awaitable::await_suspend(coroutine_handle<void> caller_handle) {
+    m_caller_handle = caller_handle;
+
+    if (m_executor.m_tasks.running_in_this_thread()) {
+        if (m_executor.m_tasks.abort_requested()) {
+            m_status = status::interrupted;
+            return false;
+        }
+
+        return m_executor.register_awaitable(*this);
+    }
+
+    try {
+        m_executor.post(epoll_register_functor {this});
+    } catch (...) {
+        // the exception caused the enqeueud task to be broken and resumed with an interrupt, no need to do anything here.
+    }
+
+    return true;
+}
+
+bool epoll_awaitable::await_resume() const {
+    switch (m_status) {
+        case status::ready: {
+            return true;
+        }
+
+        case status::timed_out: {
+            return false;
+        }
+
+        case status::interrupted: {
+            throw errors::broken_task(consts::k_broken_task_exception_error_msg);
+        }
+
+        case status::failed: {
+            throw_system_error(m_error, "concurrencpp::epoll_executor - waiting for a file descriptor failed.");
+        }
+
+        case status::idle: {
+            break;
+        }
+    }
+
+    assert(false);
+    return false;
+}
+
+/*
+    epoll_executor
+*/
+
+epoll_executor::epoll_executor(const std::function<void(std::string_view thread_name)>& thread_started_callback,
+                               const std::function<void(std::string_view thread_name)>& thread_terminated_callback) :
+    derivable_executor<concurrencpp::epoll_executor>(details::consts::k_epoll_executor_name),
+    m_tasks(name), m_epoll_fd(details::make_epoll_fd()), m_wake_fd(details::make_wake_fd(m_epoll_fd)), m_atomic_abort(false) {
+    m_thread = details::thread(
+        details::make_executor_worker_name(name),
+        [this] {
+            work_loop();
+        },
+        thread_started_callback,
+        thread_terminated_callback);
+}
+
+epoll_executor::~epoll_executor() noexcept {
+    shutdown();
+    ::close(m_wake_fd);
+    ::close(m_epoll_fd);
+}
+
+void epoll_executor::wake_loop() const noexcept {
+    const uint64_t value = 1;
+    [[maybe_unused]] const auto written = ::write(m_wake_fd, &value, sizeof(value));
+}
+
+bool epoll_executor::register_awaitable(details::epoll_awaitable& awaitable) noexcept {
+    auto it = m_registrations.find(awaitable.m_fd);
+    if (it == m_registrations.end()) {
+        epoll_event event {};
+        event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+        event.data.fd = awaitable.m_fd;
+
+        if (::epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, awaitable.m_fd, &event) == -1) {
+            awaitable.m_status = details::epoll_awaitable::status::failed;
+            awaitable.m_error = errno;
+            return false;
+        }
+
+        it = m_registrations.try_emplace(awaitable.m_fd, awaitable.m_fd).first;
+    }
+
+    auto& registration = it->second;
+    auto& cached_edge = awaitable.m_writable ? registration.writable : registration.readable;
+    if (cached_edge) {
+        cached_edge = false;
+        awaitable.m_status = details::epoll_awaitable::status::ready;
+        return false;
+    }
+
+    auto& head = awaitable.m_writable ? registration.writers : registration.readers;
+    awaitable.m_registration = &registration;
+    awaitable.m_prev = nullptr;
+    awaitable.m_next = head;
+    if (head != nullptr) {
+        head->m_prev = &awaitable;
+    }
+
+    head = &awaitable;
+
+    if (awaitable.m_deadline.has_value()) {
+        awaitable.m_deadline_it = m_deadlines.emplace(awaitable.m_deadline.value(), &awaitable);
+    }
+
+    return true;
+}
+
+void epoll_executor::unlink_awaitable(details::epoll_awaitable& awaitable) noexcept {
+    auto& registration = *awaitable.m_registration;
+    auto& head = awaitable.m_writable ? registration.writers : registration.readers;
+
+    if (awaitable.m_prev != nullptr) {
+        awaitable.m_prev->m_next = awaitable.m_next;
+    } else {
+        assert(head == &awaitable);
+        head = awaitable.m_next;
+    }
+
+    if (awaitable.m_next != nullptr) {
+        awaitable.m_next->m_prev = awaitable.m_prev;
+    }
+
+    if (awaitable.m_deadline.has_value()) {
+        m_deadlines.erase(awaitable.m_deadline_it);
+    }
+
+    awaitable.m_registration = nullptr;
+    awaitable.m_prev = nullptr;
+    awaitable.m_next = nullptr;
+}
+
+void epoll_executor::resume_all(details::epoll_awaitable* head) noexcept {
+    // the list is detached first, resumed coroutines may wait on the same file descriptor again
+    while (head != nullptr) {
+        const auto next = head->m_next;
+        if (head->m_deadline.has_value()) {
+            m_deadlines.erase(head->m_deadline_it);
+        }
+
+        head->m_registration = nullptr;
+        head->m_prev = nullptr;
+        head->m_next = nullptr;
+        head->resume(details::epoll_awaitable::status::ready);
+
+        head = next;
+    }
+}
+
+void epoll_executor::dispatch_events(details::epoll_registration& registration, uint32_t events) {
+    details::epoll_awaitable* readers = nullptr;
+    details::epoll_awaitable* writers = nullptr;
+
+    if ((events & details::k_readable_events) != 0) {
+        if (registration.readers == nullptr) {
+            registration.readable = true;
+        } else {
+            readers = std::exchange(registration.readers, nullptr);
+        }
+    }
+
+    if ((events & details::k_writable_events) != 0) {
+        if (registration.writers == nullptr) {
+            registration.writable = true;
+        } else {
+            writers = std::exchange(registration.writers, nullptr);
+        }
+    }
+
+    // registration is not touched from here on, a resumed coroutine might unregister its descriptor
+    resume_all(readers);
+    resume_all(writers);
+}
+
+void epoll_executor::expire_deadlines() {
+    if (m_deadlines.empty()) {
+        return;
+    }
+
+    const auto now = details::epoll_awaitable::clock_type::now();
+    while (!m_deadlines.empty()) {
+        const auto it = m_deadlines.begin();
+        if (it->first > now) {
+            return;
+        }
+
+        auto& awaitable = *it->second;
+        unlink_awaitable(awaitable);
+        awaitable.resume(details::epoll_awaitable::status::timed_out);
+    }
+}
+
+int epoll_executor::wait_timeout() const noexcept {
+    if (m_tasks.has_private_tasks()) {
+        return 0;
+    }
+
+    if (m_deadlines.empty()) {
+        return -1;
+    }
+
+    const auto remaining = m_deadlines.begin()->first - details::epoll_awaitable::clock_type::now();
+    if (remaining <= std::chrono::nanoseconds::zero()) {
+        return 0;
+    }
+
+    // round up, waking before the deadline only to go back to sleep is wasteful
+    const auto ms = std::chrono::ceil<std::chrono::milliseconds>(remaining).count();
+    return static_cast<int>(std::min<decltype(ms)>(ms, std::numeric_limits<int>::max()));
+}
+
+void epoll_executor::wait_for_events(int timeout_ms) {
+    std::array<epoll_event, details::k_max_events> events;
+    const auto count = ::epoll_wait(m_epoll_fd, events.data(), static_cast<int>(events.size()), timeout_ms);
+    if (count == -1) {
+        if (errno == EINTR) {
+            return;
+        }
+
+        details::throw_system_error(errno, "concurrencpp::epoll_executor - epoll_wait() failed.");
+    }
+
+    for (int i = 0; i < count; i++) {
+        const auto fd = events[i].data.fd;
+        if (fd == m_wake_fd) {
+            uint64_t value;
+            [[maybe_unused]] const auto read = ::read(m_wake_fd, &value, sizeof(value));
+            continue;
+        }
+
+        // looked up by descriptor: a coroutine resumed by an earlier event might have unregistered this one
+        const auto it = m_registrations.find(fd);
+        if (it != m_registrations.end()) {
+            dispatch_events(it->second, events[i].events);
+        }
+    }
+}
+
+void epoll_executor::unregister_impl(int fd) noexcept {
+    const auto it = m_registrations.find(fd);
+    if (it == m_registrations.end()) {
+        return;
+    }
+
+    ::epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);  // fails harmlessly if fd was already closed
+
+    const auto readers = it->second.readers;
+    const auto writers = it->second.writers;
+    m_registrations.erase(it);
+
+    for (auto head : {readers, writers}) {
+        while (head != nullptr) {
+            const auto next = head->m_next;
+            if (head->m_deadline.has_value()) {
+                m_deadlines.erase(head->m_deadline_it);
+            }
+
+            head->m_registration = nullptr;
+            head->resume(details::epoll_awaitable::status::failed, ECANCELED);
+            head = next;
+        }
+    }
+}
+
+void epoll_executor::interrupt_waiters() noexcept {
+    m_deadlines.clear();
+
+    auto registrations = std::move(m_registrations);
+    for (auto& [fd, registration] : registrations) {
+        for (auto head : {registration.readers, registration.writers}) {
+            while (head != nullptr) {
+                const auto next = head->m_next;
+                head->resume(details::epoll_awaitable::status::interrupted);
+                head = next;
+            }
+        }
+    }
+}
+
+void epoll_executor::work_loop() {
+    m_tasks.run([this] {
+        wait_for_events(wait_timeout());
+        expire_deadlines();
+    });
+
+    interrupt_waiters();
+}
+
+void epoll_executor::enqueue(concurrencpp::task task) {
+    enqueue(std::span<concurrencpp::task>(&task, 1));
+}
+
+void epoll_executor::enqueue(std::span<concurrencpp::task> tasks) {
+    if (m_tasks.enqueue(tasks)) {
+        wake_loop();
+    }
+}
+
+int epoll_executor::max_concurrency_level() const noexcept {
+    return details::consts::k_epoll_executor_max_concurrency_level;
+}
+
+bool epoll_executor::shutdown_requested() const {
+    return m_atomic_abort.load(std::memory_order_relaxed);
+}
+
+void epoll_executor::shutdown() {
+    const auto abort = m_atomic_abort.exchange(true, std::memory_order_relaxed);
+    if (abort) {
+        return;  // shutdown had been called before.
+    }
+
+    m_tasks.abort();
+    wake_loop();
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    m_tasks.clear();
+}
+
+epoll_awaitable epoll_executor::readable(int fd) {
+    return {*this, fd, false, std::nullopt};
+}
+
+epoll_awaitable epoll_executor::readable(int fd, std::chrono::milliseconds timeout) {
+    return {*this, fd, false, details::epoll_awaitable::clock_type::now() + timeout};
+}
+
+epoll_awaitable epoll_executor::writable(int fd) {
+    return {*this, fd, true, std::nullopt};
+}
+
+epoll_awaitable epoll_executor::writable(int fd, std::chrono::milliseconds timeout) {
+    return {*this, fd, true, details::epoll_awaitable::clock_type::now() + timeout};
+}
+
+void epoll_executor::unregister(int fd) {
+    if (m_tasks.running_in_this_thread()) {
+        return unregister_impl(fd);
+    }
+
+    post([this, fd] {
+        unregister_impl(fd);
+    });
+}
@@ -0,0 +1,79 @@
+#include "concurrencpp/executors/impl/reactor_task_loop.h"
+
+using concurrencpp::details::reactor_task_loop;
+
+namespace concurrencpp::details {
+    namespace {
+        thread_local const reactor_task_loop* s_tl_this_loop = nullptr;
+    }  // namespace
+}  // namespace concurrencpp::details
+
+reactor_task_loop::reactor_task_loop(std::string_view executor_name) noexcept :
+    m_private_atomic_abort(false), m_has_public_work(false), m_abort(false), m_executor_name(executor_name) {}
+
+void reactor_task_loop::bind_to_this_thread() noexcept {
+    details::s_tl_this_loop = this;
+}
+
+void reactor_task_loop::run_tasks() {
+    while (!m_private_queue.empty()) {
+        auto task = std::move(m_private_queue.front());
+        m_private_queue.pop_front();
+
+        if (m_private_atomic_abort.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        task();
+    }
+}
+
+bool reactor_task_loop::running_in_this_thread() const noexcept {
+    return details::s_tl_this_loop == this;
+}
+
+bool reactor_task_loop::abort_requested() const noexcept {
+    return m_private_atomic_abort.load(std::memory_order_relaxed);
+}
+
+bool reactor_task_loop::has_private_tasks() const noexcept {
+    return !m_private_queue.empty();
+}
+
+bool reactor_task_loop::enqueue(std::span<concurrencpp::task> tasks) {
+    if (running_in_this_thread()) {
+        if (abort_requested()) {
+            details::throw_runtime_shutdown_exception(m_executor_name);
+        }
+
+        m_private_queue.insert(m_private_queue.end(), std::make_move_iterator(tasks.begin()), std::make_move_iterator(tasks.end()));
+        return false;
+    }
+
+    return publish([this, tasks] {
+        m_public_queue.insert(m_public_queue.end(), std::make_move_iterator(tasks.begin()), std::make_move_iterator(tasks.end()));
+    });
+}
+
+void reactor_task_loop::abort() {
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_abort = true;
+    }
+
+    m_private_atomic_abort.store(true, std::memory_order_relaxed);
+}
+
+void reactor_task_loop::clear() {
+    decltype(m_private_queue) private_queue;
+    decltype(m_public_queue) public_queue;
+
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        private_queue = std::move(m_private_queue);
+        public_queue = std::move(m_public_queue);
+    }
+
+    private_queue.clear();
+    public_queue.clear();
+}
@@ -0,0 +1,625 @@
+#include "concurrencpp/executors/io_uring_executor.h"
+
+#include "concurrencpp/errors.h"
+#include "concurrencpp/results/constants.h"
+#include "concurrencpp/executors/constants.h"
+#include "concurrencpp/results/impl/consumer_context.h"
+
+#include <atomic>
+#include <cerrno>
+#include <limits>
+#include <algorithm>
+#include <system_error>
+
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+
+using concurrencpp::io_uring_executor;
+using concurrencpp::details::io_uring_ring;
+using concurrencpp::details::io_uring_operation;
+
+namespace concurrencpp::details {
+    namespace {
+        // user_data values that can't be the address of an operation
+        constexpr uint64_t k_wake_user_data = 0;
+        constexpr uint64_t k_cancel_user_data = 1;
+
+        [[noreturn]] void throw_system_error(int error_code, const char* what) {
+            throw std::system_error(error_code, std::system_category(), what);
+        }
+
+        int make_wake_fd() {
+            const auto fd = ::eventfd(0, EFD_CLOEXEC);
+            if (fd == -1) {
+                throw_system_error(errno, "concurrencpp::io_uring_executor - eventfd() failed.");
+            }
+
+            return fd;
+        }
+
+        template<class type>
+        type* offset_pointer(void* base, uint32_t offset) noexcept {
+            return reinterpret_cast<type*>(static_cast<char*>(base) + offset);
+        }
+    }  // namespace
+
+    /*
+     *  The io_uring instance, set up with raw system calls so no liburing is needed.
+     *  Only the executor thread touches the rings.
+     */
+    class io_uring_ring {
+
+       private:
+        int m_fd = -1;
+        void* m_sq_ring = MAP_FAILED;
+        size_t m_sq_ring_size = 0;
+        void* m_cq_ring = MAP_FAILED;
+        size_t m_cq_ring_size = 0;
+        io_uring_sqe* m_sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+        size_t m_sqes_size = 0;
+
+        unsigned* m_sq_head = nullptr;
+        unsigned* m_sq_tail = nullptr;
+        unsigned m_sq_mask = 0;
+        unsigned m_sq_entries = 0;
+
+        unsigned* m_cq_head = nullptr;
+        unsigned* m_cq_tail = nullptr;
+        unsigned m_cq_mask = 0;
+        io_uring_cqe* m_cqes = nullptr;
+
+        unsigned m_sqe_tail = 0;  // prepared entries, published on enter
+
+        void* map(size_t size, uint64_t offset) {
+            const auto address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, static_cast<off_t>(offset));
+            if (address == MAP_FAILED) {
+                throw_system_error(errno, "concurrencpp::io_uring_executor - mmap() failed.");
+            }
+
+            return address;
+        }
+
+        void release() noexcept {
+            if (m_sqes != MAP_FAILED) {
+                ::munmap(m_sqes, m_sqes_size);
+            }
+
+            if (m_cq_ring != MAP_FAILED && m_cq_ring != m_sq_ring) {
+                ::munmap(m_cq_ring, m_cq_ring_size);
+            }
+
+            if (m_sq_ring != MAP_FAILED) {
+                ::munmap(m_sq_ring, m_sq_ring_size);
+            }
+
+            if (m_fd != -1) {
+                ::close(m_fd);
+            }
+        }
+
+       public:
+        explicit io_uring_ring(unsigned entries) {
+            io_uring_params params {};
+            m_fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+            if (m_fd < 0) {
+                m_fd = -1;
+                throw_system_error(errno, "concurrencpp::io_uring_executor - io_uring_setup() failed.");
+            }
+
+            try {
+                m_sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+                m_cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+                if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0) {
+                    m_sq_ring_size = m_cq_ring_size = std::max(m_sq_ring_size, m_cq_ring_size);
+                }
+
+                m_sq_ring = map(m_sq_ring_size, IORING_OFF_SQ_RING);
+                m_cq_ring = ((params.features & IORING_FEAT_SINGLE_MMAP) != 0) ? m_sq_ring : map(m_cq_ring_size, IORING_OFF_CQ_RING);
+
+                m_sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+                m_sqes = static_cast<io_uring_sqe*>(map(m_sqes_size, IORING_OFF_SQES));
+            } catch (...) {
+                release();
+                throw;
+            }
+
+            m_sq_head = offset_pointer<unsigned>(m_sq_ring, params.sq_off.head);
+            m_sq_tail = offset_pointer<unsigned>(m_sq_ring, params.sq_off.tail);
+            m_sq_mask = *offset_pointer<unsigned>(m_sq_ring, params.sq_off.ring_mask);
+            m_sq_entries = *offset_pointer<unsigned>(m_sq_ring, params.sq_off.ring_entries);
+
+            // submission entries are used in ring order, so the indirection array is the identity
+            const auto sq_array = offset_pointer<unsigned>(m_sq_ring, params.sq_off.array);
+            for (unsigned i = 0; i < m_sq_entries; i++) {
+                sq_array[i] = i;
+            }
+
+            m_cq_head = offset_pointer<unsigned>(m_cq_ring, params.cq_off.head);
+            m_cq_tail = offset_pointer<unsigned>(m_cq_ring, params.cq_off.tail);
+            m_cq_mask = *offset_pointer<unsigned>(m_cq_ring, params.cq_off.ring_mask);
+            m_cqes = offset_pointer<io_uring_cqe>(m_cq_ring, params.cq_off.cqes);
+
+            m_sqe_tail = *m_sq_tail;
+        }
+
+        ~io_uring_ring() noexcept {
+            release();
+        }
+
+        io_uring_sqe* next_sqe() noexcept {
+            const auto head = std::atomic_ref<unsigned>(*m_sq_head).load(std::memory_order_acquire);
+            if (m_sqe_tail - head == m_sq_entries) {
+                return nullptr;
+            }
+
+            auto& sqe = m_sqes[m_sqe_tail & m_sq_mask];
+            ++m_sqe_tail;
+
+            sqe = {};
+            return &sqe;
+        }
+
+        // submits every prepared entry with one system call, and waits for a completion if wait is true
+        void enter(bool wait) {
+            std::atomic_ref<unsigned>(*m_sq_tail).store(m_sqe_tail, std::memory_order_release);
+
+            const auto head = std::atomic_ref<unsigned>(*m_sq_head).load(std::memory_order_acquire);
+            const auto to_submit = m_sqe_tail - head;
+            if (to_submit == 0 && !wait) {
+                return;
+            }
+
+            const auto flags = wait ? IORING_ENTER_GETEVENTS : 0U;
+            const auto result = ::syscall(__NR_io_uring_enter, m_fd, to_submit, wait ? 1U : 0U, flags, nullptr, 0);
+            if (result >= 0) {
+                return;
+            }
+
+            // EBUSY/EAGAIN: the completion ring is full, the caller reaps it and tries again
+            if (errno == EINTR || errno == EBUSY || errno == EAGAIN) {
+                return;
+            }
+
+            throw_system_error(errno, "concurrencpp::io_uring_executor - io_uring_enter() failed.");
+        }
+
+        template<class callback_type>
+        void reap(callback_type&& callback) {
+            auto head = *m_cq_head;
+            const auto tail = std::atomic_ref<unsigned>(*m_cq_tail).load(std::memory_order_acquire);
+
+            while (head != tail) {
+                const auto cqe = m_cqes[head & m_cq_mask];
+                ++head;
+                std::atomic_ref<unsigned>(*m_cq_head).store(head, std::memory_order_release);
+
+                callback(cqe.user_data, cqe.res);
+            }
+        }
+    };
+}  // namespace concurrencpp::details
+
+/*
+    io_uring_operation
+*/
+
+io_uring_operation::io_uring_operation(io_uring_executor& executor,
+                                       std::shared_ptr<concurrencpp::executor> resume_executor,
+                                       const char* operation_name,
+                                       uint8_t opcode,
+                                       int fd) noexcept :
+    m_executor(executor),
+    m_resume_executor(std::move(resume_executor)), m_operation_name(operation_name) {
+    m_sqe.opcode = opcode;
+    m_sqe.fd = fd;
+}
+
+io_uring_operation::io_uring_operation(io_uring_operation&& rhs) noexcept :
+    m_executor(rhs.m_executor), m_resume_executor(rhs.m_resume_executor), m_operation_name(rhs.m_operation_name), m_sqe(rhs.m_sqe),
+    m_timeout(rhs.m_timeout) {
+    assert(!static_cast<bool>(rhs.m_caller_handle));
+}
+
+void io_uring_operation::submit(coroutine_handle<void> caller_handle) {
+    m_caller_handle = caller_handle;
+
+    if (m_sqe.opcode == IORING_OP_TIMEOUT) {
+        m_sqe.addr = reinterpret_cast<uint64_t>(&m_timeout);
+    }
+
+    m_executor.enqueue_operation(*this);
+}
+
+void io_uring_operation::complete(int result) noexcept {
+    m_result = result;
+
+    if (m_resume_executor.get() == &m_executor) {
+        return m_caller_handle.resume();
+    }
+
+    try {
+        m_resume_executor->post(await_via_functor {m_caller_handle, &m_interrupted});
+    } catch (...) {
+        // do nothing. ~await_via_functor will resume the coroutine and throw an exception.
+    }
+}
+
+void io_uring_operation::interrupt() noexcept {
+    m_interrupted = true;
+    m_caller_handle.resume();
+}
+
+void io_uring_operation::throw_if_interrupted() const {
+    if (m_interrupted) {
+        throw errors::broken_task(consts::k_broken_task_exception_error_msg);
+    }
+}
+
+void io_uring_operation::throw_if_failed() const {
+    if (m_result >= 0) {
+        return;
+    }
+
+    if (m_sqe.opcode == IORING_OP_TIMEOUT && m_result == -ETIME) {
+        return;  // the timeout expired, which is what was asked for
+    }
+
+    throw_system_error(-m_result, m_operation_name);
+}
+
+/*
+    io_uring_executor
+*/
+
+io_uring_executor::io_uring_executor(size_t ring_entries,
+                                     const std::function<void(std::string_view thread_name)>& thread_started_callback,
+                                     const std::function<void(std::string_view thread_name)>& thread_terminated_callback) :
+    derivable_executor<concurrencpp::io_uring_executor>(details::consts::k_io_uring_executor_name),
+    m_ring(std::make_unique<details::io_uring_ring>(static_cast<unsigned>(ring_entries))), m_in_flight_operations(nullptr),
+    m_in_flight_count(0), m_wake_armed(false), m_wake_buffer(0), m_tasks(name), m_wake_fd(details::make_wake_fd()),
+    m_atomic_abort(false) {
+    m_thread = details::thread(
+        details::make_executor_worker_name(name),
+        [this] {
+            work_loop();
+        },
+        thread_started_callback,
+        thread_terminated_callback);
+}
+
+io_uring_executor::~io_uring_executor() noexcept {
+    shutdown();
+    ::close(m_wake_fd);
+}
+
+void io_uring_executor::wake_loop() const noexcept {
+    const uint64_t value = 1;
+    [[maybe_unused]] const auto written = ::write(m_wake_fd, &value, sizeof(value));
+}
+
+void io_uring_executor::add_in_flight(details::io_uring_operation& operation) noexcept {
+    operation.m_prev = nullptr;
+    operation.next = m_in_flight_operations;
+
+    if (m_in_flight_operations != nullptr) {
+        m_in_flight_operations->m_prev = &operation;
+    }
+
+    m_in_flight_operations = &operation;
+    ++m_in_flight_count;
+}
+
+void io_uring_executor::remove_in_flight(details::io_uring_operation& operation) noexcept {
+    if (operation.m_prev != nullptr) {
+        operation.m_prev->next = operation.next;
+    } else {
+        assert(m_in_flight_operations == &operation);
+        m_in_flight_operations = operation.next;
+    }
+
+    if (operation.next != nullptr) {
+        operation.next->m_prev = operation.m_prev;
+    }
+
+    operation.next = nullptr;
+    operation.m_prev = nullptr;
+
+    assert(m_in_flight_count != 0);
+    --m_in_flight_count;
+}
+
+void io_uring_executor::enqueue_operation(details::io_uring_operation& operation) {
+    if (m_tasks.running_in_this_thread()) {
+        if (m_tasks.abort_requested()) {
+            details::throw_runtime_shutdown_exception(name);
+        }
+
+        return m_private_operations.push_back(operation);
+    }
+
+    const auto wake = m_tasks.publish([this, &operation] {
+        m_public_operations.push_back(operation);
+    });
+
+    if (wake) {
+        wake_loop();
+    }
+}
+
+void io_uring_executor::take_public_operations() noexcept {
+    while (auto operation = m_public_operations.pop_front()) {
+        operation->next = nullptr;
+        m_private_operations.push_back(*operation);
+    }
+}
+
+void io_uring_executor::prepare_submissions() {
+    if (!m_wake_armed) {
+        auto sqe = m_ring->next_sqe();
+        if (sqe == nullptr) {
+            m_ring->enter(false);
+            sqe = m_ring->next_sqe();
+        }
+
+        if (sqe != nullptr) {
+            sqe->opcode = IORING_OP_READ;
+            sqe->fd = m_wake_fd;
+            sqe->addr = reinterpret_cast<uint64_t>(&m_wake_buffer);
+            sqe->len = sizeof(m_wake_buffer);
+            sqe->user_data = details::k_wake_user_data;
+            m_wake_armed = true;
+        }
+    }
+
+    while (!m_private_operations.empty()) {
+        auto sqe = m_ring->next_sqe();
+        if (sqe == nullptr) {
+            m_ring->enter(false);  // the submission ring is full, flush it
+
+            sqe = m_ring->next_sqe();
+            if (sqe == nullptr) {
+                return;  // the rest will be submitted on the next iteration
+            }
+        }
+
+        auto operation = m_private_operations.pop_front();
+        operation->next = nullptr;
+
+        *sqe = operation->m_sqe;
+        sqe->user_data = reinterpret_cast<uint64_t>(operation);
+        add_in_flight(*operation);
+    }
+}
+
+void io_uring_executor::reap_completions() {
+    m_ring->reap([this](uint64_t user_data, int result) {
+        if (user_data == details::k_wake_user_data) {
+            m_wake_armed = false;
+            return;
+        }
+
+        if (user_data == details::k_cancel_user_data) {
+            return;
+        }
+
+        auto& operation = *reinterpret_cast<details::io_uring_operation*>(user_data);
+        remove_in_flight(operation);
+
+        if (m_tasks.abort_requested()) {
+            return operation.interrupt();
+        }
+
+        operation.complete(result);
+    });
+}
+
+void io_uring_executor::cancel_in_flight_operations() {
+    for (auto operation = m_in_flight_operations; operation != nullptr; operation = operation->next) {
+        auto sqe = m_ring->next_sqe();
+        while (sqe == nullptr) {
+            m_ring->enter(false);
+            sqe = m_ring->next_sqe();
+        }
+
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->fd = -1;
+        sqe->addr = reinterpret_cast<uint64_t>(operation);
+        sqe->user_data = details::k_cancel_user_data;
+    }
+}
+
+void io_uring_executor::work_loop() {
+    m_tasks.run(
+        [this] {
+            // the tasks might have started new operations
+            prepare_submissions();
+
+            // without an armed eventfd read, nothing would wake a blocking wait when tasks are enqueued from other threads
+            const auto idle = m_wake_armed && !m_tasks.has_private_tasks() && m_private_operations.empty();
+            m_ring->enter(idle);
+            reap_completions();
+        },
+        [this] {
+            take_public_operations();
+        });
+
+    /*
+        Shutdown: operations that were never submitted are interrupted right away,
+        submitted ones are cancelled and interrupted once the kernel lets go of them.
+        The last take_public_operations call already moved the published ones to the private list.
+    */
+    while (auto operation = m_private_operations.pop_front()) {
+        operation->next = nullptr;
+        operation->interrupt();
+    }
+
+    cancel_in_flight_operations();
+
+    while (m_in_flight_count != 0 || m_wake_armed) {
+        if (m_wake_armed) {
+            wake_loop();
+        }
+
+        m_ring->enter(true);
+        reap_completions();
+    }
+}
+
+void io_uring_executor::enqueue(concurrencpp::task task) {
+    enqueue(std::span<concurrencpp::task>(&task, 1));
+}
+
+void io_uring_executor::enqueue(std::span<concurrencpp::task> tasks) {
+    if (m_tasks.enqueue(tasks)) {
+        wake_loop();
+    }
+}
+
+int io_uring_executor::max_concurrency_level() const noexcept {
+    return details::consts::k_io_uring_executor_max_concurrency_level;
+}
+
+bool io_uring_executor::shutdown_requested() const {
+    return m_atomic_abort.load(std::memory_order_relaxed);
+}
+
+void io_uring_executor::shutdown() {
+    const auto abort = m_atomic_abort.exchange(true, std::memory_order_relaxed);
+    if (abort) {
+        return;  // shutdown had been called before.
+    }
+
+    m_tasks.abort();
+    wake_loop();
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    m_tasks.clear();
+}
+
+/*
+    operations
+*/
+
+namespace concurrencpp::details {
+    namespace {
+        // sqe lengths are 32 bits. a longer buffer is clamped, which is a valid short read or write
+        uint32_t clamp_length(size_t length) noexcept {
+            return static_cast<uint32_t>(std::min<size_t>(length, std::numeric_limits<uint32_t>::max()));
+        }
+
+        template<class type>
+        io_uring_awaitable<type> make_operation(io_uring_executor& executor,
+                                                std::shared_ptr<concurrencpp::executor> resume_executor,
+                                                const char* operation_name,
+                                                uint8_t opcode,
+                                                int fd) {
+            if (!static_cast<bool>(resume_executor)) {
+                throw std::invalid_argument(consts::k_io_uring_executor_null_resume_executor_err_msg);
+            }
+
+            return {executor, std::move(resume_executor), operation_name, opcode, fd};
+        }
+    }  // namespace
+}  // namespace concurrencpp::details
+
+concurrencpp::details::io_uring_awaitable<size_t> io_uring_executor::read(std::shared_ptr<executor> resume_executor,
+                                                                          int fd,
+                                                                          std::span<std::byte> buffer,
+                                                                          uint64_t offset) {
+    auto operation =
+        details::make_operation<size_t>(*this, std::move(resume_executor), "concurrencpp::io_uring_executor::read()", IORING_OP_READ, fd);
+    operation.m_sqe.addr = reinterpret_cast<uint64_t>(buffer.data());
+    operation.m_sqe.len = details::clamp_length(buffer.size());
+    operation.m_sqe.off = offset;
+    return operation;
+}
+
+concurrencpp::details::io_uring_awaitable<size_t> io_uring_executor::write(std::shared_ptr<executor> resume_executor,
+                                                                           int fd,
+                                                                           std::span<const std::byte> buffer,
+                                                                           uint64_t offset) {
+    auto operation =
+        details::make_operation<size_t>(*this, std::move(resume_executor), "concurrencpp::io_uring_executor::write()", IORING_OP_WRITE, fd);
+    operation.m_sqe.addr = reinterpret_cast<uint64_t>(buffer.data());
+    operation.m_sqe.len = details::clamp_length(buffer.size());
+    operation.m_sqe.off = offset;
+    return operation;
+}
+
+concurrencpp::details::io_uring_awaitable<size_t> io_uring_executor::readv(std::shared_ptr<executor> resume_executor,
+                                                                           int fd,
+                                                                           std::span<const iovec> buffers,
+                                                                           uint64_t offset) {
+    auto operation =
+        details::make_operation<size_t>(*this, std::move(resume_executor), "concurrencpp::io_uring_executor::readv()", IORING_OP_READV, fd);
+    operation.m_sqe.addr = reinterpret_cast<uint64_t>(buffers.data());
+    operation.m_sqe.len = static_cast<uint32_t>(buffers.size());
+    operation.m_sqe.off = offset;
+    return operation;
+}
+
+concurrencpp::details::io_uring_awaitable<void> io_uring_executor::fsync(std::shared_ptr<executor> resume_executor, int fd) {
+    return details::make_operation<void>(*this, std::move(resume_executor), "concurrencpp::io_uring_executor::fsync()", IORING_OP_FSYNC, fd);
+}
+
+concurrencpp::details::io_uring_awaitable<int> io_uring_executor::openat(std::shared_ptr<executor> resume_executor,
+                                                                         int dir_fd,
+                                                                         const char* path,
+                                                                         int flags,
+                                                                         mode_t mode) {
+    auto operation =
+        details::make_operation<int>(*this, std::move(resume_executor), "concurrencpp::io_uring_executor::openat()", IORING_OP_OPENAT, dir_fd);
+    operation.m_sqe.addr = reinterpret_cast<uint64_t>(path);
+    operation.m_sqe.len = mode;
+    operation.m_sqe.open_flags = static_cast<uint32_t>(flags);
+    return operation;
+}
+
+concurrencpp::details::io_uring_awaitable<int> io_uring_executor::accept(std::shared_ptr<executor> resume_executor, int fd, int flags) {
+    auto operation =
+        details::make_operation<int>(*this, std::move(resume_executor), "concurrencpp::io_uring_executor::accept()", IORING_OP_ACCEPT, fd);
+    operation.m_sqe.accept_flags = static_cast<uint32_t>(flags);
+    return operation;
+}
+
+concurrencpp::details::io_uring_awaitable<size_t> io_uring_executor::recv(std::shared_ptr<executor> resume_executor,
+                                                                          int fd,
+                                                                          std::span<std::byte> buffer,
+                                                                          int flags) {
+    auto operation =
+        details::make_operation<size_t>(*this, std::move(resume_executor), "concurrencpp::io_uring_executor::recv()", IORING_OP_RECV, fd);
+    operation.m_sqe.addr = reinterpret_cast<uint64_t>(buffer.data());
+    operation.m_sqe.len = details::clamp_length(buffer.size());
+    operation.m_sqe.msg_flags = static_cast<uint32_t>(flags);
+    return operation;
+}
+
+concurrencpp::details::io_uring_awaitable<size_t> io_uring_executor::send(std::shared_ptr<executor> resume_executor,
+                                                                          int fd,
+                                                                          std::span<const std::byte> buffer,
+                                                                          int flags) {
+    auto operation =
+        details::make_operation<size_t>(*this, std::move(resume_executor), "concurrencpp::io_uring_executor::send()", IORING_OP_SEND, fd);
+    operation.m_sqe.addr = reinterpret_cast<uint64_t>(buffer.data());
+    operation.m_sqe.len = details::clamp_length(buffer.size());
+    operation.m_sqe.msg_flags = static_cast<uint32_t>(flags);
+    return operation;
+}
+
+concurrencpp::details::io_uring_awaitable<void> io_uring_executor::timeout(std::shared_ptr<executor> resume_executor,
+                                                                           std::chrono::nanoseconds duration) {
+    auto operation =
+        details::make_operation<void>(*this, std::move(resume_executor), "concurrencpp::io_uring_executor::timeout()", IORING_OP_TIMEOUT, -1);
+
+    const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(duration);
+    operation.m_timeout.tv_sec = seconds.count();
+    operation.m_timeout.tv_nsec = (duration - seconds).count();
+    operation.m_sqe.len = 1;  // the addr field is set on submission, once the operation has its final address
+    return operation;
+}
@@ -1,12 +1,52 @@
 #include "concurrencpp/executors/constants.h"
 #include "concurrencpp/executors/manual_executor.h"
 
+#if defined(CRCPP_HAS_EVENTFD)
+#    include <cerrno>
+#    include <system_error>
+
+#    include <unistd.h>
+#    include <sys/eventfd.h>
+#endif
+
 using concurrencpp::manual_executor;
 
 manual_executor::manual_executor() :
     derivable_executor<concurrencpp::manual_executor>(details::consts::k_manual_executor_name), m_abort(false), m_atomic_abort(false) {
 }
 
+manual_executor::~manual_executor() noexcept {
+#if defined(CRCPP_HAS_EVENTFD)
+    if (m_event_fd != -1) {
+        ::close(m_event_fd);
+    }
+#endif
+}
+
+void manual_executor::signal_event_fd() noexcept {
+#if defined(CRCPP_HAS_EVENTFD)
+    if (m_event_fd == -1 || m_event_fd_signaled) {
+        return;
+    }
+
+    const uint64_t value = 1;
+    [[maybe_unused]] const auto res = ::write(m_event_fd, &value, sizeof(value));
+    m_event_fd_signaled = true;
+#endif
+}
+
+void manual_executor::reset_event_fd() noexcept {
+#if defined(CRCPP_HAS_EVENTFD)
+    if (!m_event_fd_signaled || m_abort) {
+        return;
+    }
+
+    uint64_t value;
+    [[maybe_unused]] const auto res = ::read(m_event_fd, &value, sizeof(value));
+    m_event_fd_signaled = false;
+#endif
+}
+
 void manual_executor::enqueue(concurrencpp::task task) {
     std::unique_lock<decltype(m_lock)> lock(m_lock);
     if (m_abort) {
@@ -14,6 +54,7 @@ void manual_executor::enqueue(concurrencpp::task task) {
     }
 
     m_tasks.emplace_back(std::move(task));
+    signal_event_fd();
     lock.unlock();
 
     m_condition.notify_all();
@@ -26,6 +67,10 @@ void manual_executor::enqueue(std::span<concurrencpp::task> tasks) {
     }
 
     m_tasks.insert(m_tasks.end(), std::make_move_iterator(tasks.begin()), std::make_move_iterator(tasks.end()));
+    if (!m_tasks.empty()) {
+        signal_event_fd();
+    }
+
     lock.unlock();
 
     m_condition.notify_all();
@@ -44,35 +89,87 @@ bool manual_executor::empty() const {
     return size() == 0;
 }
 
-size_t manual_executor::loop_impl(size_t max_count) {
-    if (max_count == 0) {
-        return 0;
+void manual_executor::take_batch(std::deque<task>& batch, size_t max_count) {
+    assert(batch.empty());
+
+    if (max_count >= m_tasks.size()) {
+        std::swap(batch, m_tasks);
+    } else {
+        const auto end = m_tasks.begin() + static_cast<std::ptrdiff_t>(max_count);
+        batch.insert(batch.end(), std::make_move_iterator(m_tasks.begin()), std::make_move_iterator(end));
+        m_tasks.erase(m_tasks.begin(), end);
+    }
+
+    if (m_tasks.empty()) {
+        reset_event_fd();
+    }
+}
+
+void manual_executor::return_batch(std::deque<task>& batch) {
+    std::unique_lock<decltype(m_lock)> lock(m_lock);
+    if (!m_abort && !batch.empty()) {
+        m_tasks.insert(m_tasks.begin(), std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+        signal_event_fd();
     }
 
+    lock.unlock();
+    batch.clear();  // if shutdown was called, the tasks are destroyed like the queued ones
+}
+
+template<class clock_type>
+size_t manual_executor::run_batch(std::deque<task>& batch, std::chrono::time_point<clock_type> deadline) {
+    const auto has_deadline = deadline != std::chrono::time_point<clock_type>::max();
     size_t executed = 0;
 
-    while (true) {
-        if (executed == max_count) {
+    while (!batch.empty()) {
+        if (shutdown_requested()) {
+            batch.clear();  // shutdown destroys the tasks that were not executed, as it does with the queued ones
             break;
         }
 
-        std::unique_lock<decltype(m_lock)> lock(m_lock);
-        if (m_abort) {
+        if (has_deadline && clock_type::now() >= deadline) {
+            return_batch(batch);
             break;
         }
 
-        if (m_tasks.empty()) {
-            break;
-        }
+        auto task = std::move(batch.front());
+        batch.pop_front();
 
-        auto task = std::move(m_tasks.front());
-        m_tasks.pop_front();
-        lock.unlock();
+        try {
+            task();
+        } catch (...) {
+            return_batch(batch);  // the rest of the batch goes back to the front of the queue, in order
+            throw;
+        }
 
-        task();
         ++executed;
     }
 
+    return executed;
+}
+
+size_t manual_executor::loop_impl(size_t max_count) {
+    if (max_count == 0) {
+        return 0;
+    }
+
+    size_t executed = 0;
+    std::deque<task> batch;
+
+    // tasks are dequeued in batches, so the lock is taken once per batch instead of once per task
+    while (executed != max_count) {
+        {
+            std::unique_lock<decltype(m_lock)> lock(m_lock);
+            if (m_abort || m_tasks.empty()) {
+                break;
+            }
+
+            take_batch(batch, max_count - executed);
+        }
+
+        executed += run_batch(batch, std::chrono::time_point<std::chrono::system_clock>::max());
+    }
+
     if (shutdown_requested()) {
         details::throw_runtime_shutdown_exception(name);
     }
@@ -86,6 +183,7 @@ size_t manual_executor::loop_until_impl(size_t max_count, std::chrono::time_poin
     }
 
     size_t executed = 0;
+    std::deque<task> batch;
     deadline += std::chrono::milliseconds(1);
 
     while (true) {
@@ -98,26 +196,25 @@ size_t manual_executor::loop_until_impl(size_t max_count, std::chrono::time_poin
             break;
         }
 
-        std::unique_lock<decltype(m_lock)> lock(m_lock);
-        const auto found_task = m_condition.wait_until(lock, deadline, [this] {
-            return !m_tasks.empty() || m_abort;
-        });
+        {
+            std::unique_lock<decltype(m_lock)> lock(m_lock);
+            const auto found_task = m_condition.wait_until(lock, deadline, [this] {
+                return !m_tasks.empty() || m_abort;
+            });
 
-        if (m_abort) {
-            break;
-        }
+            if (m_abort) {
+                break;
+            }
 
-        if (!found_task) {
-            break;
-        }
+            if (!found_task) {
+                break;
+            }
 
-        assert(!m_tasks.empty());
-        auto task = std::move(m_tasks.front());
-        m_tasks.pop_front();
-        lock.unlock();
+            assert(!m_tasks.empty());
+            take_batch(batch, max_count - executed);
+        }
 
-        task();
-        ++executed;
+        executed += run_batch(batch, deadline);
     }
 
     if (shutdown_requested()) {
@@ -190,6 +287,34 @@ size_t manual_executor::loop_for(size_t max_count, std::chrono::milliseconds max
     return loop_until_impl(max_count, time_point_from_now(max_waiting_time));
 }
 
+size_t manual_executor::loop_for_duration(std::chrono::nanoseconds max_duration) {
+    // a frame budget must not stretch or shrink when the wall clock is adjusted
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(max_duration);
+    size_t executed = 0;
+    std::deque<task> batch;
+
+    // whatever is queued is taken at once, tasks that don't fit in the time budget are put back
+    while (std::chrono::steady_clock::now() < deadline) {
+        {
+            std::unique_lock<decltype(m_lock)> lock(m_lock);
+            if (m_abort || m_tasks.empty()) {
+                break;
+            }
+
+            take_batch(batch, m_tasks.size());
+        }
+
+        executed += run_batch(batch, deadline);
+    }
+
+    if (shutdown_requested()) {
+        details::throw_runtime_shutdown_exception(name);
+    }
+
+    return executed;
+}
+
 size_t manual_executor::clear() {
     std::unique_lock<decltype(m_lock)> lock(m_lock);
     if (m_abort) {
@@ -197,10 +322,36 @@ size_t manual_executor::clear() {
     }
 
     const auto tasks = std::move(m_tasks);
+    m_tasks.clear();
+    reset_event_fd();
     lock.unlock();
     return tasks.size();
 }
 
+#if defined(CRCPP_HAS_EVENTFD)
+int manual_executor::event_fd() {
+    std::unique_lock<decltype(m_lock)> lock(m_lock);
+    if (m_abort) {
+        details::throw_runtime_shutdown_exception(name);
+    }
+
+    if (m_event_fd != -1) {
+        return m_event_fd;
+    }
+
+    m_event_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_event_fd == -1) {
+        throw std::system_error(errno, std::system_category(), "concurrencpp::manual_executor::event_fd() - eventfd() failed.");
+    }
+
+    if (!m_tasks.empty()) {
+        signal_event_fd();
+    }
+
+    return m_event_fd;
+}
+#endif
+
 void manual_executor::wait_for_task() {
     wait_for_tasks_impl(1);
 }
@@ -227,8 +378,9 @@ void manual_executor::shutdown() {
 
     {
         std::unique_lock<decltype(m_lock)> lock(m_lock);
-        m_abort = true;
         tasks = std::move(m_tasks);
+        signal_event_fd();  // wakes up an external event loop, so it can observe the shutdown
+        m_abort = true;
     }
 
     m_condition.notify_all();
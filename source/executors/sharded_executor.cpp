@@ -0,0 +1,85 @@
+#include "concurrencpp/executors/constants.h"
+#include "concurrencpp/executors/sharded_executor.h"
+
+#include <stdexcept>
+
+using concurrencpp::sharded_executor;
+
+uint64_t concurrencpp::details::shard_hash_bytes(std::string_view bytes) noexcept {
+    // FNV-1a
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const auto c : bytes) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001b3ULL;
+    }
+
+    return shard_hash_mix(hash);
+}
+
+size_t concurrencpp::details::shard_index_of(uint64_t hash, size_t shard_count) noexcept {
+    // jump consistent hash (Lamping, Veach)
+    int64_t bucket = -1, next_bucket = 0;
+    while (next_bucket < static_cast<int64_t>(shard_count)) {
+        bucket = next_bucket;
+        hash = hash * 2862933555777941757ULL + 1;
+        next_bucket = static_cast<int64_t>(static_cast<double>(bucket + 1) *
+                                           (static_cast<double>(1LL << 31) / static_cast<double>((hash >> 33) + 1)));
+    }
+
+    return static_cast<size_t>(bucket);
+}
+
+sharded_executor::sharded_executor(size_t shard_count,
+                                   const std::function<void(std::string_view thread_name)>& thread_started_callback,
+                                   const std::function<void(std::string_view thread_name)>& thread_terminated_callback) :
+    m_shard_count(shard_count),
+    m_shards(std::make_unique<details::executor_shard[]>(shard_count)) {
+    if (shard_count == 0) {
+        throw std::invalid_argument(details::consts::k_sharded_executor_zero_shards_err_msg);
+    }
+
+    try {
+        for (size_t i = 0; i < m_shard_count; i++) {
+            m_shards[i].executor = std::make_shared<worker_thread_executor>(thread_started_callback, thread_terminated_callback);
+        }
+    } catch (...) {
+        shutdown();
+        throw;
+    }
+}
+
+sharded_executor::~sharded_executor() noexcept {
+    // queued tasks point to the queue depth counters of this object, so they must be destroyed before it is
+    shutdown();
+}
+
+concurrencpp::details::executor_shard& sharded_executor::shard_of(uint64_t hash) const noexcept {
+    return m_shards[details::shard_index_of(hash, m_shard_count)];
+}
+
+size_t sharded_executor::shard_count() const noexcept {
+    return m_shard_count;
+}
+
+std::vector<size_t> sharded_executor::queue_depths() const {
+    std::vector<size_t> depths;
+    depths.reserve(m_shard_count);
+
+    for (size_t i = 0; i < m_shard_count; i++) {
+        depths.emplace_back(m_shards[i].queue_depth.load(std::memory_order_relaxed));
+    }
+
+    return depths;
+}
+
+bool sharded_executor::shutdown_requested() const {
+    return m_shards[0].executor->shutdown_requested();
+}
+
+void sharded_executor::shutdown() {
+    for (size_t i = 0; i < m_shard_count; i++) {
+        if (static_cast<bool>(m_shards[i].executor)) {
+            m_shards[i].executor->shutdown();
+        }
+    }
+}
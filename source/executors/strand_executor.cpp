@@ -0,0 +1,261 @@
+#include "concurrencpp/executors/constants.h"
+#include "concurrencpp/executors/strand_executor.h"
+
+#include <atomic>
+#include <utility>
+#include <stdexcept>
+
+using concurrencpp::strand_executor;
+using concurrencpp::details::strand_state;
+
+namespace concurrencpp::details {
+    /*
+     *  An intrusive multi-producer single-consumer queue (Vyukov).
+     *  Producers only exchange the tail, the single consumer owns the head, which always points to an already consumed node.
+     */
+    class strand_task_queue {
+
+       private:
+        struct node {
+            std::atomic<node*> next {nullptr};
+            concurrencpp::task task;
+        };
+
+        alignas(CRCPP_CACHE_LINE_ALIGNMENT) std::atomic<node*> m_tail;
+        alignas(CRCPP_CACHE_LINE_ALIGNMENT) node* m_head;
+
+        void link(node* first, node* last) noexcept {
+            // seq_cst: pairs with the scheduled flag, see strand_state::finish_drain
+            const auto prev = m_tail.exchange(last, std::memory_order_seq_cst);
+            prev->next.store(first, std::memory_order_release);
+        }
+
+       public:
+        strand_task_queue() : m_tail(new node()), m_head(m_tail.load(std::memory_order_relaxed)) {}
+
+        ~strand_task_queue() noexcept {
+            clear();
+            delete m_head;
+        }
+
+        void push(concurrencpp::task& task) {
+            const auto new_node = new node();
+            new_node->task = std::move(task);
+            link(new_node, new_node);
+        }
+
+        void push(std::span<concurrencpp::task> tasks) {
+            if (tasks.empty()) {
+                return;
+            }
+
+            node* first = nullptr;
+            node* last = nullptr;
+
+            try {
+                for (auto& task : tasks) {
+                    const auto new_node = new node();
+                    new_node->task = std::move(task);
+
+                    if (first == nullptr) {
+                        first = new_node;
+                    } else {
+                        last->next.store(new_node, std::memory_order_relaxed);
+                    }
+
+                    last = new_node;
+                }
+            } catch (...) {
+                while (first != nullptr) {
+                    delete std::exchange(first, first->next.load(std::memory_order_relaxed));
+                }
+
+                throw;
+            }
+
+            link(first, last);
+        }
+
+        // consumer only. might return false while a push is in progress, even though the queue is not empty
+        bool try_pop(concurrencpp::task& task) noexcept {
+            const auto next = m_head->next.load(std::memory_order_acquire);
+            if (next == nullptr) {
+                return false;
+            }
+
+            task = std::move(next->task);
+            delete std::exchange(m_head, next);
+            return true;
+        }
+
+        // consumer only. identifies how far the queue was consumed, see has_tasks_after
+        const void* consumed_position() const noexcept {
+            return m_head;
+        }
+
+        // callable by anyone. a push in progress counts as a task
+        bool has_tasks_after(const void* consumed_position) const noexcept {
+            return m_tail.load(std::memory_order_seq_cst) != consumed_position;
+        }
+
+        void clear() noexcept {
+            concurrencpp::task task;
+            while (try_pop(task)) {
+                task.clear();
+            }
+        }
+    };
+
+    struct strand_state : public std::enable_shared_from_this<strand_state> {
+        const std::shared_ptr<concurrencpp::executor> underlying_executor;
+        strand_task_queue queue;
+
+        // owned by whoever set it: a drain that is pending or running, or shutdown. only the owner consumes the queue
+        alignas(CRCPP_CACHE_LINE_ALIGNMENT) std::atomic_bool scheduled {false};
+        std::atomic_bool abort {false};
+
+        static thread_local const strand_state* s_tl_running_state;
+
+        explicit strand_state(std::shared_ptr<concurrencpp::executor> underlying_executor) noexcept :
+            underlying_executor(std::move(underlying_executor)) {}
+
+        void schedule();
+        void drain();
+        void finish_drain() noexcept;
+        void abandon() noexcept;
+    };
+
+    class strand_drain_functor {
+
+       private:
+        std::shared_ptr<strand_state> m_state;
+
+       public:
+        explicit strand_drain_functor(std::shared_ptr<strand_state> state) noexcept : m_state(std::move(state)) {}
+
+        strand_drain_functor(strand_drain_functor&& rhs) noexcept = default;
+
+        ~strand_drain_functor() noexcept {
+            if (static_cast<bool>(m_state)) {
+                // the underlying executor destroyed the drain without running it
+                m_state->abandon();
+            }
+        }
+
+        void operator()() {
+            const auto state = std::move(m_state);
+            state->drain();
+        }
+    };
+
+    thread_local const strand_state* strand_state::s_tl_running_state = nullptr;
+
+    void strand_state::schedule() {
+        if (!scheduled.exchange(true, std::memory_order_seq_cst)) {
+            underlying_executor->post(strand_drain_functor(shared_from_this()));
+        }
+    }
+
+    void strand_state::drain() {
+        struct drain_guard {
+            strand_state& state;
+            const strand_state* const prev_running_state;
+
+            ~drain_guard() noexcept {
+                s_tl_running_state = prev_running_state;
+                state.finish_drain();  // also when a task throws, so the strand doesn't get stuck
+            }
+        };
+
+        drain_guard guard {*this, std::exchange(s_tl_running_state, this)};
+        concurrencpp::task task;
+
+        for (size_t i = 0; i < consts::k_strand_executor_max_batch_size; i++) {
+            if (abort.load(std::memory_order_relaxed) || !queue.try_pop(task)) {
+                return;
+            }
+
+            task();
+            task.clear();
+        }
+    }
+
+    void strand_state::finish_drain() noexcept {
+        if (abort.load(std::memory_order_relaxed)) {
+            queue.clear();
+            return;  // the flag stays set, so no more drains are scheduled
+        }
+
+        // once the flag is cleared, another drain might consume the queue concurrently, so the head is read before that.
+        // seq_cst: either this thread sees a task that was pushed after the batch, or its producer sees the flag cleared
+        const auto consumed_position = queue.consumed_position();
+        scheduled.store(false, std::memory_order_seq_cst);
+        if (!queue.has_tasks_after(consumed_position) || scheduled.exchange(true, std::memory_order_seq_cst)) {
+            return;
+        }
+
+        try {
+            underlying_executor->post(strand_drain_functor(shared_from_this()));
+        } catch (...) {
+            // the functor was destroyed and abandoned the queue
+        }
+    }
+
+    void strand_state::abandon() noexcept {
+        queue.clear();
+        finish_drain();
+    }
+}  // namespace concurrencpp::details
+
+strand_executor::strand_executor(std::shared_ptr<executor> underlying_executor) :
+    derivable_executor<concurrencpp::strand_executor>(details::consts::k_strand_executor_name),
+    m_state(std::make_shared<details::strand_state>(std::move(underlying_executor))) {
+    if (!static_cast<bool>(m_state->underlying_executor)) {
+        throw std::invalid_argument(details::consts::k_strand_executor_null_executor_err_msg);
+    }
+}
+
+void strand_executor::enqueue(concurrencpp::task task) {
+    if (m_state->abort.load(std::memory_order_relaxed)) {
+        details::throw_runtime_shutdown_exception(name);
+    }
+
+    m_state->queue.push(task);
+    m_state->schedule();
+}
+
+void strand_executor::enqueue(std::span<concurrencpp::task> tasks) {
+    if (m_state->abort.load(std::memory_order_relaxed)) {
+        details::throw_runtime_shutdown_exception(name);
+    }
+
+    m_state->queue.push(tasks);
+    m_state->schedule();
+}
+
+int strand_executor::max_concurrency_level() const noexcept {
+    return details::consts::k_strand_executor_max_concurrency_level;
+}
+
+bool strand_executor::shutdown_requested() const {
+    return m_state->abort.load(std::memory_order_relaxed);
+}
+
+void strand_executor::shutdown() {
+    if (m_state->abort.exchange(true, std::memory_order_relaxed)) {
+        return;  // shutdown had been called before.
+    }
+
+    // if a drain is pending or running, it clears the queue once it observes the abort flag
+    if (!m_state->scheduled.exchange(true, std::memory_order_seq_cst)) {
+        m_state->queue.clear();
+    }
+}
+
+std::shared_ptr<concurrencpp::executor> strand_executor::underlying_executor() const noexcept {
+    return m_state->underlying_executor;
+}
+
+bool strand_executor::running_in_this_thread() const noexcept {
+    return details::strand_state::s_tl_running_state == m_state.get();
+}
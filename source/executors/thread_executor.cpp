@@ -5,29 +5,71 @@ using concurrencpp::thread_executor;
 
 thread_executor::thread_executor(const std::function<void(std::string_view thread_name)>& thread_started_callback,
                                  const std::function<void(std::string_view thread_name)>& thread_terminated_callback) :
+    thread_executor(std::chrono::milliseconds(0), thread_started_callback, thread_terminated_callback) {}
+
+thread_executor::thread_executor(std::chrono::milliseconds max_idle_time,
+                                 const std::function<void(std::string_view thread_name)>& thread_started_callback,
+                                 const std::function<void(std::string_view thread_name)>& thread_terminated_callback) :
     derivable_executor<concurrencpp::thread_executor>(details::consts::k_thread_executor_name),
     m_abort(false), m_atomic_abort(false), m_thread_started_callback(thread_started_callback),
-    m_thread_terminated_callback(thread_terminated_callback) {}
+    m_thread_terminated_callback(thread_terminated_callback), m_max_idle_time(max_idle_time), m_idle_workers(0) {}
 
 thread_executor::~thread_executor() noexcept {
     assert(m_workers.empty());
     assert(m_last_retired.empty());
+    assert(m_handed_over_tasks.empty());
 }
 
 void thread_executor::enqueue_impl(std::unique_lock<std::mutex>& lock, concurrencpp::task& task) {
     assert(lock.owns_lock());
 
+    if (m_idle_workers > m_handed_over_tasks.size()) {
+        m_handed_over_tasks.emplace_back(std::move(task));
+        m_idle_condition.notify_one();
+        return;
+    }
+
     auto& new_thread = m_workers.emplace_front();
     new_thread = details::thread(
         details::make_executor_worker_name(name),
         [this, self_it = m_workers.begin(), task = std::move(task)]() mutable {
-            task();
+            do {
+                task();
+                task.clear();
+            } while (wait_for_next_task(task));
+
             retire_worker(self_it);
         },
         m_thread_started_callback,
         m_thread_terminated_callback);
 }
 
+bool thread_executor::wait_for_next_task(concurrencpp::task& task) {
+    if (m_max_idle_time == std::chrono::milliseconds(0)) {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    if (m_abort) {
+        return false;
+    }
+
+    ++m_idle_workers;
+    m_idle_condition.wait_for(lock, m_max_idle_time, [this] {
+        return !m_handed_over_tasks.empty() || m_abort;
+    });
+    --m_idle_workers;
+
+    // a task that was handed over before shutdown was called is still executed
+    if (m_handed_over_tasks.empty()) {
+        return false;
+    }
+
+    task = std::move(m_handed_over_tasks.front());
+    m_handed_over_tasks.pop_front();
+    return true;
+}
+
 void thread_executor::enqueue(concurrencpp::task task) {
     std::unique_lock<std::mutex> lock(m_lock);
     if (m_abort) {
@@ -64,6 +106,8 @@ void thread_executor::shutdown() {
 
     std::unique_lock<std::mutex> lock(m_lock);
     m_abort = true;
+    m_idle_condition.notify_all();
+
     m_condition.wait(lock, [this] {
         return m_workers.empty();
     });
@@ -105,6 +105,10 @@ void idle_worker_set::set_active(size_t idle_thread) noexcept {
     m_approx_size.fetch_sub(1, std::memory_order_relaxed);
 }
 
+bool idle_worker_set::has_idle_workers() const noexcept {
+    return m_approx_size.load(std::memory_order_relaxed) > 0;
+}
+
 bool idle_worker_set::try_acquire_flag(size_t index) noexcept {
     const auto worker_status = m_idle_flags[index].flag.load(std::memory_order_relaxed);
     if (worker_status == status::active) {
@@ -555,8 +559,9 @@ void thread_pool_executor::mark_worker_active(size_t index) noexcept {
 }
 
 void thread_pool_executor::enqueue(concurrencpp::task task) {
-    const auto this_worker = details::s_tl_thread_pool_data.this_worker;
-    const auto this_worker_index = details::s_tl_thread_pool_data.this_thread_index;
+    // a worker of another pool is treated like any other foreign thread
+    const auto this_worker_index = current_worker_index();
+    const auto this_worker = (this_worker_index != static_cast<size_t>(-1)) ? &m_workers[this_worker_index] : nullptr;
 
     if (this_worker != nullptr && this_worker->appears_empty()) {
         return this_worker->enqueue_local(task);
@@ -576,8 +581,9 @@ void thread_pool_executor::enqueue(concurrencpp::task task) {
 }
 
 void thread_pool_executor::enqueue(std::span<concurrencpp::task> tasks) {
-    if (details::s_tl_thread_pool_data.this_worker != nullptr) {
-        return details::s_tl_thread_pool_data.this_worker->enqueue_local(tasks);
+    const auto this_worker_index = current_worker_index();
+    if (this_worker_index != static_cast<size_t>(-1)) {
+        return m_workers[this_worker_index].enqueue_local(tasks);
     }
 
     if (tasks.size() < m_workers.size()) {
@@ -641,3 +647,28 @@ void thread_pool_executor::shutdown() {
 std::chrono::milliseconds thread_pool_executor::max_worker_idle_time() const noexcept {
     return m_workers[0].max_worker_idle_time();
 }
+
+bool thread_pool_executor::has_idle_workers() const noexcept {
+    return m_idle_workers.has_idle_workers();
+}
+
+bool thread_pool_executor::enqueue_to_idle_worker(concurrencpp::task& task) {
+    const auto idle_worker_pos = m_idle_workers.find_idle_worker(current_worker_index());
+    if (idle_worker_pos == static_cast<size_t>(-1)) {
+        return false;
+    }
+
+    m_workers[idle_worker_pos].enqueue_foreign(task);
+    return true;
+}
+
+size_t thread_pool_executor::current_worker_index() const noexcept {
+    const auto this_worker = details::s_tl_thread_pool_data.this_worker;
+    const auto this_worker_index = details::s_tl_thread_pool_data.this_thread_index;
+
+    if (this_worker_index < m_workers.size() && this_worker == &m_workers[this_worker_index]) {
+        return this_worker_index;
+    }
+
+    return static_cast<size_t>(-1);
+}
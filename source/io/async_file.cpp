@@ -0,0 +1,366 @@
+#include "concurrencpp/io/async_file.h"
+
+#include "concurrencpp/errors.h"
+#include "concurrencpp/runtime/runtime.h"
+#include "concurrencpp/executors/thread_pool_executor.h"
+
+#if defined(CRCPP_HAS_IO_URING)
+#    include "concurrencpp/executors/io_uring_executor.h"
+#endif
+
+#include <new>
+#include <cerrno>
+#include <system_error>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using concurrencpp::result;
+using concurrencpp::async_file;
+using concurrencpp::async_file_buffer;
+using concurrencpp::details::async_file_state;
+using concurrencpp::details::aligned_buffer_pool;
+
+namespace concurrencpp::details {
+    struct async_file_state {
+        const int fd;
+        const std::shared_ptr<concurrencpp::executor> executor;
+        const bool use_io_uring;
+        const async_file_options options;
+        const std::shared_ptr<aligned_buffer_pool> pool;
+
+        async_file_state(int fd,
+                         std::shared_ptr<concurrencpp::executor> executor,
+                         bool use_io_uring,
+                         const async_file_options& options) :
+            fd(fd),
+            executor(std::move(executor)), use_io_uring(use_io_uring), options(options),
+            pool(std::make_shared<aligned_buffer_pool>(options.alignment)) {}
+
+        ~async_file_state() noexcept {
+            ::close(fd);
+        }
+    };
+
+    namespace {
+        [[noreturn]] void throw_system_error(int error_code, const char* what) {
+            throw std::system_error(error_code, std::system_category(), what);
+        }
+
+        bool is_io_uring_executor(const std::shared_ptr<concurrencpp::executor>& executor) noexcept {
+#if defined(CRCPP_HAS_IO_URING)
+            return dynamic_cast<io_uring_executor*>(executor.get()) != nullptr;
+#else
+            (void)executor;
+            return false;
+#endif
+        }
+
+        size_t pread_some(int fd, std::span<std::byte> buffer, uint64_t offset) {
+            while (true) {
+                const auto read = ::pread(fd, buffer.data(), buffer.size(), static_cast<off_t>(offset));
+                if (read >= 0) {
+                    return static_cast<size_t>(read);
+                }
+
+                if (errno != EINTR) {
+                    throw_system_error(errno, "concurrencpp::async_file::read_at() - pread() failed.");
+                }
+            }
+        }
+
+        size_t pwrite_all(int fd, std::span<const std::byte> buffer, uint64_t offset) {
+            size_t written = 0;
+            while (written != buffer.size()) {
+                const auto res = ::pwrite(fd, buffer.data() + written, buffer.size() - written, static_cast<off_t>(offset + written));
+                if (res >= 0) {
+                    written += static_cast<size_t>(res);
+                    continue;
+                }
+
+                if (errno != EINTR) {
+                    throw_system_error(errno, "concurrencpp::async_file::write_at() - pwrite() failed.");
+                }
+            }
+
+            return written;
+        }
+
+#if defined(CRCPP_HAS_IO_URING)
+        result<size_t> io_uring_read(std::shared_ptr<async_file_state> state, uint64_t offset, std::span<std::byte> buffer) {
+            auto& ring = static_cast<io_uring_executor&>(*state->executor);
+            co_return co_await ring.read(state->executor, state->fd, buffer, offset);
+        }
+
+        result<size_t> io_uring_write(std::shared_ptr<async_file_state> state, uint64_t offset, std::span<const std::byte> buffer) {
+            auto& ring = static_cast<io_uring_executor&>(*state->executor);
+
+            size_t written = 0;
+            while (written != buffer.size()) {
+                written += co_await ring.write(state->executor, state->fd, buffer.subspan(written), offset + written);
+            }
+
+            co_return written;
+        }
+#endif
+
+        result<size_t> read_at_impl(std::shared_ptr<async_file_state> state, uint64_t offset, std::span<std::byte> buffer) {
+#if defined(CRCPP_HAS_IO_URING)
+            if (state->use_io_uring) {
+                return io_uring_read(std::move(state), offset, buffer);
+            }
+#endif
+
+            auto& executor = *state->executor;
+            return executor.submit([state = std::move(state), offset, buffer] {
+                return pread_some(state->fd, buffer, offset);
+            });
+        }
+
+        struct file_chunk {
+            async_file_buffer buffer;
+            size_t size;
+        };
+
+        // the read owns its buffer, so a stream that is abandoned mid-way can't free a buffer that is still being read into.
+        // a single read might return less than requested in the middle of the file, so the buffer is filled until a read returns 0.
+        // direct reads only come up short at the end of the file, where the next offset isn't aligned anymore.
+        result<file_chunk> read_chunk(std::shared_ptr<async_file_state> state, async_file_buffer buffer, uint64_t offset) {
+            const auto span = buffer.span();
+            size_t size = 0;
+
+            while (size != span.size()) {
+                const auto read = co_await read_at_impl(state, offset + size, span.subspan(size));
+                size += read;
+
+                if (read == 0 || state->options.direct_io) {
+                    break;
+                }
+            }
+
+            co_return file_chunk {std::move(buffer), size};
+        }
+    }  // namespace
+}  // namespace concurrencpp::details
+
+/*
+    aligned_buffer_pool
+*/
+
+aligned_buffer_pool::aligned_buffer_pool(size_t alignment) noexcept : m_alignment(alignment) {}
+
+aligned_buffer_pool::~aligned_buffer_pool() noexcept {
+    for (const auto& [buffer, size] : m_free_buffers) {
+        ::operator delete(buffer, size, std::align_val_t(m_alignment));
+    }
+}
+
+std::byte* aligned_buffer_pool::allocate(size_t size) {
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        for (auto it = m_free_buffers.begin(); it != m_free_buffers.end(); ++it) {
+            if (it->second == size) {
+                const auto buffer = it->first;
+                *it = m_free_buffers.back();
+                m_free_buffers.pop_back();
+                return buffer;
+            }
+        }
+    }
+
+    return static_cast<std::byte*>(::operator new(size, std::align_val_t(m_alignment)));
+}
+
+void aligned_buffer_pool::deallocate(std::byte* buffer, size_t size) noexcept {
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        if (m_free_buffers.size() < details::consts::k_async_file_max_pooled_buffers) {
+            try {
+                m_free_buffers.emplace_back(buffer, size);
+                return;
+            } catch (...) {
+                // fall through and free the buffer
+            }
+        }
+    }
+
+    ::operator delete(buffer, size, std::align_val_t(m_alignment));
+}
+
+/*
+    async_file_buffer
+*/
+
+async_file_buffer::async_file_buffer(std::shared_ptr<details::aligned_buffer_pool> pool, std::byte* data, size_t size) noexcept :
+    m_pool(std::move(pool)), m_data(data), m_size(size) {}
+
+async_file_buffer::async_file_buffer(async_file_buffer&& rhs) noexcept :
+    m_pool(std::move(rhs.m_pool)), m_data(std::exchange(rhs.m_data, nullptr)), m_size(std::exchange(rhs.m_size, 0)) {}
+
+async_file_buffer::~async_file_buffer() noexcept {
+    if (m_data != nullptr) {
+        m_pool->deallocate(m_data, m_size);
+    }
+}
+
+async_file_buffer& async_file_buffer::operator=(async_file_buffer&& rhs) noexcept {
+    if (this == &rhs) {
+        return *this;
+    }
+
+    if (m_data != nullptr) {
+        m_pool->deallocate(m_data, m_size);
+    }
+
+    m_pool = std::move(rhs.m_pool);
+    m_data = std::exchange(rhs.m_data, nullptr);
+    m_size = std::exchange(rhs.m_size, 0);
+    return *this;
+}
+
+/*
+    async_file
+*/
+
+async_file::async_file(std::shared_ptr<details::async_file_state> state) noexcept : m_state(std::move(state)) {}
+
+void async_file::throw_if_empty(const char* error_msg) const {
+    if (!static_cast<bool>(m_state)) {
+        throw errors::empty_object(error_msg);
+    }
+}
+
+result<async_file> async_file::open(std::shared_ptr<executor> executor,
+                                    std::string path,
+                                    int flags,
+                                    async_file_options options,
+                                    mode_t mode) {
+    if (!static_cast<bool>(executor)) {
+        throw std::invalid_argument(details::consts::k_async_file_open_null_executor_err_msg);
+    }
+
+    if (options.alignment == 0 || (options.alignment & (options.alignment - 1)) != 0) {
+        throw std::invalid_argument(details::consts::k_async_file_invalid_alignment_err_msg);
+    }
+
+    flags |= O_CLOEXEC;
+    if (options.direct_io) {
+        flags |= O_DIRECT;
+    }
+
+    return open_impl(std::move(executor), std::move(path), flags, options, mode);
+}
+
+result<async_file> async_file::open(runtime& runtime, std::string path, int flags, async_file_options options, mode_t mode) {
+    return open(runtime.background_executor(), std::move(path), flags, options, mode);
+}
+
+result<async_file> async_file::open_impl(std::shared_ptr<executor> executor,
+                                         std::string path,
+                                         int flags,
+                                         async_file_options options,
+                                         mode_t mode) {
+    const auto use_io_uring = details::is_io_uring_executor(executor);
+    int fd = -1;
+
+#if defined(CRCPP_HAS_IO_URING)
+    if (use_io_uring) {
+        fd = co_await static_cast<io_uring_executor&>(*executor).openat(executor, AT_FDCWD, path.c_str(), flags, mode);
+    }
+#endif
+
+    if (!use_io_uring) {
+        fd = co_await executor->submit([&path, flags, mode] {
+            const auto fd = ::open(path.c_str(), flags, mode);
+            if (fd == -1) {
+                details::throw_system_error(errno, "concurrencpp::async_file::open() - open() failed.");
+            }
+
+            return fd;
+        });
+    }
+
+    try {
+        co_return async_file(std::make_shared<details::async_file_state>(fd, std::move(executor), use_io_uring, options));
+    } catch (...) {
+        ::close(fd);  // the state didn't take ownership of the descriptor
+        throw;
+    }
+}
+
+int async_file::native_handle() const noexcept {
+    return static_cast<bool>(m_state) ? m_state->fd : -1;
+}
+
+result<size_t> async_file::read_at(uint64_t offset, std::span<std::byte> buffer) const {
+    throw_if_empty(details::consts::k_async_file_read_at_empty_err_msg);
+    return details::read_at_impl(m_state, offset, buffer);
+}
+
+result<size_t> async_file::write_at(uint64_t offset, std::span<const std::byte> buffer) const {
+    throw_if_empty(details::consts::k_async_file_write_at_empty_err_msg);
+
+#if defined(CRCPP_HAS_IO_URING)
+    if (m_state->use_io_uring) {
+        return details::io_uring_write(m_state, offset, buffer);
+    }
+#endif
+
+    return m_state->executor->submit([state = m_state, offset, buffer] {
+        return details::pwrite_all(state->fd, buffer, offset);
+    });
+}
+
+concurrencpp::async_generator<std::span<const std::byte>> async_file::read_chunks(size_t chunk_size, uint64_t offset) const {
+    throw_if_empty(details::consts::k_async_file_read_chunks_empty_err_msg);
+
+    const auto& options = m_state->options;
+    if (chunk_size == 0 || (options.direct_io && (chunk_size % options.alignment != 0 || offset % options.alignment != 0))) {
+        throw std::invalid_argument(details::consts::k_async_file_read_chunks_invalid_chunk_size_err_msg);
+    }
+
+    return read_chunks_impl(m_state, chunk_size, offset);
+}
+
+concurrencpp::async_generator<std::span<const std::byte>> async_file::read_chunks_impl(
+    std::shared_ptr<details::async_file_state> state,
+    size_t chunk_size,
+    uint64_t offset) {
+    const auto depth = std::max<size_t>(state->options.read_ahead, 1);
+
+    // read_ahead chunks are always in flight, the next chunk's read is issued once the consumer is done with a buffer
+    std::vector<result<details::file_chunk>> in_flight;
+    in_flight.reserve(depth);
+
+    for (size_t i = 0; i < depth; i++) {
+        auto buffer = async_file_buffer(state->pool, state->pool->allocate(chunk_size), chunk_size);
+        in_flight.emplace_back(details::read_chunk(state, std::move(buffer), offset));
+        offset += chunk_size;
+    }
+
+    for (size_t index = 0;; index = (index + 1) % depth) {
+        auto chunk = co_await in_flight[index];
+        if (chunk.size == 0) {
+            co_return;
+        }
+
+        std::span<const std::byte> view(chunk.buffer.data(), chunk.size);
+        co_yield view;
+
+        if (chunk.size < chunk_size) {
+            co_return;  // read_chunk only returns a short chunk at the end of the file
+        }
+
+        in_flight[index] = details::read_chunk(state, std::move(chunk.buffer), offset);
+        offset += chunk_size;
+    }
+}
+
+concurrencpp::async_file_buffer async_file::allocate_buffer(size_t size) const {
+    throw_if_empty(details::consts::k_async_file_allocate_buffer_empty_err_msg);
+    return {m_state->pool, m_state->pool->allocate(size), size};
+}
+
+void async_file::close() noexcept {
+    m_state.reset();
+}
@@ -0,0 +1,161 @@
+#include "concurrencpp/io/mapped_file.h"
+
+#include <cerrno>
+#include <utility>
+#include <system_error>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using concurrencpp::mapped_file;
+using concurrencpp::mapped_file_advice;
+
+namespace concurrencpp::details {
+    namespace {
+        class file_descriptor {
+
+           private:
+            const int m_fd;
+
+           public:
+            explicit file_descriptor(int fd) noexcept : m_fd(fd) {}
+
+            ~file_descriptor() noexcept {
+                ::close(m_fd);
+            }
+
+            int get() const noexcept {
+                return m_fd;
+            }
+        };
+
+        [[noreturn]] void throw_system_error(int error_code, const char* what) {
+            throw std::system_error(error_code, std::system_category(), what);
+        }
+
+        int to_madvise_advice(mapped_file_advice advice) noexcept {
+            switch (advice) {
+                case mapped_file_advice::sequential:
+                    return MADV_SEQUENTIAL;
+                case mapped_file_advice::random:
+                    return MADV_RANDOM;
+                case mapped_file_advice::will_need:
+                    return MADV_WILLNEED;
+                case mapped_file_advice::dont_need:
+                    return MADV_DONTNEED;
+                case mapped_file_advice::normal:
+                    break;
+            }
+
+            return MADV_NORMAL;
+        }
+    }  // namespace
+}  // namespace concurrencpp::details
+
+mapped_file::mapped_file(const std::string& path) {
+    const auto fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        details::throw_system_error(errno, "concurrencpp::mapped_file - open() failed.");
+    }
+
+    // the mapping keeps the file alive, the descriptor isn't needed past this point
+    details::file_descriptor file(fd);
+
+    struct stat status;
+    if (::fstat(file.get(), &status) == -1) {
+        details::throw_system_error(errno, "concurrencpp::mapped_file - fstat() failed.");
+    }
+
+    const auto size = static_cast<size_t>(status.st_size);
+    if (size != 0) {  // zero length mappings are invalid
+        const auto data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file.get(), 0);
+        if (data == MAP_FAILED) {
+            details::throw_system_error(errno, "concurrencpp::mapped_file - mmap() failed.");
+        }
+
+        m_data = static_cast<const char*>(data);
+        m_size = size;
+    }
+
+    m_open = true;
+}
+
+mapped_file::mapped_file(mapped_file&& rhs) noexcept :
+    m_data(std::exchange(rhs.m_data, nullptr)), m_size(std::exchange(rhs.m_size, 0)), m_open(std::exchange(rhs.m_open, false)) {}
+
+mapped_file::~mapped_file() noexcept {
+    unmap();
+}
+
+mapped_file& mapped_file::operator=(mapped_file&& rhs) noexcept {
+    if (this == &rhs) {
+        return *this;
+    }
+
+    unmap();
+    m_data = std::exchange(rhs.m_data, nullptr);
+    m_size = std::exchange(rhs.m_size, 0);
+    m_open = std::exchange(rhs.m_open, false);
+    return *this;
+}
+
+void mapped_file::unmap() noexcept {
+    if (m_data != nullptr) {
+        ::munmap(const_cast<char*>(m_data), m_size);
+    }
+
+    m_data = nullptr;
+    m_size = 0;
+    m_open = false;
+}
+
+void mapped_file::advise(mapped_file_advice advice, size_t offset, size_t length) const noexcept {
+    if (offset >= m_size) {
+        return;
+    }
+
+    length = std::min(length, m_size - offset);
+
+    // madvise requires a page aligned address, the mapping itself is page aligned
+    static const auto page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    const auto aligned_offset = offset - offset % page_size;
+    length += offset - aligned_offset;
+
+    ::madvise(const_cast<char*>(m_data) + aligned_offset, length, details::to_madvise_advice(advice));
+}
+
+std::string_view concurrencpp::details::line_chunk(std::string_view content,
+                                                   size_t chunk_index,
+                                                   size_t chunk_size,
+                                                   char delimiter) noexcept {
+    const auto nominal_begin = chunk_index * chunk_size;
+    if (nominal_begin >= content.size()) {
+        return {};
+    }
+
+    const auto nominal_end = std::min(content.size() - nominal_begin, chunk_size) + nominal_begin;
+
+    size_t begin = 0;
+    if (nominal_begin != 0) {
+        // a record starts inside this chunk only if a delimiter is found in [nominal_begin - 1, nominal_end - 1).
+        // the search is bounded, so a very long record doesn't get scanned by every chunk it spans
+        const auto pos = content.substr(nominal_begin - 1, nominal_end - nominal_begin).find(delimiter);
+        if (pos == std::string_view::npos) {
+            return {};
+        }
+
+        begin = nominal_begin + pos;
+    }
+
+    auto end = content.size();
+    if (nominal_end != content.size()) {
+        const auto pos = content.find(delimiter, nominal_end - 1);
+        if (pos != std::string_view::npos) {
+            end = pos + 1;
+        }
+    }
+
+    return content.substr(begin, end - begin);
+}
@@ -0,0 +1,39 @@
+#include "concurrencpp/results/impl/resumption_batch.h"
+#include "concurrencpp/results/impl/consumer_context.h"
+
+using concurrencpp::details::resumption_batch;
+
+resumption_batch::~resumption_batch() noexcept {
+    flush();
+}
+
+void resumption_batch::add(const std::shared_ptr<executor>& resume_executor,
+                           coroutine_handle<void> caller_handle,
+                           bool* interrupted) noexcept {
+    assert(static_cast<bool>(resume_executor));
+
+    if (m_size == m_tasks.size() || (m_size != 0 && m_executor != resume_executor)) {
+        flush();
+    }
+
+    m_executor = resume_executor;
+    m_tasks[m_size++] = task(await_via_functor {caller_handle, interrupted});  // stored inline in the task, no allocation
+}
+
+void resumption_batch::flush() noexcept {
+    if (m_size == 0) {
+        return;
+    }
+
+    try {
+        m_executor->enqueue(std::span<task>(m_tasks.data(), m_size));
+    } catch (...) {
+        // tasks that were not enqueued resume their coroutines inline as interrupted when destroyed
+    }
+
+    for (size_t i = 0; i < m_size; i++) {
+        m_tasks[i].clear();
+    }
+
+    m_size = 0;
+}
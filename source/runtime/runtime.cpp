@@ -61,7 +61,8 @@ runtime_options::runtime_options() noexcept :
     max_thread_pool_executor_waiting_time(details::k_default_max_worker_wait_time),
     max_background_threads(details::default_max_background_workers()),
     max_background_executor_waiting_time(details::k_default_max_worker_wait_time),
-    max_timer_queue_waiting_time(std::chrono::seconds(details::consts::k_max_timer_queue_worker_waiting_time_sec)) {}
+    max_timer_queue_waiting_time(std::chrono::seconds(details::consts::k_max_timer_queue_worker_waiting_time_sec)),
+    max_thread_executor_idle_time(std::chrono::milliseconds(0)) {}
 
 /*
         runtime
@@ -91,8 +92,9 @@ runtime::runtime(const runtime_options& options) {
                                                                                    options.thread_terminated_callback);
     m_registered_executors.register_executor(m_background_executor);
 
-    m_thread_executor =
-        std::make_shared<::concurrencpp::thread_executor>(options.thread_started_callback, options.thread_terminated_callback);
+    m_thread_executor = std::make_shared<::concurrencpp::thread_executor>(options.max_thread_executor_idle_time,
+                                                                          options.thread_started_callback,
+                                                                          options.thread_terminated_callback);
     m_registered_executors.register_executor(m_thread_executor);
 }
 
@@ -0,0 +1,127 @@
+#include "concurrencpp/threads/constants.h"
+#include "concurrencpp/threads/async_barrier.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/errors.h"
+#include "concurrencpp/results/promises.h"
+#include "concurrencpp/results/impl/resumption_batch.h"
+
+using concurrencpp::result;
+using concurrencpp::async_barrier;
+using concurrencpp::details::async_barrier_awaiter;
+
+namespace concurrencpp::details {
+    namespace {
+        result<void> run_async_barrier_awaiter(async_barrier_awaiter awaiter) {
+            co_await awaiter;
+        }
+    }  // namespace
+}  // namespace concurrencpp::details
+
+/*
+    async_barrier_awaiter
+*/
+
+async_barrier_awaiter::async_barrier_awaiter(async_barrier& parent, std::shared_ptr<executor> resume_executor) noexcept :
+    m_parent(parent), m_resume_executor(std::move(resume_executor)) {}
+
+async_barrier_awaiter::async_barrier_awaiter(async_barrier_awaiter&& rhs) noexcept :
+    m_parent(rhs.m_parent), m_resume_executor(std::move(rhs.m_resume_executor)) {
+    assert(!static_cast<bool>(rhs.m_caller_handle) && "concurrencpp::async_barrier_awaiter is moved while being awaited.");
+}
+
+bool async_barrier_awaiter::await_suspend(coroutine_handle<void> caller_handle) noexcept {
+    assert(static_cast<bool>(caller_handle));
+    assert(!caller_handle.done());
+
+    m_caller_handle = caller_handle;
+
+    // the last participant to arrive completes the phase and continues inline
+    return !m_parent.arrive(this);
+}
+
+void async_barrier_awaiter::await_resume() const {
+    if (m_interrupted) {
+        throw errors::broken_task(details::consts::k_broken_task_exception_error_msg);
+    }
+}
+
+result<void> async_barrier_awaiter::run() {
+    return details::run_async_barrier_awaiter(std::move(*this));
+}
+
+/*
+    async_barrier
+*/
+
+async_barrier::async_barrier(size_t expected, std::function<void()> completion) :
+    m_counter(expected), m_expected(expected), m_waiters(nullptr), m_completion(std::move(completion)) {
+    if (expected == 0) {
+        throw std::invalid_argument(details::consts::k_async_barrier_constructor_zero_expected_err_msg);
+    }
+}
+
+async_barrier::~async_barrier() noexcept {
+    assert(m_waiters.load(std::memory_order_relaxed) == nullptr && "concurrencpp::async_barrier is destroyed while being awaited.");
+}
+
+bool async_barrier::arrive(details::async_barrier_awaiter* awaiter) noexcept {
+    if (awaiter != nullptr) {
+        // waiters of the current phase are pushed before they count down, so the last arriver sees all of them
+        auto waiters = m_waiters.load(std::memory_order_relaxed);
+        do {
+            awaiter->next = waiters;
+        } while (!m_waiters.compare_exchange_weak(waiters, awaiter, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    const auto prev_counter = m_counter.fetch_sub(1, std::memory_order_acq_rel);
+    assert(prev_counter != 0 && "concurrencpp::async_barrier - more participants arrived than expected.");
+
+    if (prev_counter != 1) {
+        return false;
+    }
+
+    complete_phase(awaiter);
+    return true;
+}
+
+void async_barrier::complete_phase(details::async_barrier_awaiter* last_arriver) noexcept {
+    if (static_cast<bool>(m_completion)) {
+        m_completion();  // an exception thrown here terminates the program, like with std::barrier
+    }
+
+    // no participant can arrive for the next phase before the counter is reset
+    auto stack = m_waiters.exchange(nullptr, std::memory_order_acquire);
+    m_counter.store(m_expected.load(std::memory_order_relaxed), std::memory_order_release);
+
+    async_barrier_awaiter* waiters = nullptr;
+    while (stack != nullptr) {
+        const auto next = stack->next;
+        if (stack != last_arriver) {
+            stack->next = waiters;
+            waiters = stack;
+        }
+
+        stack = next;
+    }
+
+    details::resumption_batch batch;
+    while (waiters != nullptr) {
+        const auto next = waiters->next;
+        batch.add(waiters->m_resume_executor, waiters->m_caller_handle, &waiters->m_interrupted);
+        waiters = next;
+    }
+}
+
+async_barrier_awaiter async_barrier::arrive_and_wait(std::shared_ptr<executor> resume_executor) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_barrier_arrive_and_wait_null_resume_executor_err_msg);
+    }
+
+    return {*this, std::move(resume_executor)};
+}
+
+void async_barrier::arrive_and_drop() noexcept {
+    // the participant is removed from the next phases before it arrives at the current one
+    m_expected.fetch_sub(1, std::memory_order_relaxed);
+    arrive(nullptr);
+}
@@ -1,4 +1,3 @@
-#include "concurrencpp/results/resume_on.h"
 #include "concurrencpp/threads/constants.h"
 #include "concurrencpp/threads/async_condition_variable.h"
 
@@ -13,21 +12,32 @@ using concurrencpp::details::cv_awaiter;
     cv_awaiter
 */
 
-cv_awaiter::cv_awaiter(async_condition_variable& parent, scoped_async_lock& lock) noexcept : m_parent(parent), m_lock(lock) {}
+cv_awaiter::cv_awaiter(async_condition_variable& parent, scoped_async_lock& lock, std::shared_ptr<executor> resume_executor) noexcept :
+    m_parent(parent), m_lock(lock), m_lock_awaiter(*lock.mutex(), std::move(resume_executor), true) {}
 
 void cv_awaiter::await_suspend(details::coroutine_handle<void> caller_handle) {
-    m_caller_handle = caller_handle;
+    m_lock_awaiter.m_caller_handle = caller_handle;
 
-    std::unique_lock<std::mutex> lock(m_parent.m_lock);
-    m_lock.unlock();
+    // the scoped lock is emptied before *this is published, it's re-armed by await_resume
+    auto& mutex = *m_lock.release();
 
-    m_parent.m_awaiters.push_back(*this);
+    {
+        std::unique_lock<std::mutex> lock(m_parent.m_lock);
+        m_parent.m_awaiters.push_back(*this);
+    }
+
+    // a notifier that already popped *this queues it behind us on the async_lock, unlocking hands the lock over.
+    // *this may be resumed and destroyed from this point on.
+    mutex.unlock();
 }
 
-void cv_awaiter::resume() noexcept {
-    assert(static_cast<bool>(m_caller_handle));
-    assert(!m_caller_handle.done());
-    m_caller_handle();
+void cv_awaiter::await_resume() {
+    scoped_async_lock rearmed(m_lock_awaiter.m_parent, std::defer_lock);
+    m_lock.swap(rearmed);
+
+    // throws errors::broken_task if the lock was handed over but resume_executor could not resume the caller
+    auto guard = m_lock_awaiter.await_resume();
+    m_lock.swap(guard);
 }
 
 /*
@@ -52,10 +62,8 @@ void async_condition_variable::verify_await_params(const std::shared_ptr<executo
 }
 
 lazy_result<void> async_condition_variable::await_impl(std::shared_ptr<executor> resume_executor, scoped_async_lock& lock) {
-    co_await details::cv_awaiter(*this, lock);
-    assert(!lock.owns_lock());
-    co_await resume_on(resume_executor);  // TODO: optimize this when get_current_executor is available
-    co_await lock.lock(resume_executor);
+    co_await details::cv_awaiter(*this, lock, std::move(resume_executor));
+    assert(lock.owns_lock());
 }
 
 lazy_result<void> async_condition_variable::await(std::shared_ptr<executor> resume_executor, scoped_async_lock& lock) {
@@ -69,7 +77,8 @@ void async_condition_variable::notify_one() {
     lock.unlock();
 
     if (awaiter != nullptr) {
-        awaiter->resume();
+        auto& lock_awaiter = awaiter->m_lock_awaiter;
+        lock_awaiter.m_parent.enqueue_awaiters(lock_awaiter);
     }
 }
 
@@ -78,12 +87,32 @@ void async_condition_variable::notify_all() {
     auto awaiters = std::move(m_awaiters);
     lock.unlock();
 
+    // consecutive awaiters that wait with the same async_lock are moved to its waiter list in one go
+    details::async_lock_awaiter* first = nullptr;
+    details::async_lock_awaiter* last = nullptr;
+
     while (true) {
         const auto awaiter = awaiters.pop_front();
         if (awaiter == nullptr) {
-            return;  // no more awaiters
+            break;  // no more awaiters
+        }
+
+        auto& lock_awaiter = awaiter->m_lock_awaiter;
+        if (first != nullptr && &first->m_parent != &lock_awaiter.m_parent) {
+            first->m_parent.enqueue_awaiters(*first);
+            first = nullptr;
+        }
+
+        if (first == nullptr) {
+            first = &lock_awaiter;
+        } else {
+            last->next = &lock_awaiter;
         }
 
-        awaiter->resume();
+        last = &lock_awaiter;
+    }
+
+    if (first != nullptr) {
+        first->m_parent.enqueue_awaiters(*first);
     }
 }
\ No newline at end of file
@@ -0,0 +1,274 @@
+#include "concurrencpp/threads/constants.h"
+#include "concurrencpp/threads/async_event.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/errors.h"
+#include "concurrencpp/results/promises.h"
+#include "concurrencpp/results/impl/consumer_context.h"
+#include "concurrencpp/results/impl/resumption_batch.h"
+
+using concurrencpp::result;
+using concurrencpp::async_auto_reset_event;
+using concurrencpp::async_manual_reset_event;
+using concurrencpp::details::async_auto_reset_event_awaiter;
+using concurrencpp::details::async_manual_reset_event_awaiter;
+
+namespace concurrencpp::details {
+    namespace {
+        template<class awaiter_type>
+        result<void> run_async_event_awaiter(awaiter_type awaiter) {
+            co_await awaiter;
+        }
+    }  // namespace
+}  // namespace concurrencpp::details
+
+/*
+    async_manual_reset_event_awaiter
+*/
+
+async_manual_reset_event_awaiter::async_manual_reset_event_awaiter(async_manual_reset_event& parent,
+                                                                   std::shared_ptr<executor> resume_executor) noexcept :
+    m_parent(parent),
+    m_resume_executor(std::move(resume_executor)) {}
+
+async_manual_reset_event_awaiter::async_manual_reset_event_awaiter(async_manual_reset_event_awaiter&& rhs) noexcept :
+    m_parent(rhs.m_parent), m_resume_executor(std::move(rhs.m_resume_executor)) {
+    assert(!static_cast<bool>(rhs.m_caller_handle) && "concurrencpp::async_manual_reset_event_awaiter is moved while being awaited.");
+}
+
+bool async_manual_reset_event_awaiter::await_ready() const noexcept {
+    return m_parent.is_set();
+}
+
+bool async_manual_reset_event_awaiter::await_suspend(coroutine_handle<void> caller_handle) noexcept {
+    assert(static_cast<bool>(caller_handle));
+    assert(!caller_handle.done());
+
+    m_caller_handle = caller_handle;
+    return m_parent.enqueue_awaiter(*this);
+}
+
+void async_manual_reset_event_awaiter::await_resume() const {
+    if (m_interrupted) {
+        throw errors::broken_task(details::consts::k_broken_task_exception_error_msg);
+    }
+}
+
+result<void> async_manual_reset_event_awaiter::run() {
+    return details::run_async_event_awaiter(std::move(*this));
+}
+
+/*
+    async_manual_reset_event
+*/
+
+async_manual_reset_event_awaiter* const async_manual_reset_event::k_set = reinterpret_cast<async_manual_reset_event_awaiter*>(-1);
+
+async_manual_reset_event::async_manual_reset_event(bool initially_set) noexcept : m_state(initially_set ? k_set : nullptr) {}
+
+async_manual_reset_event::~async_manual_reset_event() noexcept {
+    [[maybe_unused]] const auto state = m_state.load(std::memory_order_relaxed);
+    assert((state == nullptr || state == k_set) && "concurrencpp::async_manual_reset_event is destroyed while being awaited.");
+}
+
+bool async_manual_reset_event::enqueue_awaiter(details::async_manual_reset_event_awaiter& awaiter) noexcept {
+    auto state = m_state.load(std::memory_order_acquire);
+
+    do {
+        if (state == k_set) {
+            return false;
+        }
+
+        awaiter.next = state;
+    } while (!m_state.compare_exchange_weak(state, &awaiter, std::memory_order_release, std::memory_order_acquire));
+
+    return true;  // from this point on, awaiter may be resumed and destroyed at any time
+}
+
+void async_manual_reset_event::set() noexcept {
+    auto stack = m_state.exchange(k_set, std::memory_order_acq_rel);
+    if (stack == k_set) {
+        return;
+    }
+
+    // reverse the stack, so waiters are resumed in the order they started waiting
+    async_manual_reset_event_awaiter* waiters = nullptr;
+    while (stack != nullptr) {
+        const auto next = stack->next;
+        stack->next = waiters;
+        waiters = stack;
+        stack = next;
+    }
+
+    details::resumption_batch batch;
+    while (waiters != nullptr) {
+        const auto next = waiters->next;
+        batch.add(waiters->m_resume_executor, waiters->m_caller_handle, &waiters->m_interrupted);
+        waiters = next;
+    }
+}
+
+void async_manual_reset_event::reset() noexcept {
+    auto expected = k_set;
+    m_state.compare_exchange_strong(expected, nullptr, std::memory_order_relaxed, std::memory_order_relaxed);
+}
+
+bool async_manual_reset_event::is_set() const noexcept {
+    return m_state.load(std::memory_order_acquire) == k_set;
+}
+
+async_manual_reset_event_awaiter async_manual_reset_event::wait(std::shared_ptr<executor> resume_executor) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_manual_reset_event_wait_null_resume_executor_err_msg);
+    }
+
+    return {*this, std::move(resume_executor)};
+}
+
+/*
+    async_auto_reset_event_awaiter
+*/
+
+async_auto_reset_event_awaiter::async_auto_reset_event_awaiter(async_auto_reset_event& parent,
+                                                               std::shared_ptr<executor> resume_executor) noexcept :
+    m_parent(parent),
+    m_resume_executor(std::move(resume_executor)) {}
+
+async_auto_reset_event_awaiter::async_auto_reset_event_awaiter(async_auto_reset_event_awaiter&& rhs) noexcept :
+    m_parent(rhs.m_parent), m_resume_executor(std::move(rhs.m_resume_executor)) {
+    assert(!static_cast<bool>(rhs.m_caller_handle) && "concurrencpp::async_auto_reset_event_awaiter is moved while being awaited.");
+}
+
+bool async_auto_reset_event_awaiter::await_ready() noexcept {
+    return m_parent.try_consume();
+}
+
+bool async_auto_reset_event_awaiter::await_suspend(coroutine_handle<void> caller_handle) noexcept {
+    assert(static_cast<bool>(caller_handle));
+    assert(!caller_handle.done());
+
+    m_caller_handle = caller_handle;
+    return m_parent.enqueue_awaiter(*this);
+}
+
+void async_auto_reset_event_awaiter::await_resume() {
+    if (m_interrupted) {
+        // the signal was consumed on behalf of this awaiter but resume_executor could not resume it, pass it on.
+        m_parent.set();
+        throw errors::broken_task(details::consts::k_broken_task_exception_error_msg);
+    }
+}
+
+void async_auto_reset_event_awaiter::resume() noexcept {
+    assert(static_cast<bool>(m_caller_handle));
+    assert(static_cast<bool>(m_resume_executor));
+
+    try {
+        m_resume_executor->post(await_via_functor {m_caller_handle, &m_interrupted});
+    } catch (...) {
+        // the caller was resumed inline by ~await_via_functor with m_interrupted = true
+    }
+}
+
+result<void> async_auto_reset_event_awaiter::run() {
+    return details::run_async_event_awaiter(std::move(*this));
+}
+
+/*
+    async_auto_reset_event
+*/
+
+async_auto_reset_event_awaiter* const async_auto_reset_event::k_set = reinterpret_cast<async_auto_reset_event_awaiter*>(-1);
+
+async_auto_reset_event::async_auto_reset_event(bool initially_set) noexcept :
+    m_state(initially_set ? k_set : nullptr), m_waiters(nullptr) {}
+
+async_auto_reset_event::~async_auto_reset_event() noexcept {
+    [[maybe_unused]] const auto state = m_state.load(std::memory_order_relaxed);
+    assert((state == nullptr || state == k_set) && m_waiters == nullptr &&
+           "concurrencpp::async_auto_reset_event is destroyed while being awaited.");
+}
+
+bool async_auto_reset_event::try_consume() noexcept {
+    auto expected = k_set;
+    return m_state.compare_exchange_strong(expected, nullptr, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+bool async_auto_reset_event::enqueue_awaiter(details::async_auto_reset_event_awaiter& awaiter) noexcept {
+    auto state = m_state.load(std::memory_order_relaxed);
+
+    while (true) {
+        if (state == k_set) {
+            if (m_state.compare_exchange_weak(state, nullptr, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return false;  // the signal is consumed, the caller resumes inline
+            }
+
+            continue;
+        }
+
+        awaiter.next = state;
+        if (m_state.compare_exchange_weak(state, &awaiter, std::memory_order_release, std::memory_order_relaxed)) {
+            return true;  // from this point on, awaiter may be resumed and destroyed at any time
+        }
+    }
+}
+
+void async_auto_reset_event::set() {
+    if (m_state.load(std::memory_order_relaxed) == k_set) {
+        return;  // already set, nothing to wake
+    }
+
+    std::unique_lock<std::mutex> lock(m_lock);
+
+    if (m_waiters == nullptr) {
+        auto state = m_state.load(std::memory_order_relaxed);
+
+        while (true) {
+            if (state == k_set) {
+                return;
+            }
+
+            if (state == nullptr) {
+                if (m_state.compare_exchange_weak(state, k_set, std::memory_order_release, std::memory_order_relaxed)) {
+                    return;  // no waiters, the signal stays until it is consumed
+                }
+
+                continue;
+            }
+
+            if (m_state.compare_exchange_weak(state, nullptr, std::memory_order_acquire, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+
+        // new waiters were pushed in LIFO order, reverse them into the FIFO list
+        do {
+            const auto next = state->next;
+            state->next = m_waiters;
+            m_waiters = state;
+            state = next;
+        } while (state != nullptr);
+    }
+
+    const auto waiter = m_waiters;
+    m_waiters = waiter->next;
+    lock.unlock();
+
+    waiter->next = nullptr;
+    waiter->resume();
+}
+
+void async_auto_reset_event::reset() noexcept {
+    try_consume();
+}
+
+bool async_auto_reset_event::is_set() const noexcept {
+    return m_state.load(std::memory_order_acquire) == k_set;
+}
+
+async_auto_reset_event_awaiter async_auto_reset_event::wait(std::shared_ptr<executor> resume_executor) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_auto_reset_event_wait_null_resume_executor_err_msg);
+    }
+
+    return {*this, std::move(resume_executor)};
+}
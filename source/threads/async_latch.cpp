@@ -0,0 +1,134 @@
+#include "concurrencpp/threads/constants.h"
+#include "concurrencpp/threads/async_latch.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/errors.h"
+#include "concurrencpp/results/promises.h"
+#include "concurrencpp/results/impl/resumption_batch.h"
+
+using concurrencpp::result;
+using concurrencpp::async_latch;
+using concurrencpp::details::async_latch_awaiter;
+
+namespace concurrencpp::details {
+    namespace {
+        result<void> run_async_latch_awaiter(async_latch_awaiter awaiter) {
+            co_await awaiter;
+        }
+    }  // namespace
+}  // namespace concurrencpp::details
+
+/*
+    async_latch_awaiter
+*/
+
+async_latch_awaiter::async_latch_awaiter(async_latch& parent, std::shared_ptr<executor> resume_executor) noexcept :
+    m_parent(parent), m_resume_executor(std::move(resume_executor)) {}
+
+async_latch_awaiter::async_latch_awaiter(async_latch_awaiter&& rhs) noexcept :
+    m_parent(rhs.m_parent), m_resume_executor(std::move(rhs.m_resume_executor)) {
+    assert(!static_cast<bool>(rhs.m_caller_handle) && "concurrencpp::async_latch_awaiter is moved while being awaited.");
+}
+
+bool async_latch_awaiter::await_ready() const noexcept {
+    return m_parent.try_wait();
+}
+
+bool async_latch_awaiter::await_suspend(coroutine_handle<void> caller_handle) noexcept {
+    assert(static_cast<bool>(caller_handle));
+    assert(!caller_handle.done());
+
+    m_caller_handle = caller_handle;
+
+    // if the latch became ready in the meantime, the caller resumes inline
+    return m_parent.enqueue_awaiter(*this);
+}
+
+void async_latch_awaiter::await_resume() const {
+    if (m_interrupted) {
+        throw errors::broken_task(details::consts::k_broken_task_exception_error_msg);
+    }
+}
+
+result<void> async_latch_awaiter::run() {
+    return details::run_async_latch_awaiter(std::move(*this));
+}
+
+/*
+    async_latch
+*/
+
+async_latch_awaiter* const async_latch::k_ready = reinterpret_cast<async_latch_awaiter*>(-1);
+
+async_latch::async_latch(size_t expected) noexcept : m_counter(expected), m_waiters(expected == 0 ? k_ready : nullptr) {}
+
+async_latch::~async_latch() noexcept {
+    [[maybe_unused]] const auto waiters = m_waiters.load(std::memory_order_relaxed);
+    assert((waiters == nullptr || waiters == k_ready) && "concurrencpp::async_latch is destroyed while being awaited.");
+}
+
+bool async_latch::enqueue_awaiter(details::async_latch_awaiter& awaiter) noexcept {
+    auto waiters = m_waiters.load(std::memory_order_acquire);
+
+    do {
+        if (waiters == k_ready) {
+            return false;
+        }
+
+        awaiter.next = waiters;
+    } while (!m_waiters.compare_exchange_weak(waiters, &awaiter, std::memory_order_release, std::memory_order_acquire));
+
+    return true;  // from this point on, awaiter may be resumed and destroyed at any time
+}
+
+void async_latch::resume_waiters() noexcept {
+    auto stack = m_waiters.exchange(k_ready, std::memory_order_acq_rel);
+    if (stack == k_ready) {
+        return;
+    }
+
+    // reverse the stack, so waiters are resumed in the order they started waiting
+    async_latch_awaiter* waiters = nullptr;
+    while (stack != nullptr) {
+        const auto next = stack->next;
+        stack->next = waiters;
+        waiters = stack;
+        stack = next;
+    }
+
+    details::resumption_batch batch;
+    while (waiters != nullptr) {
+        const auto next = waiters->next;
+        batch.add(waiters->m_resume_executor, waiters->m_caller_handle, &waiters->m_interrupted);
+        waiters = next;
+    }
+}
+
+void async_latch::count_down(size_t update) noexcept {
+    const auto prev_counter = m_counter.fetch_sub(update, std::memory_order_acq_rel);
+    assert(prev_counter >= update && "concurrencpp::async_latch::count_down - update is bigger than the internal counter.");
+
+    if (prev_counter == update) {
+        resume_waiters();
+    }
+}
+
+bool async_latch::try_wait() const noexcept {
+    return m_counter.load(std::memory_order_acquire) == 0;
+}
+
+async_latch_awaiter async_latch::wait(std::shared_ptr<executor> resume_executor) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_latch_wait_null_resume_executor_err_msg);
+    }
+
+    return {*this, std::move(resume_executor)};
+}
+
+async_latch_awaiter async_latch::arrive_and_wait(std::shared_ptr<executor> resume_executor, size_t update) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_latch_arrive_and_wait_null_resume_executor_err_msg);
+    }
+
+    count_down(update);
+    return {*this, std::move(resume_executor)};
+}
@@ -1,91 +1,198 @@
-#include "concurrencpp/results/resume_on.h"
 #include "concurrencpp/threads/constants.h"
 #include "concurrencpp/threads/async_lock.h"
 #include "concurrencpp/executors/executor.h"
+#include "concurrencpp/errors.h"
+#include "concurrencpp/results/result.h"
+#include "concurrencpp/results/impl/consumer_context.h"
 
+using concurrencpp::result;
 using concurrencpp::async_lock;
 using concurrencpp::scoped_async_lock;
 using concurrencpp::details::async_lock_awaiter;
 
+namespace concurrencpp::details {
+    namespace {
+        result<scoped_async_lock> run_async_lock_awaiter(async_lock_awaiter awaiter) {
+            co_return co_await awaiter;
+        }
+    }  // namespace
+}  // namespace concurrencpp::details
+
 /*
     async_lock_awaiter
 */
 
-async_lock_awaiter::async_lock_awaiter(async_lock& parent, std::unique_lock<std::mutex>& lock) noexcept :
-    m_parent(parent), m_lock(std::move(lock)) {}
+async_lock_awaiter::async_lock_awaiter(async_lock& parent, std::shared_ptr<executor> resume_executor, bool with_raii_guard) noexcept :
+    m_parent(parent), m_resume_executor(std::move(resume_executor)), m_with_raii_guard(with_raii_guard) {}
+
+async_lock_awaiter::async_lock_awaiter(async_lock_awaiter&& rhs) noexcept :
+    m_parent(rhs.m_parent), m_resume_executor(std::move(rhs.m_resume_executor)), m_with_raii_guard(rhs.m_with_raii_guard) {
+    assert(!static_cast<bool>(rhs.m_caller_handle) && "concurrencpp::async_lock_awaiter is moved while being awaited.");
+}
+
+bool async_lock_awaiter::await_ready() noexcept {
+    return m_parent.try_acquire();
+}
+
+bool async_lock_awaiter::await_suspend(coroutine_handle<void> caller_handle) noexcept {
+    assert(static_cast<bool>(caller_handle));
+    assert(!caller_handle.done());
+
+    m_caller_handle = caller_handle;
+
+    // if the lock was released in the meantime, it's acquired by enqueue_awaiter and the caller resumes inline
+    return m_parent.enqueue_awaiter(*this);
+}
+
+scoped_async_lock async_lock_awaiter::await_resume() {
+    if (m_interrupted) {
+        // the lock was handed to this awaiter but resume_executor could not resume it, pass the lock on.
+        m_parent.release();
+        throw errors::broken_task(details::consts::k_broken_task_exception_error_msg);
+    }
+
+#ifdef CRCPP_DEBUG_MODE
+    const auto current_count = m_parent.m_thread_count_in_critical_section.fetch_add(1, std::memory_order_relaxed);
+    assert(current_count == 0);
+#endif
+
+    if (m_with_raii_guard) {
+        return scoped_async_lock(m_parent, std::adopt_lock);
+    }
 
-void async_lock_awaiter::await_suspend(coroutine_handle<void> handle) {
-    assert(static_cast<bool>(handle));
-    assert(!handle.done());
-    assert(!static_cast<bool>(m_resume_handle));
-    assert(m_lock.owns_lock());
+    return scoped_async_lock(m_parent, std::defer_lock);
+}
 
-    m_resume_handle = handle;
-    m_parent.m_awaiters.push_back(*this);
+void async_lock_awaiter::resume() noexcept {
+    assert(static_cast<bool>(m_caller_handle));
+    assert(static_cast<bool>(m_resume_executor));
 
-    auto lock = std::move(m_lock);  // will unlock underlying lock
+    try {
+        m_resume_executor->post(await_via_functor {m_caller_handle, &m_interrupted});
+    } catch (...) {
+        // the caller was resumed inline by ~await_via_functor with m_interrupted = true
+    }
 }
 
-void async_lock_awaiter::retry() noexcept {
-    m_resume_handle.resume();
+result<scoped_async_lock> async_lock_awaiter::run() {
+    return details::run_async_lock_awaiter(std::move(*this));
 }
 
 /*
     async_lock
 */
 
+async_lock_awaiter* const async_lock::k_not_locked = reinterpret_cast<async_lock_awaiter*>(-1);
+
+async_lock::async_lock() noexcept : m_state(k_not_locked), m_waiters(nullptr) {}
+
 async_lock::~async_lock() noexcept {
-#ifdef CRCPP_DEBUG_MODE
-    std::unique_lock<std::mutex> lock(m_awaiter_lock);
-    assert(!m_locked && "async_lock is dstroyed while it's locked.");
-#endif
+    assert(m_state.load(std::memory_order_relaxed) == k_not_locked && "async_lock is dstroyed while it's locked.");
 }
 
-concurrencpp::lazy_result<scoped_async_lock> async_lock::lock_impl(std::shared_ptr<executor> resume_executor, bool with_raii_guard) {
-    auto resume_synchronously = true;  // indicates if the locking coroutine managed to lock the lock on first attempt
+bool async_lock::try_acquire() noexcept {
+    auto expected = k_not_locked;
+    return m_state.compare_exchange_strong(expected, nullptr, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+bool async_lock::enqueue_awaiter(async_lock_awaiter& awaiter) noexcept {
+    auto state = m_state.load(std::memory_order_relaxed);
 
     while (true) {
-        std::unique_lock<std::mutex> lock(m_awaiter_lock);
-        if (!m_locked) {
-            m_locked = true;
-            lock.unlock();
-            break;
+        if (state == k_not_locked) {
+            if (m_state.compare_exchange_weak(state, nullptr, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return false;  // acquired
+            }
+
+            continue;
         }
 
-        co_await async_lock_awaiter(*this, lock);
+        awaiter.next = state;
+        if (m_state.compare_exchange_weak(state, &awaiter, std::memory_order_release, std::memory_order_relaxed)) {
+            return true;  // from this point on, awaiter may be resumed and destroyed at any time
+        }
+    }
+}
+
+void async_lock::enqueue_awaiters(async_lock_awaiter& first) noexcept {
+    // first is the head of a FIFO list of awaiters that are handed over from a condition variable.
+    // the rest of the list is reversed once into a LIFO chain, so it can be spliced onto m_state with a single CAS.
+    async_lock_awaiter* rest_head = nullptr;
+    async_lock_awaiter* rest_tail = nullptr;
 
-        resume_synchronously =
-            false;  // if we haven't managed to lock the lock on first attempt, we need to resume using resume_executor
+    auto cursor = std::exchange(first.next, nullptr);
+    while (cursor != nullptr) {
+        const auto next = cursor->next;
+        cursor->next = rest_head;
+        rest_head = cursor;
+
+        if (rest_tail == nullptr) {
+            rest_tail = cursor;
+        }
+
+        cursor = next;
     }
 
-    if (!resume_synchronously) {
-        try {
-            co_await resume_on(resume_executor);
-        } catch (...) {
-            std::unique_lock<std::mutex> lock(m_awaiter_lock);
-            assert(m_locked);
-            m_locked = false;
-            const auto awaiter = m_awaiters.pop_front();
-            lock.unlock();
+    auto state = m_state.load(std::memory_order_relaxed);
+
+    while (true) {
+        if (state == k_not_locked) {
+            // acquire the lock on behalf of first, the rest become the new waiters
+            if (rest_tail != nullptr) {
+                rest_tail->next = nullptr;
+            }
 
-            if (awaiter != nullptr) {
-                awaiter->retry();
+            if (m_state.compare_exchange_weak(state, rest_head, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                first.next = nullptr;
+                first.resume();
+                return;
             }
 
-            throw;
+            continue;
+        }
+
+        // first is the oldest awaiter, so it goes to the bottom of the chain
+        first.next = state;
+        if (rest_tail != nullptr) {
+            rest_tail->next = &first;
+        }
+
+        const auto head = (rest_head != nullptr) ? rest_head : &first;
+        if (m_state.compare_exchange_weak(state, head, std::memory_order_release, std::memory_order_relaxed)) {
+            return;  // from this point on, the awaiters may be resumed and destroyed at any time
         }
     }
+}
 
-#ifdef CRCPP_DEBUG_MODE
-    const auto current_count = m_thread_count_in_critical_section.fetch_add(1, std::memory_order_relaxed);
-    assert(current_count == 0);
-#endif
+void async_lock::release() noexcept {
+    auto waiter = m_waiters;
+
+    if (waiter == nullptr) {
+        auto expected = static_cast<async_lock_awaiter*>(nullptr);
+        if (m_state.compare_exchange_strong(expected, k_not_locked, std::memory_order_release, std::memory_order_relaxed)) {
+            return;  // no waiters, the lock is free
+        }
 
-    if (with_raii_guard) {
-        co_return scoped_async_lock(*this, std::adopt_lock);
+        // new waiters were pushed in LIFO order, reverse them into the owner's FIFO list
+        auto stack = m_state.exchange(nullptr, std::memory_order_acquire);
+        assert(stack != nullptr && stack != k_not_locked);
+
+        do {
+            const auto next = stack->next;
+            stack->next = waiter;
+            waiter = stack;
+            stack = next;
+        } while (stack != nullptr);
     }
 
-    co_return scoped_async_lock(*this, std::defer_lock);
+    // the lock is not released - ownership is handed directly to the first waiter
+    m_waiters = waiter->next;
+    waiter->next = nullptr;
+    waiter->resume();
+}
+
+concurrencpp::lazy_result<scoped_async_lock> async_lock::lock_impl(std::shared_ptr<executor> resume_executor) {
+    co_return co_await async_lock_awaiter(*this, std::move(resume_executor), true);
 }
 
 concurrencpp::lazy_result<scoped_async_lock> async_lock::lock(std::shared_ptr<executor> resume_executor) {
@@ -93,21 +200,20 @@ concurrencpp::lazy_result<scoped_async_lock> async_lock::lock(std::shared_ptr<ex
         throw std::invalid_argument(details::consts::k_async_lock_null_resume_executor_err_msg);
     }
 
-    return lock_impl(std::move(resume_executor), true);
+    return lock_impl(std::move(resume_executor));
 }
 
-concurrencpp::lazy_result<bool> async_lock::try_lock() {
-    auto res = false;
-
-    std::unique_lock<std::mutex> lock(m_awaiter_lock);
-    if (!m_locked) {
-        m_locked = true;
-        lock.unlock();
-        res = true;
-    } else {
-        lock.unlock();
+async_lock_awaiter async_lock::lock_awaitable(std::shared_ptr<executor> resume_executor) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_lock_null_resume_executor_err_msg);
     }
 
+    return {*this, std::move(resume_executor), true};
+}
+
+concurrencpp::lazy_result<bool> async_lock::try_lock() {
+    const auto res = try_acquire();
+
 #ifdef CRCPP_DEBUG_MODE
     if (res) {
         const auto current_count = m_thread_count_in_critical_section.fetch_add(1, std::memory_order_relaxed);
@@ -119,27 +225,18 @@ concurrencpp::lazy_result<bool> async_lock::try_lock() {
 }
 
 void async_lock::unlock() {
-    std::unique_lock<std::mutex> lock(m_awaiter_lock);
-    if (!m_locked) {  // trying to unlocked non-owned mutex
-        lock.unlock();
+    if (m_state.load(std::memory_order_relaxed) == k_not_locked) {  // trying to unlocked non-owned mutex
         throw std::system_error(static_cast<int>(std::errc::operation_not_permitted),
                                 std::system_category(),
                                 details::consts::k_async_lock_unlock_invalid_lock_err_msg);
     }
 
-    m_locked = false;
-
 #ifdef CRCPP_DEBUG_MODE
     const auto current_count = m_thread_count_in_critical_section.fetch_sub(1, std::memory_order_relaxed);
     assert(current_count == 1);
 #endif
 
-    const auto awaiter = m_awaiters.pop_front();
-    lock.unlock();
-
-    if (awaiter != nullptr) {
-        awaiter->retry();
-    }
+    release();
 }
 
 /*
@@ -173,7 +270,7 @@ concurrencpp::lazy_result<void> scoped_async_lock::lock(std::shared_ptr<executor
                                 std::system_category(),
                                 details::consts::k_scoped_async_lock_lock_deadlock_err_msg);
     } else {
-        co_await m_lock->lock_impl(std::move(resume_executor), false);
+        co_await details::async_lock_awaiter(*m_lock, std::move(resume_executor), false);
         m_owns = true;
     }
 }
@@ -0,0 +1,238 @@
+#include "concurrencpp/threads/constants.h"
+#include "concurrencpp/threads/async_semaphore.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/errors.h"
+#include "concurrencpp/results/promises.h"
+#include "concurrencpp/results/impl/consumer_context.h"
+
+using concurrencpp::result;
+using concurrencpp::async_semaphore;
+using concurrencpp::async_semaphore_permit;
+using concurrencpp::details::async_semaphore_awaiter;
+
+namespace concurrencpp::details {
+    namespace {
+        result<async_semaphore_permit> run_async_semaphore_awaiter(async_semaphore_awaiter awaiter) {
+            co_return co_await awaiter;
+        }
+    }  // namespace
+}  // namespace concurrencpp::details
+
+/*
+    async_semaphore_awaiter
+*/
+
+async_semaphore_awaiter::async_semaphore_awaiter(async_semaphore& parent, std::shared_ptr<executor> resume_executor, size_t count) noexcept :
+    m_parent(parent), m_resume_executor(std::move(resume_executor)), m_count(count) {}
+
+async_semaphore_awaiter::async_semaphore_awaiter(async_semaphore_awaiter&& rhs) noexcept :
+    m_parent(rhs.m_parent), m_resume_executor(std::move(rhs.m_resume_executor)), m_count(rhs.m_count) {
+    assert(!static_cast<bool>(rhs.m_caller_handle) && "concurrencpp::async_semaphore_awaiter is moved while being awaited.");
+}
+
+bool async_semaphore_awaiter::await_ready() noexcept {
+    return m_parent.try_acquire(m_count);
+}
+
+bool async_semaphore_awaiter::await_suspend(coroutine_handle<void> caller_handle) {
+    assert(static_cast<bool>(caller_handle));
+    assert(!caller_handle.done());
+
+    m_caller_handle = caller_handle;
+    return m_parent.enqueue_awaiter(*this);
+}
+
+async_semaphore_permit async_semaphore_awaiter::await_resume() {
+    if (m_interrupted) {
+        // the permits were handed to this awaiter but resume_executor could not resume it, give them back.
+        m_parent.release(m_count);
+        throw errors::broken_task(details::consts::k_broken_task_exception_error_msg);
+    }
+
+    return {m_parent, m_count};
+}
+
+void async_semaphore_awaiter::resume() noexcept {
+    assert(static_cast<bool>(m_caller_handle));
+    assert(static_cast<bool>(m_resume_executor));
+
+    try {
+        m_resume_executor->post(await_via_functor {m_caller_handle, &m_interrupted});
+    } catch (...) {
+        // the caller was resumed inline by ~await_via_functor with m_interrupted = true
+    }
+}
+
+result<async_semaphore_permit> async_semaphore_awaiter::run() {
+    return details::run_async_semaphore_awaiter(std::move(*this));
+}
+
+/*
+    async_semaphore
+*/
+
+async_semaphore::async_semaphore(size_t initial_permits) noexcept : m_state(initial_permits * k_permit) {}
+
+async_semaphore::~async_semaphore() noexcept {
+#ifdef CRCPP_DEBUG_MODE
+    std::unique_lock<std::mutex> lock(m_lock);
+    assert(m_waiters.empty() && "concurrencpp::async_semaphore is deleted while being used.");
+#endif
+}
+
+bool async_semaphore::enqueue_awaiter(details::async_semaphore_awaiter& awaiter) {
+    std::unique_lock<std::mutex> lock(m_lock);
+    auto state = m_state.load(std::memory_order_relaxed);
+
+    while (true) {
+        // new acquirers don't overtake coroutines that are already waiting
+        const auto must_wait = ((state & k_waiters) != 0) || (state / k_permit < awaiter.m_count);
+
+        if (!must_wait) {
+            if (m_state.compare_exchange_weak(state, state - awaiter.m_count * k_permit, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return false;
+            }
+
+            continue;
+        }
+
+        if (m_state.compare_exchange_weak(state, state | k_waiters, std::memory_order_relaxed, std::memory_order_relaxed)) {
+            m_waiters.push_back(awaiter);
+            return true;
+        }
+    }
+}
+
+void async_semaphore::resume_waiters() {
+    details::slist<details::async_semaphore_awaiter> ready_waiters;
+
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        auto state = m_state.load(std::memory_order_acquire);
+
+        // waiters are served in FIFO order, as long as the available permits cover the next waiter
+        while ((state & k_waiters) != 0) {
+            const auto waiter = m_waiters.front();
+            assert(waiter != nullptr);
+
+            if (state / k_permit < waiter->m_count) {
+                break;
+            }
+
+            auto new_state = state - waiter->m_count * k_permit;
+            if (waiter->next == nullptr) {
+                new_state &= ~k_waiters;  // this is the last waiter
+            }
+
+            // releasers may add permits concurrently, so the state is only changed with a CAS
+            if (!m_state.compare_exchange_weak(state, new_state, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                continue;
+            }
+
+            m_waiters.pop_front();
+            waiter->next = nullptr;
+            ready_waiters.push_back(*waiter);
+            state = new_state;
+        }
+    }
+
+    while (true) {
+        const auto waiter = ready_waiters.pop_front();
+        if (waiter == nullptr) {
+            return;
+        }
+
+        waiter->resume();
+    }
+}
+
+concurrencpp::details::async_semaphore_awaiter async_semaphore::acquire(std::shared_ptr<executor> resume_executor, size_t count) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_semaphore_acquire_null_resume_executor_err_msg);
+    }
+
+    return {*this, std::move(resume_executor), count};
+}
+
+bool async_semaphore::try_acquire(size_t count) noexcept {
+    auto state = m_state.load(std::memory_order_relaxed);
+
+    while (((state & k_waiters) == 0) && (state / k_permit >= count)) {
+        if (m_state.compare_exchange_weak(state, state - count * k_permit, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void async_semaphore::release(size_t count) {
+    if (count == 0) {
+        return;
+    }
+
+    const auto prev_state = m_state.fetch_add(count * k_permit, std::memory_order_release);
+    if ((prev_state & k_waiters) != 0) {
+        resume_waiters();
+    }
+}
+
+size_t async_semaphore::available_permits() const noexcept {
+    return m_state.load(std::memory_order_relaxed) / k_permit;
+}
+
+/*
+    async_semaphore_permit
+*/
+
+async_semaphore_permit::async_semaphore_permit(async_semaphore_permit&& rhs) noexcept :
+    m_semaphore(std::exchange(rhs.m_semaphore, nullptr)), m_count(std::exchange(rhs.m_count, 0)) {}
+
+async_semaphore_permit::async_semaphore_permit(async_semaphore& semaphore, size_t count) noexcept :
+    m_semaphore(&semaphore), m_count(count) {}
+
+async_semaphore_permit::~async_semaphore_permit() noexcept {
+    if (m_semaphore != nullptr) {
+        m_semaphore->release(m_count);
+    }
+}
+
+async_semaphore_permit& async_semaphore_permit::operator=(async_semaphore_permit&& rhs) noexcept {
+    if (this != &rhs) {
+        async_semaphore_permit(std::move(rhs)).swap(*this);
+    }
+
+    return *this;
+}
+
+void async_semaphore_permit::release() {
+    if (m_semaphore == nullptr) {
+        throw std::system_error(static_cast<int>(std::errc::operation_not_permitted),
+                                std::system_category(),
+                                details::consts::k_async_semaphore_permit_release_empty_permit_err_msg);
+    }
+
+    std::exchange(m_semaphore, nullptr)->release(std::exchange(m_count, 0));
+}
+
+size_t async_semaphore_permit::count() const noexcept {
+    return m_count;
+}
+
+async_semaphore_permit::operator bool() const noexcept {
+    return m_semaphore != nullptr;
+}
+
+void async_semaphore_permit::swap(async_semaphore_permit& rhs) noexcept {
+    std::swap(m_semaphore, rhs.m_semaphore);
+    std::swap(m_count, rhs.m_count);
+}
+
+concurrencpp::async_semaphore* async_semaphore_permit::detach() noexcept {
+    m_count = 0;
+    return std::exchange(m_semaphore, nullptr);
+}
+
+concurrencpp::async_semaphore* async_semaphore_permit::semaphore() const noexcept {
+    return m_semaphore;
+}
@@ -0,0 +1,397 @@
+#include "concurrencpp/threads/constants.h"
+#include "concurrencpp/threads/async_shared_mutex.h"
+#include "concurrencpp/executors/executor.h"
+#include "concurrencpp/errors.h"
+#include "concurrencpp/results/promises.h"
+#include "concurrencpp/results/impl/consumer_context.h"
+#include "concurrencpp/results/impl/resumption_batch.h"
+
+using concurrencpp::result;
+using concurrencpp::async_shared_mutex;
+using concurrencpp::scoped_async_shared_lock;
+using concurrencpp::scoped_async_unique_lock;
+using concurrencpp::details::async_shared_mutex_awaiter;
+using concurrencpp::details::async_shared_lock_awaiter;
+using concurrencpp::details::async_unique_lock_awaiter;
+
+namespace concurrencpp::details {
+    namespace {
+        template<class awaiter_type>
+        auto run_async_shared_mutex_awaiter(awaiter_type awaiter) -> result<decltype(awaiter.await_resume())> {
+            co_return co_await awaiter;
+        }
+
+        void throw_unlock_error(const char* error_message) {
+            throw std::system_error(static_cast<int>(std::errc::operation_not_permitted), std::system_category(), error_message);
+        }
+    }  // namespace
+}  // namespace concurrencpp::details
+
+/*
+    async_shared_mutex_awaiter
+*/
+
+async_shared_mutex_awaiter::async_shared_mutex_awaiter(async_shared_mutex& parent,
+                                                       std::shared_ptr<executor> resume_executor,
+                                                       bool shared) noexcept :
+    m_parent(parent),
+    m_resume_executor(std::move(resume_executor)), m_shared(shared) {}
+
+async_shared_mutex_awaiter::async_shared_mutex_awaiter(async_shared_mutex_awaiter&& rhs) noexcept :
+    m_parent(rhs.m_parent), m_resume_executor(std::move(rhs.m_resume_executor)), m_shared(rhs.m_shared) {
+    assert(!static_cast<bool>(rhs.m_caller_handle) && "concurrencpp::async_shared_mutex_awaiter is moved while being awaited.");
+}
+
+bool async_shared_mutex_awaiter::await_ready() noexcept {
+    return m_shared ? m_parent.try_lock_shared() : m_parent.try_lock();
+}
+
+bool async_shared_mutex_awaiter::await_suspend(coroutine_handle<void> caller_handle) {
+    assert(static_cast<bool>(caller_handle));
+    assert(!caller_handle.done());
+
+    m_caller_handle = caller_handle;
+    return m_shared ? m_parent.enqueue_reader(*this) : m_parent.enqueue_writer(*this);
+}
+
+void async_shared_mutex_awaiter::throw_if_interrupted() {
+    if (!m_interrupted) {
+        return;
+    }
+
+    // ownership was handed to this awaiter but resume_executor could not resume it, pass it on.
+    if (m_shared) {
+        m_parent.unlock_shared();
+    } else {
+        m_parent.unlock();
+    }
+
+    throw errors::broken_task(details::consts::k_broken_task_exception_error_msg);
+}
+
+void async_shared_mutex_awaiter::resume() noexcept {
+    assert(static_cast<bool>(m_caller_handle));
+    assert(static_cast<bool>(m_resume_executor));
+
+    try {
+        m_resume_executor->post(await_via_functor {m_caller_handle, &m_interrupted});
+    } catch (...) {
+        // the caller was resumed inline by ~await_via_functor with m_interrupted = true
+    }
+}
+
+async_shared_lock_awaiter::async_shared_lock_awaiter(async_shared_mutex& parent, std::shared_ptr<executor> resume_executor) noexcept :
+    async_shared_mutex_awaiter(parent, std::move(resume_executor), true) {}
+
+scoped_async_shared_lock async_shared_lock_awaiter::await_resume() {
+    throw_if_interrupted();
+    return {m_parent, std::adopt_lock};
+}
+
+result<scoped_async_shared_lock> async_shared_lock_awaiter::run() {
+    return details::run_async_shared_mutex_awaiter(std::move(*this));
+}
+
+async_unique_lock_awaiter::async_unique_lock_awaiter(async_shared_mutex& parent, std::shared_ptr<executor> resume_executor) noexcept :
+    async_shared_mutex_awaiter(parent, std::move(resume_executor), false) {}
+
+scoped_async_unique_lock async_unique_lock_awaiter::await_resume() {
+    throw_if_interrupted();
+    return {m_parent, std::adopt_lock};
+}
+
+result<scoped_async_unique_lock> async_unique_lock_awaiter::run() {
+    return details::run_async_shared_mutex_awaiter(std::move(*this));
+}
+
+/*
+    async_shared_mutex
+*/
+
+async_shared_mutex::async_shared_mutex() noexcept : m_state(0), m_waiting_reader_count(0) {}
+
+async_shared_mutex::~async_shared_mutex() noexcept {
+    assert(m_state.load(std::memory_order_relaxed) == 0 && "concurrencpp::async_shared_mutex is destroyed while it's locked.");
+}
+
+size_t async_shared_mutex::waiters_mask() const noexcept {
+    return (m_waiting_readers.empty() && m_waiting_writers.empty()) ? 0 : k_pending;
+}
+
+bool async_shared_mutex::enqueue_reader(details::async_shared_mutex_awaiter& awaiter) {
+    std::unique_lock<std::mutex> lock(m_lock);
+    auto state = m_state.load(std::memory_order_relaxed);
+
+    while (true) {
+        // writer preference: readers don't barge in front of waiting writers
+        const auto must_wait = ((state & k_writer) != 0) || !m_waiting_writers.empty();
+
+        if (!must_wait) {
+            if (m_state.compare_exchange_weak(state, state + k_reader, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return false;
+            }
+
+            continue;
+        }
+
+        if (m_state.compare_exchange_weak(state, state | k_pending, std::memory_order_relaxed, std::memory_order_relaxed)) {
+            m_waiting_readers.push_back(awaiter);
+            ++m_waiting_reader_count;
+            return true;
+        }
+    }
+}
+
+bool async_shared_mutex::enqueue_writer(details::async_shared_mutex_awaiter& awaiter) {
+    std::unique_lock<std::mutex> lock(m_lock);
+    auto state = m_state.load(std::memory_order_relaxed);
+
+    while (true) {
+        const auto must_wait = ((state & ~k_pending) != 0) || !m_waiting_writers.empty();
+
+        if (!must_wait) {
+            if (m_state.compare_exchange_weak(state, state | k_writer, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return false;
+            }
+
+            continue;
+        }
+
+        if (m_state.compare_exchange_weak(state, state | k_pending, std::memory_order_relaxed, std::memory_order_relaxed)) {
+            m_waiting_writers.push_back(awaiter);
+            return true;
+        }
+    }
+}
+
+void async_shared_mutex::on_readers_drained() {
+    std::unique_lock<std::mutex> lock(m_lock);
+
+    // while k_pending is set, the state can only be changed under m_lock
+    const auto state = m_state.load(std::memory_order_acquire);
+    if (state != k_pending) {
+        return;
+    }
+
+    // readers only wait behind an active or a waiting writer, so a writer must be waiting here.
+    const auto writer = m_waiting_writers.pop_front();
+    assert(writer != nullptr);
+
+    m_state.store(k_writer | waiters_mask(), std::memory_order_relaxed);
+    lock.unlock();
+
+    writer->resume();
+}
+
+void async_shared_mutex::on_writer_released() {
+    std::unique_lock<std::mutex> lock(m_lock);
+    assert(m_state.load(std::memory_order_relaxed) == (k_writer | k_pending));
+
+    // queued readers are admitted together, so readers and writers take turns and neither side starves.
+    if (!m_waiting_readers.empty()) {
+        auto readers = std::move(m_waiting_readers);
+        const auto reader_count = std::exchange(m_waiting_reader_count, 0);
+
+        m_state.store(reader_count * k_reader | waiters_mask(), std::memory_order_release);
+        lock.unlock();
+
+        resume_readers(readers);
+        return;
+    }
+
+    const auto writer = m_waiting_writers.pop_front();
+    assert(writer != nullptr);
+
+    m_state.store(k_writer | waiters_mask(), std::memory_order_release);
+    lock.unlock();
+
+    writer->resume();
+}
+
+void async_shared_mutex::resume_readers(details::slist<details::async_shared_mutex_awaiter>& readers) noexcept {
+    // readers that share a resume executor are enqueued to it as one batch
+    details::resumption_batch batch;
+
+    while (true) {
+        const auto reader = readers.pop_front();
+        if (reader == nullptr) {
+            return;
+        }
+
+        batch.add(reader->m_resume_executor, reader->m_caller_handle, &reader->m_interrupted);
+    }
+}
+
+concurrencpp::details::async_unique_lock_awaiter async_shared_mutex::lock(std::shared_ptr<executor> resume_executor) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_shared_mutex_lock_null_resume_executor_err_msg);
+    }
+
+    return {*this, std::move(resume_executor)};
+}
+
+bool async_shared_mutex::try_lock() noexcept {
+    auto expected = static_cast<size_t>(0);
+    return m_state.compare_exchange_strong(expected, k_writer, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+void async_shared_mutex::unlock() {
+    auto expected = k_writer;
+    if (m_state.compare_exchange_strong(expected, 0, std::memory_order_release, std::memory_order_relaxed)) {
+        return;
+    }
+
+    if ((expected & k_writer) == 0) {
+        details::throw_unlock_error(details::consts::k_async_shared_mutex_unlock_invalid_lock_err_msg);
+    }
+
+    on_writer_released();
+}
+
+concurrencpp::details::async_shared_lock_awaiter async_shared_mutex::lock_shared(std::shared_ptr<executor> resume_executor) {
+    if (!static_cast<bool>(resume_executor)) {
+        throw std::invalid_argument(details::consts::k_async_shared_mutex_lock_shared_null_resume_executor_err_msg);
+    }
+
+    return {*this, std::move(resume_executor)};
+}
+
+bool async_shared_mutex::try_lock_shared() noexcept {
+    auto state = m_state.load(std::memory_order_relaxed);
+
+    while ((state & (k_writer | k_pending)) == 0) {
+        if (m_state.compare_exchange_weak(state, state + k_reader, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void async_shared_mutex::unlock_shared() {
+    auto state = m_state.load(std::memory_order_relaxed);
+
+    do {
+        if (state < k_reader) {
+            details::throw_unlock_error(details::consts::k_async_shared_mutex_unlock_shared_invalid_lock_err_msg);
+        }
+    } while (!m_state.compare_exchange_weak(state, state - k_reader, std::memory_order_release, std::memory_order_relaxed));
+
+    if (state - k_reader == k_pending) {
+        on_readers_drained();  // the last reader left and coroutines are waiting
+    }
+}
+
+/*
+    scoped_async_shared_lock
+*/
+
+scoped_async_shared_lock::scoped_async_shared_lock(scoped_async_shared_lock&& rhs) noexcept :
+    m_mutex(std::exchange(rhs.m_mutex, nullptr)), m_owns(std::exchange(rhs.m_owns, false)) {}
+
+scoped_async_shared_lock::scoped_async_shared_lock(async_shared_mutex& mutex, std::adopt_lock_t) noexcept :
+    m_mutex(&mutex), m_owns(true) {}
+
+scoped_async_shared_lock::~scoped_async_shared_lock() noexcept {
+    if (m_owns && m_mutex != nullptr) {
+        m_mutex->unlock_shared();
+    }
+}
+
+scoped_async_shared_lock& scoped_async_shared_lock::operator=(scoped_async_shared_lock&& rhs) noexcept {
+    if (this != &rhs) {
+        scoped_async_shared_lock(std::move(rhs)).swap(*this);
+    }
+
+    return *this;
+}
+
+void scoped_async_shared_lock::unlock() {
+    if (!m_owns) {
+        details::throw_unlock_error(details::consts::k_scoped_async_shared_lock_unlock_invalid_lock_err_msg);
+    }
+
+    if (m_mutex != nullptr) {
+        m_mutex->unlock_shared();
+        m_owns = false;
+    }
+}
+
+bool scoped_async_shared_lock::owns_lock() const noexcept {
+    return m_owns;
+}
+
+scoped_async_shared_lock::operator bool() const noexcept {
+    return owns_lock();
+}
+
+void scoped_async_shared_lock::swap(scoped_async_shared_lock& rhs) noexcept {
+    std::swap(m_mutex, rhs.m_mutex);
+    std::swap(m_owns, rhs.m_owns);
+}
+
+async_shared_mutex* scoped_async_shared_lock::release() noexcept {
+    m_owns = false;
+    return std::exchange(m_mutex, nullptr);
+}
+
+async_shared_mutex* scoped_async_shared_lock::mutex() const noexcept {
+    return m_mutex;
+}
+
+/*
+    scoped_async_unique_lock
+*/
+
+scoped_async_unique_lock::scoped_async_unique_lock(scoped_async_unique_lock&& rhs) noexcept :
+    m_mutex(std::exchange(rhs.m_mutex, nullptr)), m_owns(std::exchange(rhs.m_owns, false)) {}
+
+scoped_async_unique_lock::scoped_async_unique_lock(async_shared_mutex& mutex, std::adopt_lock_t) noexcept :
+    m_mutex(&mutex), m_owns(true) {}
+
+scoped_async_unique_lock::~scoped_async_unique_lock() noexcept {
+    if (m_owns && m_mutex != nullptr) {
+        m_mutex->unlock();
+    }
+}
+
+scoped_async_unique_lock& scoped_async_unique_lock::operator=(scoped_async_unique_lock&& rhs) noexcept {
+    if (this != &rhs) {
+        scoped_async_unique_lock(std::move(rhs)).swap(*this);
+    }
+
+    return *this;
+}
+
+void scoped_async_unique_lock::unlock() {
+    if (!m_owns) {
+        details::throw_unlock_error(details::consts::k_scoped_async_unique_lock_unlock_invalid_lock_err_msg);
+    }
+
+    if (m_mutex != nullptr) {
+        m_mutex->unlock();
+        m_owns = false;
+    }
+}
+
+bool scoped_async_unique_lock::owns_lock() const noexcept {
+    return m_owns;
+}
+
+scoped_async_unique_lock::operator bool() const noexcept {
+    return owns_lock();
+}
+
+void scoped_async_unique_lock::swap(scoped_async_unique_lock& rhs) noexcept {
+    std::swap(m_mutex, rhs.m_mutex);
+    std::swap(m_owns, rhs.m_owns);
+}
+
+async_shared_mutex* scoped_async_unique_lock::release() noexcept {
+    m_owns = false;
+    return std::exchange(m_mutex, nullptr);
+}
+
+async_shared_mutex* scoped_async_unique_lock::mutex() const noexcept {
+    return m_mutex;
+}
@@ -7,6 +7,7 @@
 #include "concurrencpp/executors/executor.h"
 
 using concurrencpp::timer;
+using concurrencpp::missed_tick_policy;
 using concurrencpp::details::timer_state;
 using concurrencpp::details::timer_state_base;
 
@@ -14,21 +15,63 @@ timer_state_base::timer_state_base(size_t due_time,
                                    size_t frequency,
                                    std::shared_ptr<concurrencpp::executor> executor,
                                    std::weak_ptr<concurrencpp::timer_queue> timer_queue,
-                                   bool is_oneshot) noexcept :
+                                   bool is_oneshot,
+                                   concurrencpp::missed_tick_policy missed_tick_policy) noexcept :
     m_timer_queue(std::move(timer_queue)),
-    m_executor(std::move(executor)), m_due_time(due_time), m_frequency(frequency), m_deadline(make_deadline(milliseconds(due_time))),
-    m_cancelled(false), m_is_oneshot(is_oneshot) {
+    m_executor(std::move(executor)), m_due_time(due_time), m_frequency(frequency), m_skipped_ticks(0),
+    m_deadline(make_deadline(milliseconds(due_time))), m_cancelled(false), m_is_oneshot(is_oneshot),
+    m_missed_tick_policy(missed_tick_policy) {
     assert(static_cast<bool>(m_executor));
 }
 
-void timer_state_base::fire() {
+size_t timer_state_base::advance_deadline(const time_point now, const size_t frequency) noexcept {
+    if (frequency == 0) {
+        m_deadline = make_deadline(milliseconds(0));
+        return 0;
+    }
+
+    // ticks are scheduled against the original deadline, not against the time the timer was processed,
+    // so a late timer_queue thread doesn't shift the following ticks.
+    const auto period = milliseconds(frequency);
+    m_deadline += period;
+
+    if (m_deadline > now) {
+        return 0;
+    }
+
+    const auto missed_ticks = static_cast<size_t>((now - m_deadline) / period) + 1;
+    m_deadline += period * missed_ticks;
+    return missed_ticks;
+}
+
+void timer_state_base::fire(const time_point now) {
     const auto frequency = m_frequency.load(std::memory_order_relaxed);
-    m_deadline = make_deadline(milliseconds(frequency));
+    const auto missed_ticks = advance_deadline(now, frequency);
+
+    size_t tick_count = 1;
+    if (missed_ticks != 0) {
+        switch (m_missed_tick_policy) {
+            case missed_tick_policy::fire_once: {
+                m_skipped_ticks.fetch_add(missed_ticks, std::memory_order_relaxed);
+                break;
+            }
+
+            case missed_tick_policy::fire_all: {
+                tick_count += missed_ticks;
+                break;
+            }
+
+            case missed_tick_policy::skip: {
+                m_skipped_ticks.fetch_add(missed_ticks + 1, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
 
     assert(static_cast<bool>(m_executor));
 
-    m_executor->post([self = shared_from_this()]() mutable {
-        self->execute();
+    m_executor->post([self = shared_from_this(), tick_count]() mutable {
+        self->execute(tick_count);
     });
 }
 
@@ -88,6 +131,16 @@ void timer::set_frequency(std::chrono::milliseconds new_frequency) {
     return m_state->set_new_frequency(new_frequency.count());
 }
 
+concurrencpp::missed_tick_policy timer::get_missed_tick_policy() const {
+    throw_if_empty(details::consts::k_timer_empty_get_missed_tick_policy_err_msg);
+    return m_state->get_missed_tick_policy();
+}
+
+size_t timer::get_skipped_ticks() const {
+    throw_if_empty(details::consts::k_timer_empty_get_skipped_ticks_err_msg);
+    return m_state->get_skipped_ticks();
+}
+
 timer& timer::operator=(timer&& rhs) noexcept {
     if (this == &rhs) {
         return *this;
@@ -4,8 +4,10 @@
 #include "concurrencpp/coroutines/coroutine.h"
 #include "concurrencpp/executors/constants.h"
 #include "concurrencpp/executors/executor.h"
+#include "concurrencpp/results/impl/consumer_context.h"
 
 #include <set>
+#include <thread>
 #include <unordered_map>
 
 #include <cassert>
@@ -14,7 +16,9 @@ using namespace std::chrono;
 
 using concurrencpp::timer;
 using concurrencpp::timer_queue;
+using concurrencpp::details::delay_queue;
 using concurrencpp::details::timer_request;
+using concurrencpp::details::delay_awaitable;
 using concurrencpp::details::timer_state_base;
 
 using timer_ptr = timer_queue::timer_ptr;
@@ -116,7 +120,7 @@ namespace concurrencpp::details {
                     // we fire it only if it's not cancelled
                     const auto cancelled = timer_ptr->cancelled();
                     if (!cancelled) {
-                        (*temp_it)->fire();
+                        (*temp_it)->fire(now);
                     }
 
                     if (is_oneshot || cancelled) {
@@ -145,12 +149,190 @@ namespace concurrencpp::details {
     }  // namespace
 }  // namespace concurrencpp::details
 
+/*
+    delay_awaitable
+*/
+
+delay_awaitable::delay_awaitable(timer_queue& parent_queue,
+                                 concurrencpp::executor& executor,
+                                 std::chrono::milliseconds due_time) noexcept :
+    m_parent_queue(parent_queue), m_executor(executor), m_due_time(due_time) {}
+
+delay_awaitable::~delay_awaitable() noexcept {
+    // the awaiting coroutine was destroyed before the delay fired, unlink the node before the frame goes away.
+    if (m_status.load(std::memory_order_acquire) == status::pending) {
+        m_parent_queue.remove_delay(*this);
+    }
+
+    // the delay expired in the meantime, the timer queue still reads the node until fire() or interrupt() are done with it.
+    while (m_status.load(std::memory_order_acquire) == status::firing) {
+        std::this_thread::yield();
+    }
+}
+
+bool delay_awaitable::await_suspend(coroutine_handle<void> caller_handle) {
+    assert(static_cast<bool>(caller_handle));
+    assert(!caller_handle.done());
+
+    m_caller_handle = caller_handle;
+    if (m_parent_queue.add_delay(*this)) {
+        return true;
+    }
+
+    m_interrupted = true;
+    return false;
+}
+
+void delay_awaitable::await_resume() const {
+    if (m_interrupted) {
+        throw errors::broken_task(details::consts::k_broken_task_exception_error_msg);
+    }
+}
+
+void delay_awaitable::fire() noexcept {
+    auto& executor = m_executor;
+    const auto caller_handle = m_caller_handle;
+    const auto interrupted = &m_interrupted;
+
+    // from this point on, the node is not touched and the frame may go away.
+    m_status.store(status::fired, std::memory_order_release);
+
+    try {
+        executor.post(await_via_functor {caller_handle, interrupted});
+    } catch (...) {
+        // do nothing. ~await_via_functor will resume the coroutine and throw an exception.
+    }
+}
+
+void delay_awaitable::interrupt() noexcept {
+    const auto caller_handle = m_caller_handle;
+    m_interrupted = true;
+    m_status.store(status::fired, std::memory_order_release);
+    caller_handle();
+}
+
+/*
+    delay_queue
+*/
+
+void delay_queue::place(delay_awaitable* node, size_t index) noexcept {
+    m_heap[index] = node;
+    node->m_heap_index = index;
+}
+
+void delay_queue::sift_up(size_t index) noexcept {
+    const auto node = m_heap[index];
+
+    while (index != 0) {
+        const auto parent = (index - 1) / 2;
+        if (!(node->m_deadline < m_heap[parent]->m_deadline)) {
+            break;
+        }
+
+        place(m_heap[parent], index);
+        index = parent;
+    }
+
+    place(node, index);
+}
+
+void delay_queue::sift_down(size_t index) noexcept {
+    const auto size = m_heap.size();
+    const auto node = m_heap[index];
+
+    while (true) {
+        auto child = index * 2 + 1;
+        if (child >= size) {
+            break;
+        }
+
+        if ((child + 1 < size) && (m_heap[child + 1]->m_deadline < m_heap[child]->m_deadline)) {
+            ++child;
+        }
+
+        if (!(m_heap[child]->m_deadline < node->m_deadline)) {
+            break;
+        }
+
+        place(m_heap[child], index);
+        index = child;
+    }
+
+    place(node, index);
+}
+
+void delay_queue::remove_at(size_t index) noexcept {
+    assert(index < m_heap.size());
+
+    m_heap[index]->m_heap_index = static_cast<size_t>(-1);
+    const auto last = m_heap.back();
+    m_heap.pop_back();
+
+    if (index == m_heap.size()) {
+        return;  // the removed node was the last one
+    }
+
+    place(last, index);
+
+    if ((index != 0) && (last->m_deadline < m_heap[(index - 1) / 2]->m_deadline)) {
+        sift_up(index);
+    } else {
+        sift_down(index);
+    }
+}
+
+delay_queue::time_point delay_queue::next_deadline() const noexcept {
+    assert(!m_heap.empty());
+    return m_heap.front()->m_deadline;
+}
+
+bool delay_queue::push(delay_awaitable& node) {
+    m_heap.emplace_back(&node);
+    sift_up(m_heap.size() - 1);
+    return node.m_heap_index == 0;
+}
+
+void delay_queue::remove(delay_awaitable& node) noexcept {
+    assert(node.m_heap_index < m_heap.size());
+    assert(m_heap[node.m_heap_index] == &node);
+    remove_at(node.m_heap_index);
+}
+
+concurrencpp::details::slist<delay_awaitable> delay_queue::pop_expired(time_point now) noexcept {
+    slist<delay_awaitable> expired;
+
+    while (!m_heap.empty() && (m_heap.front()->m_deadline <= now)) {
+        const auto node = m_heap.front();
+        remove_at(0);
+
+        node->next = nullptr;
+        node->m_status.store(delay_awaitable::status::firing, std::memory_order_release);
+        expired.push_back(*node);
+    }
+
+    return expired;
+}
+
+concurrencpp::details::slist<delay_awaitable> delay_queue::pop_all() noexcept {
+    slist<delay_awaitable> nodes;
+
+    for (const auto node : m_heap) {
+        node->m_heap_index = static_cast<size_t>(-1);
+        node->next = nullptr;
+        node->m_status.store(delay_awaitable::status::firing, std::memory_order_release);
+        nodes.push_back(*node);
+    }
+
+    m_heap.clear();
+    return nodes;
+}
+
 timer_queue::timer_queue(milliseconds max_waiting_time,
                          const std::function<void(std::string_view thread_name)>& thread_started_callback,
                          const std::function<void(std::string_view thread_name)>& thread_terminated_callback) :
     m_thread_started_callback(thread_started_callback),
-    m_thread_terminated_callback(thread_terminated_callback), m_atomic_abort(false), m_abort(false), m_idle(true),
-    m_max_waiting_time(max_waiting_time) {}
+    m_thread_terminated_callback(thread_terminated_callback), m_atomic_abort(false), m_delays_changed(false), m_abort(false),
+    m_idle(true), m_max_waiting_time(max_waiting_time) {}
 
 timer_queue::~timer_queue() noexcept {
     shutdown();
@@ -189,15 +371,110 @@ void timer_queue::add_timer(std::unique_lock<std::mutex>& lock, timer_ptr new_ti
     }
 }
 
+void timer_queue::add_timers(std::span<timer_ptr> new_timers) {
+    std::unique_lock<std::mutex> lock(m_lock);
+    if (m_abort) {
+        throw errors::runtime_shutdown(details::consts::k_timer_queue_shutdown_err_msg);
+    }
+
+    m_request_queue.reserve(m_request_queue.size() + new_timers.size());
+
+    auto old_thread = ensure_worker_thread(lock);
+    for (auto& new_timer : new_timers) {
+        m_request_queue.emplace_back(new_timer, timer_request::add);
+    }
+
+    lock.unlock();
+    m_condition.notify_one();
+
+    if (old_thread.joinable()) {
+        old_thread.join();
+    }
+}
+
+void timer_queue::cancel_timers(std::span<timer> timers) {
+    std::vector<timer_ptr> removed_timers;
+    removed_timers.reserve(timers.size());
+
+    for (auto& timer : timers) {
+        if (!static_cast<bool>(timer)) {
+            continue;
+        }
+
+        if (timer.m_state->get_timer_queue().lock().get() != this) {
+            timer.cancel();  // belongs to another timer_queue
+            continue;
+        }
+
+        auto state = std::move(timer.m_state);
+        state->cancel();
+        removed_timers.emplace_back(std::move(state));
+    }
+
+    if (removed_timers.empty()) {
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_request_queue.reserve(m_request_queue.size() + removed_timers.size());
+
+        for (auto& removed_timer : removed_timers) {
+            m_request_queue.emplace_back(std::move(removed_timer), timer_request::remove);
+        }
+    }
+
+    m_condition.notify_one();
+}
+
+bool timer_queue::add_delay(details::delay_awaitable& delay) {
+    std::unique_lock<std::mutex> lock(m_lock);
+    if (m_abort) {
+        return false;
+    }
+
+    delay.m_deadline = clock_type::now() + delay.m_due_time;
+    const auto is_closest = m_delays.push(delay);
+    delay.m_status.store(details::delay_awaitable::status::pending, std::memory_order_release);
+
+    if (is_closest) {
+        m_delays_changed = true;
+    }
+
+    // once the lock is released, the delay might fire and the awaiting coroutine might be resumed and destroyed.
+    auto old_thread = ensure_worker_thread(lock);
+    lock.unlock();
+
+    if (is_closest) {
+        m_condition.notify_one();
+    }
+
+    if (old_thread.joinable()) {
+        old_thread.join();
+    }
+
+    return true;
+}
+
+void timer_queue::remove_delay(details::delay_awaitable& delay) noexcept {
+    std::unique_lock<std::mutex> lock(m_lock);
+    if (delay.m_status.load(std::memory_order_relaxed) != details::delay_awaitable::status::pending) {
+        return;  // fired or interrupted in the meantime
+    }
+
+    m_delays.remove(delay);
+    delay.m_status.store(details::delay_awaitable::status::idle, std::memory_order_relaxed);
+}
+
 void timer_queue::work_loop() {
     time_point next_deadline;
     details::timer_queue_internal internal_state;
 
     while (true) {
         std::unique_lock<decltype(m_lock)> lock(m_lock);
-        if (internal_state.empty()) {
+        if (internal_state.empty() && m_delays.empty()) {
             const auto res = m_condition.wait_for(lock, m_max_waiting_time, [this] {
-                return !m_request_queue.empty() || m_abort;
+                return !m_request_queue.empty() || m_delays_changed || m_abort;
             });
 
             if (!res) {
@@ -207,8 +484,15 @@ void timer_queue::work_loop() {
             }
 
         } else {
-            m_condition.wait_until(lock, next_deadline, [this] {
-                return !m_request_queue.empty() || m_abort;
+            auto deadline = next_deadline;
+            if (internal_state.empty()) {
+                deadline = m_delays.next_deadline();
+            } else if (!m_delays.empty()) {
+                deadline = std::min(deadline, m_delays.next_deadline());
+            }
+
+            m_condition.wait_until(lock, deadline, [this] {
+                return !m_request_queue.empty() || m_delays_changed || m_abort;
             });
         }
 
@@ -217,8 +501,19 @@ void timer_queue::work_loop() {
         }
 
         auto request_queue = std::move(m_request_queue);
+        auto expired_delays = m_delays.pop_expired(clock_type::now());
+        m_delays_changed = false;
         lock.unlock();
 
+        while (true) {
+            const auto delay = expired_delays.pop_front();
+            if (delay == nullptr) {
+                break;
+            }
+
+            delay->fire();
+        }
+
         next_deadline = internal_state.process_timers(request_queue);
         const auto now = clock_type::now();
         if (next_deadline <= now) {
@@ -240,7 +535,10 @@ void timer_queue::shutdown() {
     std::unique_lock<std::mutex> lock(m_lock);
     m_abort = true;
 
+    auto pending_delays = m_delays.pop_all();
+
     if (!m_worker.joinable()) {
+        assert(pending_delays.empty());
         return;  // nothing to shut down
     }
 
@@ -249,6 +547,15 @@ void timer_queue::shutdown() {
 
     m_condition.notify_all();
     m_worker.join();
+
+    while (true) {
+        const auto delay = pending_delays.pop_front();
+        if (delay == nullptr) {
+            break;
+        }
+
+        delay->interrupt();
+    }
 }
 
 concurrencpp::details::thread timer_queue::ensure_worker_thread(std::unique_lock<std::mutex>& lock) {
@@ -272,44 +579,10 @@ concurrencpp::details::thread timer_queue::ensure_worker_thread(std::unique_lock
 }
 
 concurrencpp::lazy_result<void> timer_queue::make_delay_object_impl(std::chrono::milliseconds due_time,
-                                                                    std::shared_ptr<concurrencpp::timer_queue> self,
+                                                                    [[maybe_unused]] std::shared_ptr<concurrencpp::timer_queue> self,
                                                                     std::shared_ptr<concurrencpp::executor> executor) {
-    class delay_object_awaitable : public details::suspend_always {
-
-       private:
-        const size_t m_due_time_ms;
-        timer_queue& m_parent_queue;
-        std::shared_ptr<concurrencpp::executor> m_executor;
-        bool m_interrupted = false;
-
-       public:
-        delay_object_awaitable(size_t due_time_ms,
-                               timer_queue& parent_queue,
-                               std::shared_ptr<concurrencpp::executor> executor) noexcept :
-            m_due_time_ms(due_time_ms),
-            m_parent_queue(parent_queue), m_executor(std::move(executor)) {}
-
-        void await_suspend(details::coroutine_handle<void> coro_handle) noexcept {
-            try {
-                m_parent_queue.make_timer_impl(m_due_time_ms,
-                                               0,
-                                               std::move(m_executor),
-                                               true,
-                                               details::await_via_functor {coro_handle, &m_interrupted});
-
-            } catch (...) {
-                // do nothing. ~await_via_functor will resume the coroutine and throw an exception.
-            }
-        }
-
-        void await_resume() const {
-            if (m_interrupted) {
-                throw errors::broken_task(details::consts::k_broken_task_exception_error_msg);
-            }
-        }
-    };
-
-    co_await delay_object_awaitable {static_cast<size_t>(due_time.count()), *this, std::move(executor)};
+    // self keeps *this alive for as long as the delay_awaitable references it
+    co_await details::delay_awaitable {*this, *executor, due_time};
 }
 
 concurrencpp::lazy_result<void> timer_queue::make_delay_object(std::chrono::milliseconds due_time,
@@ -321,6 +594,15 @@ concurrencpp::lazy_result<void> timer_queue::make_delay_object(std::chrono::mill
     return make_delay_object_impl(due_time, shared_from_this(), std::move(executor));
 }
 
+concurrencpp::details::delay_awaitable timer_queue::make_delay_awaitable(std::chrono::milliseconds due_time,
+                                                                        const std::shared_ptr<concurrencpp::executor>& executor) {
+    if (!static_cast<bool>(executor)) {
+        throw std::invalid_argument(details::consts::k_timer_queue_make_delay_awaitable_executor_null_err_msg);
+    }
+
+    return {*this, *executor, due_time};
+}
+
 milliseconds timer_queue::max_worker_idle_time() const noexcept {
     return m_max_waiting_time;
 }
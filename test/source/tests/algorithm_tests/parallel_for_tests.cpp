@@ -0,0 +1,333 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/custom_exception.h"
+#include "utils/executor_shutdowner.h"
+
+#include <mutex>
+#include <thread>
+#include <numeric>
+#include <unordered_set>
+
+using namespace concurrencpp::tests;
+
+namespace concurrencpp::tests {
+    void test_parallel_for_null_executor();
+    void test_parallel_for_empty_range();
+    void test_parallel_for_laziness();
+    void test_parallel_for_visits_every_element_once();
+    void test_parallel_for_views();
+    void test_parallel_for_exception();
+    void test_parallel_for_shutdown_executor();
+    void test_parallel_for_uses_idle_workers();
+
+    void test_parallel_transform_null_executor();
+    void test_parallel_transform_to_vector();
+    void test_parallel_transform_to_iterator();
+    void test_parallel_transform_exception();
+}  // namespace concurrencpp::tests
+
+namespace concurrencpp::tests {
+    constexpr size_t k_sizes[] = {1, 7, 64, 1'000, 100'003};
+    constexpr size_t k_grain_sizes[] = {0, 1, 17, 4'096};
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_parallel_for_null_executor() {
+    std::vector<int> values(10);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&values] {
+            parallel_for({}, values, [](int) {});
+        },
+        concurrencpp::details::consts::k_parallel_for_null_executor_err_msg);
+}
+
+void concurrencpp::tests::test_parallel_for_empty_range() {
+    runtime runtime;
+    std::vector<int> values;
+    bool called = false;
+
+    parallel_for(runtime.thread_pool_executor(), values, [&called](int) {
+        called = true;
+    }).run().get();
+
+    assert_false(called);
+}
+
+void concurrencpp::tests::test_parallel_for_laziness() {
+    runtime runtime;
+    std::vector<size_t> values(1'024);
+
+    {
+        auto lazy = parallel_for(runtime.thread_pool_executor(), values, [](size_t& value) {
+            value = 1;
+        });
+
+        // nothing runs until the lazy_result is awaited
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        assert_equal(std::accumulate(values.begin(), values.end(), size_t(0)), static_cast<size_t>(0));
+
+        lazy.run().get();
+    }
+
+    assert_equal(std::accumulate(values.begin(), values.end(), size_t(0)), values.size());
+}
+
+void concurrencpp::tests::test_parallel_for_visits_every_element_once() {
+    runtime runtime;
+
+    for (const auto size : k_sizes) {
+        for (const auto grain_size : k_grain_sizes) {
+            std::vector<size_t> values(size);
+            parallel_for(
+                runtime.thread_pool_executor(),
+                values,
+                [](size_t& value) {
+                    ++value;
+                },
+                grain_size)
+                .run()
+                .get();
+
+            for (const auto value : values) {
+                assert_equal(value, static_cast<size_t>(1));
+            }
+        }
+    }
+}
+
+void concurrencpp::tests::test_parallel_for_views() {
+    runtime runtime;
+    constexpr size_t count = 10'000;
+
+    // an rvalue view is owned by the algorithm
+    std::vector<std::atomic_size_t> counters(count);
+    parallel_for(runtime.thread_pool_executor(), std::views::iota(size_t(0), count), [&counters](size_t i) {
+        counters[i].fetch_add(1, std::memory_order_relaxed);
+    }).run().get();
+
+    for (const auto& counter : counters) {
+        assert_equal(counter.load(), static_cast<size_t>(1));
+    }
+
+    // an owned container
+    std::atomic_size_t sum = 0;
+    std::vector<size_t> values(count);
+    std::iota(values.begin(), values.end(), size_t(0));
+
+    parallel_for(runtime.thread_pool_executor(), std::move(values), [&sum](size_t value) {
+        sum.fetch_add(value, std::memory_order_relaxed);
+    }).run().get();
+
+    assert_equal(sum.load(), count * (count - 1) / 2);
+}
+
+void concurrencpp::tests::test_parallel_for_exception() {
+    runtime runtime;
+    std::vector<size_t> values(100'000);
+    std::iota(values.begin(), values.end(), size_t(0));
+
+    auto loop = [](std::shared_ptr<thread_pool_executor> executor, std::vector<size_t>& values) -> result<void> {
+        co_await parallel_for(executor, values, [](size_t value) {
+            if (value == 12'345) {
+                throw custom_exception(static_cast<intptr_t>(value));
+            }
+        });
+    };
+
+    try {
+        loop(runtime.thread_pool_executor(), values).get();
+    } catch (const custom_exception& e) {
+        assert_equal(e.id, static_cast<intptr_t>(12'345));
+        return;
+    }
+
+    assert_false(true);
+}
+
+void concurrencpp::tests::test_parallel_for_shutdown_executor() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 2, std::chrono::seconds(10));
+    executor->shutdown();
+
+    std::vector<int> values(16);
+    auto lazy = parallel_for(executor, values, [](int&) {});
+
+    assert_throws<errors::broken_task>([&lazy] {
+        lazy.run().get();
+    });
+}
+
+void concurrencpp::tests::test_parallel_for_uses_idle_workers() {
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    std::mutex lock;
+    std::unordered_set<std::thread::id> thread_ids;
+    std::atomic_bool other_thread_seen = false;
+
+    std::vector<size_t> values(64);
+    std::iota(values.begin(), values.end(), size_t(0));
+
+    parallel_for(
+        executor,
+        values,
+        [&](size_t value) {
+            {
+                std::unique_lock<std::mutex> guard(lock);
+                thread_ids.insert(std::this_thread::get_id());
+            }
+
+            if (value != 0) {
+                return;
+            }
+
+            // the range is split before the first element runs, so another worker processes the upper half
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (std::chrono::steady_clock::now() < deadline) {
+                std::unique_lock<std::mutex> guard(lock);
+                if (thread_ids.size() > 1) {
+                    other_thread_seen = true;
+                    return;
+                }
+
+                guard.unlock();
+                std::this_thread::yield();
+            }
+        },
+        1)
+        .run()
+        .get();
+
+    assert_true(other_thread_seen.load());
+}
+
+void concurrencpp::tests::test_parallel_transform_null_executor() {
+    std::vector<int> values(10);
+    std::vector<int> output(10);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&values] {
+            parallel_transform({}, values, [](int i) {
+                return i;
+            });
+        },
+        concurrencpp::details::consts::k_parallel_transform_null_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&values, &output] {
+            parallel_transform({}, values, output.begin(), [](int i) {
+                return i;
+            });
+        },
+        concurrencpp::details::consts::k_parallel_transform_null_executor_err_msg);
+}
+
+void concurrencpp::tests::test_parallel_transform_to_vector() {
+    runtime runtime;
+
+    for (const auto size : k_sizes) {
+        for (const auto grain_size : k_grain_sizes) {
+            std::vector<size_t> values(size);
+            std::iota(values.begin(), values.end(), size_t(0));
+
+            const auto results = parallel_transform(
+                                     runtime.thread_pool_executor(),
+                                     values,
+                                     [](size_t value) {
+                                         return std::to_string(value * 2);
+                                     },
+                                     grain_size)
+                                     .run()
+                                     .get();
+
+            assert_equal(results.size(), size);
+            for (size_t i = 0; i < size; i++) {
+                assert_equal(results[i], std::to_string(i * 2));
+            }
+        }
+    }
+
+    std::vector<int> empty;
+    const auto results = parallel_transform(runtime.thread_pool_executor(), empty, [](int i) {
+                             return i;
+                         }).run().get();
+
+    assert_true(results.empty());
+}
+
+void concurrencpp::tests::test_parallel_transform_to_iterator() {
+    runtime runtime;
+
+    for (const auto size : k_sizes) {
+        for (const auto grain_size : k_grain_sizes) {
+            std::vector<size_t> output(size);
+
+            parallel_transform(
+                runtime.thread_pool_executor(),
+                std::views::iota(size_t(0), size),
+                output.begin(),
+                [](size_t value) {
+                    return value * value;
+                },
+                grain_size)
+                .run()
+                .get();
+
+            for (size_t i = 0; i < size; i++) {
+                assert_equal(output[i], i * i);
+            }
+        }
+    }
+}
+
+void concurrencpp::tests::test_parallel_transform_exception() {
+    runtime runtime;
+
+    auto lazy = parallel_transform(runtime.thread_pool_executor(), std::views::iota(0, 50'000), [](int value) {
+        if (value == 49'999) {
+            throw custom_exception(value);
+        }
+
+        return value;
+    });
+
+    try {
+        lazy.run().get();
+    } catch (const custom_exception& e) {
+        assert_equal(e.id, static_cast<intptr_t>(49'999));
+        return;
+    }
+
+    assert_false(true);
+}
+
+int main() {
+    {
+        tester tester("parallel_for test");
+
+        tester.add_step("null executor", test_parallel_for_null_executor);
+        tester.add_step("empty range", test_parallel_for_empty_range);
+        tester.add_step("laziness", test_parallel_for_laziness);
+        tester.add_step("every element is visited once", test_parallel_for_visits_every_element_once);
+        tester.add_step("views", test_parallel_for_views);
+        tester.add_step("exception", test_parallel_for_exception);
+        tester.add_step("shut down executor", test_parallel_for_shutdown_executor);
+        tester.add_step("idle workers take part", test_parallel_for_uses_idle_workers);
+
+        tester.launch_test();
+    }
+
+    {
+        tester tester("parallel_transform test");
+
+        tester.add_step("null executor", test_parallel_transform_null_executor);
+        tester.add_step("std::vector result", test_parallel_transform_to_vector);
+        tester.add_step("output iterator", test_parallel_transform_to_iterator);
+        tester.add_step("exception", test_parallel_transform_exception);
+
+        tester.launch_test();
+    }
+
+    return 0;
+}
@@ -0,0 +1,282 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/custom_exception.h"
+#include "utils/executor_shutdowner.h"
+
+#include <random>
+#include <numeric>
+#include <algorithm>
+
+using namespace concurrencpp::tests;
+
+namespace concurrencpp::tests {
+    void test_parallel_reduce_null_executor();
+    void test_parallel_reduce_empty_range();
+    void test_parallel_reduce_sum();
+    void test_parallel_reduce_min_max();
+    void test_parallel_reduce_deterministic();
+    void test_parallel_reduce_exception();
+    void test_parallel_reduce_from_another_pool();
+
+    void test_parallel_transform_reduce_null_executor();
+    void test_parallel_transform_reduce_count();
+    void test_parallel_transform_reduce_non_contiguous_range();
+    void test_parallel_transform_reduce_exception();
+}  // namespace concurrencpp::tests
+
+namespace concurrencpp::tests {
+    constexpr size_t k_sizes[] = {1, 7, 8, 9, 64, 1'000, 100'003};
+    constexpr size_t k_grain_sizes[] = {0, 1, 17, 4'096};
+    constexpr bool k_orders[] = {false, true};
+
+    std::vector<double> make_random_doubles(size_t count) {
+        std::mt19937_64 engine(12345);
+        std::uniform_real_distribution<double> distribution(-1'000'000.0, 1'000'000.0);
+
+        std::vector<double> values(count);
+        for (auto& value : values) {
+            value = distribution(engine);
+        }
+
+        return values;
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_parallel_reduce_null_executor() {
+    std::vector<int> values(10);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&values] {
+            parallel_reduce({}, values, 0);
+        },
+        concurrencpp::details::consts::k_parallel_reduce_null_executor_err_msg);
+}
+
+void concurrencpp::tests::test_parallel_reduce_empty_range() {
+    runtime runtime;
+    std::vector<int> values;
+
+    for (const auto deterministic : k_orders) {
+        const auto result =
+            parallel_reduce(runtime.thread_pool_executor(), values, 1234, std::plus<> {}, {.deterministic = deterministic}).run().get();
+        assert_equal(result, 1234);
+    }
+}
+
+void concurrencpp::tests::test_parallel_reduce_sum() {
+    runtime runtime;
+
+    for (const auto size : k_sizes) {
+        std::vector<size_t> values(size);
+        std::iota(values.begin(), values.end(), size_t(1));
+        const auto expected = size * (size + 1) / 2 + 10;
+
+        for (const auto grain_size : k_grain_sizes) {
+            for (const auto deterministic : k_orders) {
+                const auto result = parallel_reduce(runtime.thread_pool_executor(),
+                                                    values,
+                                                    size_t(10),
+                                                    std::plus<> {},
+                                                    {.grain_size = grain_size, .deterministic = deterministic})
+                                        .run()
+                                        .get();
+
+                assert_equal(result, expected);
+            }
+        }
+    }
+}
+
+void concurrencpp::tests::test_parallel_reduce_min_max() {
+    runtime runtime;
+    auto values = make_random_doubles(250'000);
+
+    const auto max = parallel_reduce(runtime.thread_pool_executor(), values, values[0], [](double a, double b) {
+                         return std::max(a, b);
+                     }).run().get();
+
+    const auto min = parallel_reduce(runtime.thread_pool_executor(), values, values[0], [](double a, double b) {
+                         return std::min(a, b);
+                     }).run().get();
+
+    assert_equal(max, *std::max_element(values.begin(), values.end()));
+    assert_equal(min, *std::min_element(values.begin(), values.end()));
+}
+
+void concurrencpp::tests::test_parallel_reduce_deterministic() {
+    const auto values = make_random_doubles(1'000'003);
+
+    auto sum = [&values](size_t worker_count, size_t grain_size) {
+        auto executor = std::make_shared<thread_pool_executor>("threadpool", worker_count, std::chrono::seconds(10));
+        executor_shutdowner shutdown(executor);
+
+        return parallel_reduce(executor, values, 0.0, std::plus<> {}, {.grain_size = grain_size, .deterministic = true}).run().get();
+    };
+
+    for (const auto grain_size : {size_t(0), size_t(1'000)}) {
+        const auto expected = sum(1, grain_size);
+
+        for (const auto worker_count : {1, 2, 3, 8}) {
+            for (size_t i = 0; i < 5; i++) {
+                // floating point addition isn't associative: only a fixed combine order gives the exact same bits
+                assert_equal(sum(worker_count, grain_size), expected);
+            }
+        }
+    }
+}
+
+void concurrencpp::tests::test_parallel_reduce_exception() {
+    runtime runtime;
+    std::vector<int> values(100'000, 1);
+
+    for (const auto deterministic : k_orders) {
+        auto lazy = parallel_reduce(
+            runtime.thread_pool_executor(),
+            values,
+            0,
+            [](int a, int b) -> int {
+                if (a + b > 50'000) {
+                    throw custom_exception(a + b);
+                }
+
+                return a + b;
+            },
+            {.deterministic = deterministic});
+
+        assert_throws<custom_exception>([&lazy] {
+            lazy.run().get();
+        });
+    }
+}
+
+void concurrencpp::tests::test_parallel_reduce_from_another_pool() {
+    // a worker of one pool that waits for work it posted to another pool must not hold that work in its own queue
+    runtime runtime;
+    std::vector<size_t> values(100'000);
+    std::iota(values.begin(), values.end(), size_t(0));
+
+    const auto result = runtime.background_executor()
+                            ->submit([&] {
+                                return parallel_reduce(runtime.thread_pool_executor(), values, size_t(0)).run().get();
+                            })
+                            .get();
+
+    assert_equal(result, values.size() * (values.size() - 1) / 2);
+}
+
+void concurrencpp::tests::test_parallel_transform_reduce_null_executor() {
+    std::vector<int> values(10);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&values] {
+            parallel_transform_reduce({}, values, 0, std::plus<> {}, [](int i) {
+                return i;
+            });
+        },
+        concurrencpp::details::consts::k_parallel_transform_reduce_null_executor_err_msg);
+}
+
+void concurrencpp::tests::test_parallel_transform_reduce_count() {
+    runtime runtime;
+
+    for (const auto size : k_sizes) {
+        std::vector<int> values(size);
+        std::iota(values.begin(), values.end(), 0);
+        const auto expected = static_cast<size_t>(std::count_if(values.begin(), values.end(), [](int i) {
+            return i % 3 == 0;
+        }));
+
+        for (const auto grain_size : k_grain_sizes) {
+            for (const auto deterministic : k_orders) {
+                const auto result = parallel_transform_reduce(
+                                        runtime.thread_pool_executor(),
+                                        values,
+                                        size_t(0),
+                                        std::plus<> {},
+                                        [](int i) -> size_t {
+                                            return i % 3 == 0 ? 1 : 0;
+                                        },
+                                        {.grain_size = grain_size, .deterministic = deterministic})
+                                        .run()
+                                        .get();
+
+                assert_equal(result, expected);
+            }
+        }
+    }
+}
+
+void concurrencpp::tests::test_parallel_transform_reduce_non_contiguous_range() {
+    runtime runtime;
+    constexpr size_t count = 200'000;
+
+    for (const auto deterministic : k_orders) {
+        const auto result = parallel_transform_reduce(
+                                runtime.thread_pool_executor(),
+                                std::views::iota(size_t(0), count),
+                                std::string(),
+                                [](std::string a, std::string b) {
+                                    return a.size() > b.size() ? std::move(a) : std::move(b);
+                                },
+                                [](size_t i) {
+                                    return std::to_string(i);
+                                },
+                                {.deterministic = deterministic})
+                                .run()
+                                .get();
+
+        assert_equal(result.size(), std::to_string(count - 1).size());
+    }
+}
+
+void concurrencpp::tests::test_parallel_transform_reduce_exception() {
+    runtime runtime;
+
+    auto lazy = parallel_transform_reduce(runtime.thread_pool_executor(), std::views::iota(0, 50'000), 0, std::plus<> {}, [](int i) {
+        if (i == 40'000) {
+            throw custom_exception(i);
+        }
+
+        return i;
+    });
+
+    try {
+        lazy.run().get();
+    } catch (const custom_exception& e) {
+        assert_equal(e.id, static_cast<intptr_t>(40'000));
+        return;
+    }
+
+    assert_false(true);
+}
+
+int main() {
+    {
+        tester tester("parallel_reduce test");
+
+        tester.add_step("null executor", test_parallel_reduce_null_executor);
+        tester.add_step("empty range", test_parallel_reduce_empty_range);
+        tester.add_step("sum", test_parallel_reduce_sum);
+        tester.add_step("min + max", test_parallel_reduce_min_max);
+        tester.add_step("deterministic combine order", test_parallel_reduce_deterministic);
+        tester.add_step("exception", test_parallel_reduce_exception);
+        tester.add_step("called from another pool", test_parallel_reduce_from_another_pool);
+
+        tester.launch_test();
+    }
+
+    {
+        tester tester("parallel_transform_reduce test");
+
+        tester.add_step("null executor", test_parallel_transform_reduce_null_executor);
+        tester.add_step("count", test_parallel_transform_reduce_count);
+        tester.add_step("non contiguous range", test_parallel_transform_reduce_non_contiguous_range);
+        tester.add_step("exception", test_parallel_transform_reduce_exception);
+
+        tester.launch_test();
+    }
+
+    return 0;
+}
@@ -0,0 +1,241 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/custom_exception.h"
+#include "utils/executor_shutdowner.h"
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <random>
+#include <numeric>
+
+using namespace concurrencpp::tests;
+
+namespace concurrencpp::tests {
+    void test_parallel_inclusive_scan_null_executor();
+    void test_parallel_inclusive_scan_sum();
+    void test_parallel_inclusive_scan_in_place();
+    void test_parallel_inclusive_scan_non_commutative();
+    void test_parallel_inclusive_scan_exception();
+
+    void test_parallel_exclusive_scan_null_executor();
+    void test_parallel_exclusive_scan_sum();
+    void test_parallel_exclusive_scan_in_place();
+    void test_parallel_exclusive_scan_offsets();
+    void test_parallel_scan_runs_inside_executor();
+}  // namespace concurrencpp::tests
+
+namespace concurrencpp::tests {
+    constexpr size_t k_sizes[] = {0, 1, 7, 4'096, 4'097, 100'003, 1'000'000};
+    constexpr size_t k_worker_counts[] = {1, 3, 8};
+
+    std::vector<int64_t> make_random_integers(size_t count) {
+        std::mt19937 engine(static_cast<unsigned>(count));
+        std::uniform_int_distribution<int64_t> distribution(-1'000, 1'000);
+
+        std::vector<int64_t> values(count);
+        for (auto& value : values) {
+            value = distribution(engine);
+        }
+
+        return values;
+    }
+
+    template<class function_type>
+    void for_each_executor(function_type&& function) {
+        for (const auto worker_count : k_worker_counts) {
+            auto executor = std::make_shared<thread_pool_executor>("threadpool", worker_count, std::chrono::seconds(10));
+            executor_shutdowner shutdown(executor);
+            function(executor);
+        }
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_parallel_inclusive_scan_null_executor() {
+    std::vector<int> values(10);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&values] {
+            parallel_inclusive_scan({}, values, values.begin());
+        },
+        concurrencpp::details::consts::k_parallel_inclusive_scan_null_executor_err_msg);
+}
+
+void concurrencpp::tests::test_parallel_inclusive_scan_sum() {
+    for_each_executor([](std::shared_ptr<thread_pool_executor> executor) {
+        for (const auto size : k_sizes) {
+            const auto values = make_random_integers(size);
+            std::vector<int64_t> expected(size);
+            std::inclusive_scan(values.begin(), values.end(), expected.begin());
+
+            std::vector<int64_t> output(size);
+            parallel_inclusive_scan(executor, values, output.begin()).run().get();
+            assert_true(output == expected);
+        }
+    });
+}
+
+void concurrencpp::tests::test_parallel_inclusive_scan_in_place() {
+    for_each_executor([](std::shared_ptr<thread_pool_executor> executor) {
+        auto values = make_random_integers(250'000);
+        std::vector<int64_t> expected(values.size());
+        std::inclusive_scan(values.begin(), values.end(), expected.begin());
+
+        parallel_inclusive_scan(executor, values, values.begin()).run().get();
+        assert_true(values == expected);
+    });
+}
+
+void concurrencpp::tests::test_parallel_inclusive_scan_non_commutative() {
+    // 2x2 matrix multiplication is associative but not commutative
+    using matrix = std::array<int64_t, 4>;
+    const auto multiply = [](const matrix& a, const matrix& b) {
+        constexpr int64_t mod = 1'000'000'007;
+        return matrix {(a[0] * b[0] + a[1] * b[2]) % mod,
+                       (a[0] * b[1] + a[1] * b[3]) % mod,
+                       (a[2] * b[0] + a[3] * b[2]) % mod,
+                       (a[2] * b[1] + a[3] * b[3]) % mod};
+    };
+
+    const auto integers = make_random_integers(50'000);
+    std::vector<matrix> values;
+    values.reserve(integers.size());
+    for (const auto integer : integers) {
+        values.push_back(matrix {integer + 1'000, 1, 0, 1});
+    }
+
+    std::vector<matrix> expected(values.size());
+    std::inclusive_scan(values.begin(), values.end(), expected.begin(), multiply);
+
+    for_each_executor([&](std::shared_ptr<thread_pool_executor> executor) {
+        std::vector<matrix> output(values.size());
+        parallel_inclusive_scan(executor, values, output.begin(), multiply).run().get();
+        assert_true(output == expected);
+    });
+}
+
+void concurrencpp::tests::test_parallel_inclusive_scan_exception() {
+    runtime runtime;
+    std::vector<int> values(100'000, 1);
+    std::vector<int> output(values.size());
+
+    auto lazy = parallel_inclusive_scan(runtime.thread_pool_executor(), values, output.begin(), [](int a, int b) {
+        if (a + b == 70'000) {
+            throw custom_exception(a + b);
+        }
+
+        return a + b;
+    });
+
+    assert_throws<custom_exception>([&lazy] {
+        lazy.run().get();
+    });
+}
+
+void concurrencpp::tests::test_parallel_exclusive_scan_null_executor() {
+    std::vector<int> values(10);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&values] {
+            parallel_exclusive_scan({}, values, values.begin(), 0);
+        },
+        concurrencpp::details::consts::k_parallel_exclusive_scan_null_executor_err_msg);
+}
+
+void concurrencpp::tests::test_parallel_exclusive_scan_sum() {
+    for_each_executor([](std::shared_ptr<thread_pool_executor> executor) {
+        for (const auto size : k_sizes) {
+            const auto values = make_random_integers(size);
+            std::vector<int64_t> expected(size);
+            std::exclusive_scan(values.begin(), values.end(), expected.begin(), int64_t(1'234));
+
+            std::vector<int64_t> output(size);
+            parallel_exclusive_scan(executor, values, output.begin(), int64_t(1'234)).run().get();
+            assert_true(output == expected);
+        }
+    });
+}
+
+void concurrencpp::tests::test_parallel_exclusive_scan_in_place() {
+    for_each_executor([](std::shared_ptr<thread_pool_executor> executor) {
+        auto values = make_random_integers(250'000);
+        std::vector<int64_t> expected(values.size());
+        std::exclusive_scan(values.begin(), values.end(), expected.begin(), int64_t(0));
+
+        parallel_exclusive_scan(executor, values, values.begin(), int64_t(0)).run().get();
+        assert_true(values == expected);
+    });
+}
+
+void concurrencpp::tests::test_parallel_exclusive_scan_offsets() {
+    // packing variable length records: the offset of every record is the sum of the lengths before it
+    runtime runtime;
+    std::vector<uint32_t> lengths(300'000);
+    for (size_t i = 0; i < lengths.size(); i++) {
+        lengths[i] = static_cast<uint32_t>(i % 17 + 1);
+    }
+
+    std::vector<size_t> offsets(lengths.size());
+    parallel_exclusive_scan(runtime.thread_pool_executor(), lengths, offsets.begin(), size_t(0)).run().get();
+
+    size_t expected = 0;
+    for (size_t i = 0; i < lengths.size(); i++) {
+        assert_equal(offsets[i], expected);
+        expected += lengths[i];
+    }
+}
+
+void concurrencpp::tests::test_parallel_scan_runs_inside_executor() {
+    const auto caller_id = std::this_thread::get_id();
+
+    for (const auto size : k_sizes) {
+        for_each_executor([caller_id, size](auto executor) {
+            auto values = make_random_integers(size);
+            std::vector<int64_t> output(size);
+            std::atomic_bool scanned_in_caller = false;
+
+            const auto operation = [&](int64_t a, int64_t b) {
+                if (std::this_thread::get_id() == caller_id) {
+                    scanned_in_caller = true;
+                }
+
+                return a + b;
+            };
+
+            parallel_inclusive_scan(executor, values, output.begin(), operation).run().get();
+            parallel_exclusive_scan(executor, values, output.begin(), int64_t(0), operation).run().get();
+
+            assert_false(scanned_in_caller.load());
+        });
+    }
+}
+
+int main() {
+    {
+        tester tester("parallel_inclusive_scan test");
+
+        tester.add_step("null executor", test_parallel_inclusive_scan_null_executor);
+        tester.add_step("sum", test_parallel_inclusive_scan_sum);
+        tester.add_step("in place", test_parallel_inclusive_scan_in_place);
+        tester.add_step("non commutative operation", test_parallel_inclusive_scan_non_commutative);
+        tester.add_step("exception", test_parallel_inclusive_scan_exception);
+
+        tester.launch_test();
+    }
+
+    {
+        tester tester("parallel_exclusive_scan test");
+
+        tester.add_step("null executor", test_parallel_exclusive_scan_null_executor);
+        tester.add_step("sum", test_parallel_exclusive_scan_sum);
+        tester.add_step("in place", test_parallel_exclusive_scan_in_place);
+        tester.add_step("offsets", test_parallel_exclusive_scan_offsets);
+        tester.add_step("runs inside executor", test_parallel_scan_runs_inside_executor);
+
+        tester.launch_test();
+    }
+
+    return 0;
+}
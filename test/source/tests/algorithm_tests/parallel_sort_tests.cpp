@@ -0,0 +1,184 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/custom_exception.h"
+#include "utils/executor_shutdowner.h"
+
+#include <random>
+#include <algorithm>
+
+using namespace concurrencpp::tests;
+
+namespace concurrencpp::tests {
+    void test_parallel_sort_null_executor();
+    void test_parallel_sort_small_ranges();
+    void test_parallel_sort_random_integers();
+    void test_parallel_sort_duplicates();
+    void test_parallel_sort_presorted();
+    void test_parallel_sort_strings();
+    void test_parallel_sort_move_only();
+    void test_parallel_sort_exception();
+    void test_parallel_sort_runs_inside_executor();
+}  // namespace concurrencpp::tests
+
+namespace concurrencpp::tests {
+    constexpr size_t k_worker_counts[] = {1, 3, 8};
+
+    std::vector<int> make_random_integers(size_t count, int max_value) {
+        std::mt19937 engine(static_cast<unsigned>(count));
+        std::uniform_int_distribution<int> distribution(0, max_value);
+
+        std::vector<int> values(count);
+        for (auto& value : values) {
+            value = distribution(engine);
+        }
+
+        return values;
+    }
+
+    template<class type, class compare_type = std::less<>>
+    void sort_and_compare(std::vector<type> values, compare_type compare = {}) {
+        auto expected = values;
+        std::sort(expected.begin(), expected.end(), compare);
+
+        for (const auto worker_count : k_worker_counts) {
+            auto executor = std::make_shared<thread_pool_executor>("threadpool", worker_count, std::chrono::seconds(10));
+            executor_shutdowner shutdown(executor);
+
+            auto copy = values;
+            parallel_sort(executor, copy.begin(), copy.end(), compare).run().get();
+            assert_true(copy == expected);
+        }
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_parallel_sort_null_executor() {
+    std::vector<int> values(10);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&values] {
+            parallel_sort({}, values.begin(), values.end());
+        },
+        concurrencpp::details::consts::k_parallel_sort_null_executor_err_msg);
+}
+
+void concurrencpp::tests::test_parallel_sort_small_ranges() {
+    for (const auto size : {0, 1, 2, 7, 1'000, 16'384}) {
+        sort_and_compare(make_random_integers(size, 1'000'000));
+    }
+}
+
+void concurrencpp::tests::test_parallel_sort_random_integers() {
+    for (const auto size : {16'385, 100'000, 1'000'003}) {
+        sort_and_compare(make_random_integers(size, 1'000'000));
+        sort_and_compare(make_random_integers(size, 1'000'000), std::greater<> {});
+    }
+}
+
+void concurrencpp::tests::test_parallel_sort_duplicates() {
+    sort_and_compare(make_random_integers(500'000, 10));
+    sort_and_compare(std::vector<int>(500'000, 7));
+}
+
+void concurrencpp::tests::test_parallel_sort_presorted() {
+    std::vector<int> values(500'000);
+    std::iota(values.begin(), values.end(), 0);
+
+    sort_and_compare(values);
+    sort_and_compare(values, std::greater<> {});
+}
+
+void concurrencpp::tests::test_parallel_sort_strings() {
+    const auto integers = make_random_integers(200'000, 100'000'000);
+
+    std::vector<std::string> values;
+    values.reserve(integers.size());
+    for (const auto integer : integers) {
+        values.emplace_back(std::to_string(integer));
+    }
+
+    sort_and_compare(std::move(values));
+}
+
+void concurrencpp::tests::test_parallel_sort_move_only() {
+    runtime runtime;
+    const auto integers = make_random_integers(200'000, 1'000'000);
+
+    std::vector<std::unique_ptr<int>> values;
+    values.reserve(integers.size());
+    for (const auto integer : integers) {
+        values.emplace_back(std::make_unique<int>(integer));
+    }
+
+    parallel_sort(runtime.thread_pool_executor(), values.begin(), values.end(), [](const auto& a, const auto& b) {
+        return *a < *b;
+    }).run().get();
+
+    auto expected = integers;
+    std::sort(expected.begin(), expected.end());
+
+    for (size_t i = 0; i < expected.size(); i++) {
+        assert_true(static_cast<bool>(values[i]));
+        assert_equal(*values[i], expected[i]);
+    }
+}
+
+void concurrencpp::tests::test_parallel_sort_exception() {
+    runtime runtime;
+    auto values = make_random_integers(300'000, 1'000'000);
+
+    auto lazy = parallel_sort(runtime.thread_pool_executor(), values.begin(), values.end(), [](int a, int b) {
+        if (a == 1'000'001 || b == 1'000'001) {
+            throw custom_exception(1'000'001);
+        }
+
+        return a < b;
+    });
+
+    values[values.size() / 2] = 1'000'001;
+
+    assert_throws<custom_exception>([&lazy] {
+        lazy.run().get();
+    });
+}
+
+void concurrencpp::tests::test_parallel_sort_runs_inside_executor() {
+    const auto caller_id = std::this_thread::get_id();
+
+    for (const auto size : {1'000, 16'384, 500'000}) {
+        auto executor = std::make_shared<thread_pool_executor>("threadpool", 4, std::chrono::seconds(10));
+        executor_shutdowner shutdown(executor);
+
+        auto values = make_random_integers(size, 1'000'000);
+        std::atomic_bool compared_in_caller = false;
+
+        parallel_sort(executor, values.begin(), values.end(), [&](int a, int b) {
+            if (std::this_thread::get_id() == caller_id) {
+                compared_in_caller = true;
+            }
+
+            return a < b;
+        }).run().get();
+
+        assert_false(compared_in_caller.load());
+        assert_true(std::is_sorted(values.begin(), values.end()));
+    }
+}
+
+int main() {
+    tester tester("parallel_sort test");
+
+    tester.add_step("null executor", test_parallel_sort_null_executor);
+    tester.add_step("small ranges", test_parallel_sort_small_ranges);
+    tester.add_step("random integers", test_parallel_sort_random_integers);
+    tester.add_step("duplicates", test_parallel_sort_duplicates);
+    tester.add_step("presorted", test_parallel_sort_presorted);
+    tester.add_step("strings", test_parallel_sort_strings);
+    tester.add_step("move only type", test_parallel_sort_move_only);
+    tester.add_step("exception", test_parallel_sort_exception);
+    tester.add_step("runs inside executor", test_parallel_sort_runs_inside_executor);
+
+    tester.launch_test();
+    return 0;
+}
@@ -0,0 +1,208 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+
+#include "concurrencpp/threads/constants.h"
+
+namespace concurrencpp::tests {
+    void test_async_barrier_constructor();
+
+    void test_async_barrier_arrive_and_wait_null_resume_executor();
+    void test_async_barrier_arrive_and_wait_phase();
+    void test_async_barrier_arrive_and_wait_completion();
+    void test_async_barrier_arrive_and_wait_resumption_fails();
+    void test_async_barrier_arrive_and_wait();
+
+    void test_async_barrier_arrive_and_drop();
+
+    void test_async_barrier_mini_load_test();
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_barrier_constructor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_barrier barrier(0);
+        },
+        concurrencpp::details::consts::k_async_barrier_constructor_zero_expected_err_msg);
+
+    async_barrier barrier(1);
+    async_barrier barrier_with_completion(1, [] {
+    });
+}
+
+void concurrencpp::tests::test_async_barrier_arrive_and_wait_null_resume_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_barrier barrier(1);
+            barrier.arrive_and_wait(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_barrier_arrive_and_wait_null_resume_executor_err_msg);
+}
+
+void concurrencpp::tests::test_async_barrier_arrive_and_wait_phase() {
+    async_barrier barrier(3);
+    const auto ex = std::make_shared<manual_executor>();
+    executor_shutdowner es(ex);
+
+    for (size_t phase = 0; phase < 3; phase++) {
+        auto r0 = barrier.arrive_and_wait(ex).run();
+        auto r1 = barrier.arrive_and_wait(ex).run();
+
+        assert_equal(r0.status(), result_status::idle);
+        assert_equal(r1.status(), result_status::idle);
+        assert_equal(ex->size(), static_cast<size_t>(0));
+
+        // the last participant completes the phase and continues inline, the others are resumed inside ex
+        auto r2 = barrier.arrive_and_wait(ex).run();
+        assert_equal(r2.status(), result_status::value);
+        assert_equal(ex->size(), static_cast<size_t>(2));
+
+        ex->loop(2);
+
+        r0.get();
+        r1.get();
+        r2.get();
+    }
+}
+
+void concurrencpp::tests::test_async_barrier_arrive_and_wait_completion() {
+    const auto ex = std::make_shared<manual_executor>();
+    executor_shutdowner es(ex);
+
+    size_t completion_count = 0;
+    async_barrier barrier(2, [&completion_count] {
+        ++completion_count;
+    });
+
+    for (size_t phase = 0; phase < 5; phase++) {
+        auto r0 = barrier.arrive_and_wait(ex).run();
+        assert_equal(completion_count, phase);
+
+        auto r1 = barrier.arrive_and_wait(ex).run();
+
+        // the completion runs before any of the participants is resumed
+        assert_equal(completion_count, phase + 1);
+        assert_equal(r0.status(), result_status::idle);
+
+        ex->loop_once();
+        r0.get();
+        r1.get();
+    }
+}
+
+void concurrencpp::tests::test_async_barrier_arrive_and_wait_resumption_fails() {
+    async_barrier barrier(2);
+    const auto dead_ex = std::make_shared<manual_executor>();
+    const auto inline_ex = std::make_shared<inline_executor>();
+
+    auto failing = barrier.arrive_and_wait(dead_ex).run();
+    dead_ex->shutdown();
+
+    auto working = barrier.arrive_and_wait(inline_ex).run();
+    working.get();
+
+    assert_throws<errors::broken_task>([&failing] {
+        failing.get();
+    });
+}
+
+void concurrencpp::tests::test_async_barrier_arrive_and_wait() {
+    test_async_barrier_arrive_and_wait_null_resume_executor();
+    test_async_barrier_arrive_and_wait_phase();
+    test_async_barrier_arrive_and_wait_completion();
+    test_async_barrier_arrive_and_wait_resumption_fails();
+}
+
+void concurrencpp::tests::test_async_barrier_arrive_and_drop() {
+    const auto ex = std::make_shared<manual_executor>();
+    executor_shutdowner es(ex);
+
+    size_t completion_count = 0;
+    async_barrier barrier(3, [&completion_count] {
+        ++completion_count;
+    });
+
+    auto r0 = barrier.arrive_and_wait(ex).run();
+    auto r1 = barrier.arrive_and_wait(ex).run();
+
+    // dropping counts as an arrival for the current phase
+    barrier.arrive_and_drop();
+    assert_equal(completion_count, static_cast<size_t>(1));
+
+    ex->loop(2);
+    r0.get();
+    r1.get();
+
+    // from now on, only two participants are expected
+    r0 = barrier.arrive_and_wait(ex).run();
+    r1 = barrier.arrive_and_wait(ex).run();
+
+    assert_equal(completion_count, static_cast<size_t>(2));
+    ex->loop_once();
+
+    r0.get();
+    r1.get();
+}
+
+namespace concurrencpp::tests {
+    result<void> run_phases(executor_tag,
+                            std::shared_ptr<executor> ex,
+                            async_barrier& barrier,
+                            std::vector<size_t>& arrivals,
+                            size_t index,
+                            size_t phase_count) {
+        for (size_t i = 0; i < phase_count; i++) {
+            arrivals[index] = i + 1;
+            co_await barrier.arrive_and_wait(ex);
+        }
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_barrier_mini_load_test() {
+    constexpr size_t phase_count = 1'000;
+    const size_t task_count = concurrencpp::details::thread::hardware_concurrency() * 4;
+
+    runtime runtime;
+    const auto ex = runtime.thread_pool_executor();
+
+    std::vector<size_t> arrivals(task_count, 0);
+    size_t completed_phases = 0;
+    bool all_arrived = true;
+
+    async_barrier barrier(task_count, [&] {
+        ++completed_phases;
+        for (const auto arrival : arrivals) {
+            all_arrived &= (arrival == completed_phases);
+        }
+    });
+
+    std::vector<result<void>> results;
+    results.reserve(task_count);
+
+    for (size_t i = 0; i < task_count; i++) {
+        results.emplace_back(run_phases({}, ex, barrier, arrivals, i, phase_count));
+    }
+
+    for (auto& result : results) {
+        result.get();
+    }
+
+    assert_equal(completed_phases, phase_count);
+    assert_true(all_arrived);
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("async_barrier test");
+
+    tester.add_step("constructor", test_async_barrier_constructor);
+    tester.add_step("arrive_and_wait", test_async_barrier_arrive_and_wait);
+    tester.add_step("arrive_and_drop", test_async_barrier_arrive_and_drop);
+    tester.add_step("arrive_and_wait (load)", test_async_barrier_mini_load_test);
+
+    tester.launch_test();
+    return 0;
+}
@@ -19,6 +19,11 @@ namespace concurrencpp::tests {
 
     void test_async_condition_variable_notify_one();
     void test_async_condition_variable_notify_all();
+
+    void test_async_condition_variable_notify_hands_lock_over();
+    void test_async_condition_variable_notify_all_fifo_order();
+    void test_async_condition_variable_notify_resumption_fails();
+    void test_async_condition_variable_handoff();
 }  // namespace concurrencpp::tests
 
 using namespace concurrencpp::tests;
@@ -222,6 +227,140 @@ void tests::test_async_condition_variable_notify_all() {
     }
 }
 
+void tests::test_async_condition_variable_notify_hands_lock_over() {
+    async_lock lock;
+    async_condition_variable cv;
+    const auto inline_ex = std::make_shared<inline_executor>();
+    const auto manual_ex = std::make_shared<manual_executor>();
+    executor_shutdowner es0(inline_ex), es1(manual_ex);
+
+    auto owned_after_resumption = false;
+
+    auto task = [&]() -> result<void> {
+        auto sal = co_await lock.lock(inline_ex);
+        co_await cv.await(manual_ex, sal);
+        owned_after_resumption = sal.owns_lock();
+    };
+
+    auto res = task();
+    assert_equal(res.status(), result_status::idle);
+
+    // the notifier holds the lock: the waiter is queued on the lock and is not scheduled yet
+    {
+        auto sal = lock.lock(inline_ex).run().get();
+        cv.notify_one();
+        assert_equal(manual_ex->size(), static_cast<size_t>(0));
+    }
+
+    // unlocking hands the lock to the waiter, which is resumed once, inside its resume executor
+    assert_equal(manual_ex->size(), static_cast<size_t>(1));
+    assert_false(lock.try_lock().run().get());
+
+    assert_true(manual_ex->loop_once());
+    assert_equal(res.status(), result_status::value);
+    res.get();
+
+    assert_true(owned_after_resumption);
+    assert_equal(manual_ex->size(), static_cast<size_t>(0));
+
+    // notifying while the lock is free acquires it on behalf of the waiter
+    res = task();
+    cv.notify_one();
+
+    assert_equal(manual_ex->size(), static_cast<size_t>(1));
+    assert_false(lock.try_lock().run().get());
+
+    manual_ex->loop_once();
+    res.get();
+
+    assert_true(lock.try_lock().run().get());
+    lock.unlock();
+}
+
+void tests::test_async_condition_variable_notify_all_fifo_order() {
+    async_lock lock;
+    async_condition_variable cv;
+    const auto inline_ex = std::make_shared<inline_executor>();
+    const auto manual_ex = std::make_shared<manual_executor>();
+    executor_shutdowner es0(inline_ex), es1(manual_ex);
+
+    constexpr size_t task_count = 64;
+    std::vector<size_t> order;
+
+    auto task = [&](size_t index) -> result<void> {
+        auto sal = co_await lock.lock(inline_ex);
+        co_await cv.await(manual_ex, sal);
+        order.emplace_back(index);
+    };
+
+    std::vector<result<void>> results;
+    results.reserve(task_count);
+
+    for (size_t i = 0; i < task_count; i++) {
+        results.emplace_back(task(i));
+    }
+
+    cv.notify_all();
+
+    // only the lock owner is scheduled, the rest wait on the lock instead of all waking up at once
+    for (size_t i = 0; i < task_count; i++) {
+        assert_equal(manual_ex->size(), static_cast<size_t>(1));
+        assert_true(manual_ex->loop_once());
+    }
+
+    assert_equal(manual_ex->size(), static_cast<size_t>(0));
+
+    for (auto& result : results) {
+        result.get();
+    }
+
+    assert_equal(order.size(), task_count);
+    for (size_t i = 0; i < task_count; i++) {
+        assert_equal(order[i], i);
+    }
+
+    assert_true(lock.try_lock().run().get());
+    lock.unlock();
+}
+
+void tests::test_async_condition_variable_notify_resumption_fails() {
+    async_lock lock;
+    async_condition_variable cv;
+    const auto inline_ex = std::make_shared<inline_executor>();
+    const auto dead_ex = std::make_shared<manual_executor>();
+    const auto manual_ex = std::make_shared<manual_executor>();
+    executor_shutdowner es0(inline_ex), es1(manual_ex);
+
+    auto task = [&](std::shared_ptr<executor> resume_executor) -> result<bool> {
+        auto sal = co_await lock.lock(inline_ex);
+        co_await cv.await(resume_executor, sal);
+        co_return sal.owns_lock();
+    };
+
+    auto failing = task(dead_ex);
+    auto working = task(manual_ex);
+
+    dead_ex->shutdown();
+    cv.notify_all();
+
+    // the lock was handed to the first waiter, which could not be resumed, so it is passed on to the next one
+    assert_throws<errors::broken_task>([&failing] {
+        failing.get();
+    });
+
+    assert_true(manual_ex->loop_once());
+    assert_true(working.get());
+
+    assert_true(lock.try_lock().run().get());
+    lock.unlock();
+}
+
+void tests::test_async_condition_variable_handoff() {
+    test_async_condition_variable_notify_hands_lock_over();
+    test_async_condition_variable_notify_all_fifo_order();
+    test_async_condition_variable_notify_resumption_fails();
+}
+
 int main() {
     tester tester("async_condition_variable test");
 
@@ -229,6 +368,7 @@ int main() {
     tester.add_step("await + pred", test_async_condition_variable_await_pred);
     tester.add_step("notify_one", test_async_condition_variable_notify_one);
     tester.add_step("notify_all", test_async_condition_variable_notify_all);
+    tester.add_step("lock handoff", test_async_condition_variable_handoff);
 
     tester.launch_test();
     return 0;
@@ -0,0 +1,327 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+
+#include "concurrencpp/threads/constants.h"
+
+namespace concurrencpp::tests {
+    void test_async_manual_reset_event_constructor();
+    void test_async_manual_reset_event_set_reset();
+    void test_async_manual_reset_event_wait_null_resume_executor();
+    void test_async_manual_reset_event_wait_set();
+    void test_async_manual_reset_event_wait_broadcast();
+    void test_async_manual_reset_event_wait_resumption_fails();
+    void test_async_manual_reset_event_wait();
+
+    void test_async_auto_reset_event_constructor();
+    void test_async_auto_reset_event_set_reset();
+    void test_async_auto_reset_event_wait_null_resume_executor();
+    void test_async_auto_reset_event_wait_set();
+    void test_async_auto_reset_event_wait_one_per_set();
+    void test_async_auto_reset_event_wait_resumption_fails();
+    void test_async_auto_reset_event_wait();
+
+    void test_async_auto_reset_event_mini_load_test();
+
+    lazy_result<void> wait_and_record(async_manual_reset_event& event, std::shared_ptr<executor> ex, std::vector<size_t>& order, size_t index) {
+        co_await event.wait(ex);
+        order.emplace_back(index);
+    }
+
+    lazy_result<void> wait_and_record(async_auto_reset_event& event, std::shared_ptr<executor> ex, std::vector<size_t>& order, size_t index) {
+        co_await event.wait(ex);
+        order.emplace_back(index);
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_manual_reset_event_constructor() {
+    async_manual_reset_event event0;
+    assert_false(event0.is_set());
+
+    async_manual_reset_event event1(true);
+    assert_true(event1.is_set());
+}
+
+void concurrencpp::tests::test_async_manual_reset_event_set_reset() {
+    async_manual_reset_event event;
+
+    event.set();
+    assert_true(event.is_set());
+
+    event.set();
+    assert_true(event.is_set());
+
+    event.reset();
+    assert_false(event.is_set());
+
+    event.reset();
+    assert_false(event.is_set());
+}
+
+void concurrencpp::tests::test_async_manual_reset_event_wait_null_resume_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_manual_reset_event event;
+            event.wait(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_manual_reset_event_wait_null_resume_executor_err_msg);
+}
+
+void concurrencpp::tests::test_async_manual_reset_event_wait_set() {
+    async_manual_reset_event event(true);
+    const auto ex = std::make_shared<manual_executor>();
+    executor_shutdowner es(ex);
+
+    // waiting on a set event doesn't suspend, and doesn't reset it
+    for (size_t i = 0; i < 3; i++) {
+        auto result = event.wait(ex).run();
+        assert_equal(result.status(), result_status::value);
+        assert_true(event.is_set());
+    }
+
+    assert_equal(ex->size(), static_cast<size_t>(0));
+}
+
+void concurrencpp::tests::test_async_manual_reset_event_wait_broadcast() {
+    constexpr size_t waiter_count = 64;
+    async_manual_reset_event event;
+    const auto ex = std::make_shared<manual_executor>();
+    executor_shutdowner es(ex);
+
+    std::vector<size_t> order;
+    std::vector<result<void>> results;
+    results.reserve(waiter_count);
+
+    for (size_t i = 0; i < waiter_count; i++) {
+        results.emplace_back(wait_and_record(event, ex, order, i).run());
+    }
+
+    assert_equal(ex->size(), static_cast<size_t>(0));
+
+    // set wakes all the waiters, in the order they started waiting
+    event.set();
+    assert_equal(ex->size(), waiter_count);
+
+    ex->loop(waiter_count);
+
+    for (auto& result : results) {
+        result.get();
+    }
+
+    assert_equal(order.size(), waiter_count);
+    for (size_t i = 0; i < waiter_count; i++) {
+        assert_equal(order[i], i);
+    }
+
+    // after reset, new waiters suspend again
+    event.reset();
+
+    auto result = event.wait(ex).run();
+    assert_equal(result.status(), result_status::idle);
+
+    event.set();
+    ex->loop_once();
+    result.get();
+}
+
+void concurrencpp::tests::test_async_manual_reset_event_wait_resumption_fails() {
+    async_manual_reset_event event;
+    const auto ex = std::make_shared<manual_executor>();
+
+    auto result = event.wait(ex).run();
+    ex->shutdown();
+
+    event.set();
+
+    assert_throws<errors::broken_task>([&result] {
+        result.get();
+    });
+}
+
+void concurrencpp::tests::test_async_manual_reset_event_wait() {
+    test_async_manual_reset_event_wait_null_resume_executor();
+    test_async_manual_reset_event_wait_set();
+    test_async_manual_reset_event_wait_broadcast();
+    test_async_manual_reset_event_wait_resumption_fails();
+}
+
+void concurrencpp::tests::test_async_auto_reset_event_constructor() {
+    async_auto_reset_event event0;
+    assert_false(event0.is_set());
+
+    async_auto_reset_event event1(true);
+    assert_true(event1.is_set());
+}
+
+void concurrencpp::tests::test_async_auto_reset_event_set_reset() {
+    async_auto_reset_event event;
+
+    event.set();
+    assert_true(event.is_set());
+
+    event.set();
+    assert_true(event.is_set());
+
+    event.reset();
+    assert_false(event.is_set());
+
+    event.reset();
+    assert_false(event.is_set());
+}
+
+void concurrencpp::tests::test_async_auto_reset_event_wait_null_resume_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_auto_reset_event event;
+            event.wait(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_auto_reset_event_wait_null_resume_executor_err_msg);
+}
+
+void concurrencpp::tests::test_async_auto_reset_event_wait_set() {
+    async_auto_reset_event event(true);
+    const auto ex = std::make_shared<manual_executor>();
+    executor_shutdowner es(ex);
+
+    // the first waiter consumes the signal without suspending, the second one suspends
+    auto r0 = event.wait(ex).run();
+    assert_equal(r0.status(), result_status::value);
+    assert_false(event.is_set());
+
+    auto r1 = event.wait(ex).run();
+    assert_equal(r1.status(), result_status::idle);
+
+    event.set();
+    assert_false(event.is_set());
+    assert_equal(ex->size(), static_cast<size_t>(1));
+
+    ex->loop_once();
+    r1.get();
+}
+
+void concurrencpp::tests::test_async_auto_reset_event_wait_one_per_set() {
+    constexpr size_t waiter_count = 16;
+    async_auto_reset_event event;
+    const auto ex = std::make_shared<manual_executor>();
+    executor_shutdowner es(ex);
+
+    std::vector<size_t> order;
+    std::vector<result<void>> results;
+    results.reserve(waiter_count);
+
+    for (size_t i = 0; i < waiter_count; i++) {
+        results.emplace_back(wait_and_record(event, ex, order, i).run());
+    }
+
+    // each set releases exactly one waiter, in the order they started waiting
+    for (size_t i = 0; i < waiter_count; i++) {
+        event.set();
+        assert_equal(ex->size(), static_cast<size_t>(1));
+        assert_false(event.is_set());
+
+        ex->loop_once();
+        assert_equal(order.size(), i + 1);
+        assert_equal(order.back(), i);
+    }
+
+    for (auto& result : results) {
+        result.get();
+    }
+
+    // with no waiters, the signal is kept
+    event.set();
+    assert_true(event.is_set());
+}
+
+void concurrencpp::tests::test_async_auto_reset_event_wait_resumption_fails() {
+    async_auto_reset_event event;
+    const auto dead_ex = std::make_shared<manual_executor>();
+    const auto ex = std::make_shared<manual_executor>();
+    executor_shutdowner es(ex);
+
+    auto failing = event.wait(dead_ex).run();
+    auto working = event.wait(ex).run();
+    dead_ex->shutdown();
+
+    // the signal consumed on behalf of the broken waiter is passed on to the next waiter
+    event.set();
+
+    assert_throws<errors::broken_task>([&failing] {
+        failing.get();
+    });
+
+    assert_equal(ex->size(), static_cast<size_t>(1));
+    ex->loop_once();
+    working.get();
+
+    assert_false(event.is_set());
+}
+
+void concurrencpp::tests::test_async_auto_reset_event_wait() {
+    test_async_auto_reset_event_wait_null_resume_executor();
+    test_async_auto_reset_event_wait_set();
+    test_async_auto_reset_event_wait_one_per_set();
+    test_async_auto_reset_event_wait_resumption_fails();
+}
+
+namespace concurrencpp::tests {
+    result<void> consume_signals(executor_tag, std::shared_ptr<executor> ex, async_auto_reset_event& event, std::atomic_size_t& counter, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            co_await event.wait(ex);
+            counter.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_auto_reset_event_mini_load_test() {
+    constexpr size_t signals_per_worker = 1'000;
+    const size_t worker_count = concurrencpp::details::thread::hardware_concurrency();
+
+    async_auto_reset_event event;
+    std::atomic_size_t counter = 0;
+
+    std::vector<std::shared_ptr<worker_thread_executor>> workers(worker_count);
+    for (auto& worker : workers) {
+        worker = std::make_shared<worker_thread_executor>();
+    }
+
+    std::vector<result<void>> results(worker_count);
+    for (size_t i = 0; i < worker_count; i++) {
+        results[i] = consume_signals({}, workers[i], event, counter, signals_per_worker);
+    }
+
+    // a signal is lost if it's set while the event is already set, so keep signalling until everyone is done
+    const auto total = signals_per_worker * worker_count;
+    while (counter.load(std::memory_order_relaxed) != total) {
+        event.set();
+    }
+
+    for (auto& result : results) {
+        result.get();
+    }
+
+    assert_equal(counter.load(), total);
+
+    for (auto& worker : workers) {
+        worker->shutdown();
+    }
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("async_event test");
+
+    tester.add_step("async_manual_reset_event constructor", test_async_manual_reset_event_constructor);
+    tester.add_step("async_manual_reset_event set + reset", test_async_manual_reset_event_set_reset);
+    tester.add_step("async_manual_reset_event wait", test_async_manual_reset_event_wait);
+    tester.add_step("async_auto_reset_event constructor", test_async_auto_reset_event_constructor);
+    tester.add_step("async_auto_reset_event set + reset", test_async_auto_reset_event_set_reset);
+    tester.add_step("async_auto_reset_event wait", test_async_auto_reset_event_wait);
+    tester.add_step("async_auto_reset_event set + wait", test_async_auto_reset_event_mini_load_test);
+
+    tester.launch_test();
+    return 0;
+}
@@ -0,0 +1,269 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+
+#include "concurrencpp/threads/constants.h"
+
+namespace concurrencpp::tests {
+    void test_async_latch_constructor();
+
+    void test_async_latch_count_down();
+
+    void test_async_latch_try_wait();
+
+    void test_async_latch_wait_null_resume_executor();
+    void test_async_latch_wait_ready();
+    void test_async_latch_wait_batch_resumption();
+    void test_async_latch_wait_resumption_fails();
+    void test_async_latch_wait();
+
+    void test_async_latch_arrive_and_wait();
+
+    void test_async_latch_mini_load_test();
+
+    class batch_counting_executor final : public derivable_executor<batch_counting_executor> {
+
+       private:
+        std::vector<task> m_tasks;
+        size_t m_batch_count = 0;
+
+       public:
+        batch_counting_executor() : derivable_executor<batch_counting_executor>("batch_counting_executor") {}
+
+        void enqueue(task task) override {
+            ++m_batch_count;
+            m_tasks.emplace_back(std::move(task));
+        }
+
+        void enqueue(std::span<task> tasks) override {
+            ++m_batch_count;
+            for (auto& task : tasks) {
+                m_tasks.emplace_back(std::move(task));
+            }
+        }
+
+        int max_concurrency_level() const noexcept override {
+            return 1;
+        }
+
+        bool shutdown_requested() const noexcept override {
+            return false;
+        }
+
+        void shutdown() noexcept override {}
+
+        size_t batch_count() const noexcept {
+            return m_batch_count;
+        }
+
+        size_t size() const noexcept {
+            return m_tasks.size();
+        }
+
+        void loop() {
+            auto tasks = std::move(m_tasks);
+            for (auto& task : tasks) {
+                task();
+            }
+        }
+    };
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_latch_constructor() {
+    async_latch latch0(0);
+    assert_true(latch0.try_wait());
+
+    async_latch latch1(3);
+    assert_false(latch1.try_wait());
+
+    latch1.count_down(3);
+}
+
+void concurrencpp::tests::test_async_latch_count_down() {
+    async_latch latch(5);
+
+    latch.count_down();
+    assert_false(latch.try_wait());
+
+    latch.count_down(3);
+    assert_false(latch.try_wait());
+
+    latch.count_down();
+    assert_true(latch.try_wait());
+
+    // counting down by zero on a ready latch is a no-op
+    latch.count_down(0);
+    assert_true(latch.try_wait());
+}
+
+void concurrencpp::tests::test_async_latch_try_wait() {
+    async_latch latch(1);
+    assert_false(latch.try_wait());
+    assert_false(latch.try_wait());
+
+    latch.count_down();
+    assert_true(latch.try_wait());
+    assert_true(latch.try_wait());
+}
+
+void concurrencpp::tests::test_async_latch_wait_null_resume_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_latch latch(1);
+            latch.wait(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_latch_wait_null_resume_executor_err_msg);
+}
+
+void concurrencpp::tests::test_async_latch_wait_ready() {
+    async_latch latch(0);
+    const auto ex = std::make_shared<batch_counting_executor>();
+
+    // waiting on a ready latch doesn't suspend
+    auto result = latch.wait(ex).run();
+    assert_equal(result.status(), result_status::value);
+    assert_equal(ex->size(), static_cast<size_t>(0));
+    result.get();
+}
+
+namespace concurrencpp::tests {
+    lazy_result<void> wait_and_record(async_latch& latch, std::shared_ptr<executor> ex, std::vector<size_t>& order, size_t index) {
+        co_await latch.wait(ex);
+        order.emplace_back(index);
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_latch_wait_batch_resumption() {
+    constexpr size_t waiter_count = 64;
+    async_latch latch(1);
+    const auto ex = std::make_shared<batch_counting_executor>();
+
+    std::vector<size_t> order;
+    std::vector<result<void>> results;
+    results.reserve(waiter_count);
+
+    for (size_t i = 0; i < waiter_count; i++) {
+        results.emplace_back(wait_and_record(latch, ex, order, i).run());
+    }
+
+    assert_equal(ex->size(), static_cast<size_t>(0));
+
+    latch.count_down();
+
+    // the final count down resumes all the waiters with one bulk enqueue per k_capacity waiters
+    constexpr auto batch_capacity = concurrencpp::details::resumption_batch::k_capacity;
+    assert_equal(ex->batch_count(), (waiter_count + batch_capacity - 1) / batch_capacity);
+    assert_equal(ex->size(), waiter_count);
+
+    ex->loop();
+
+    for (auto& result : results) {
+        result.get();
+    }
+
+    assert_equal(order.size(), waiter_count);
+    for (size_t i = 0; i < waiter_count; i++) {
+        assert_equal(order[i], i);
+    }
+}
+
+void concurrencpp::tests::test_async_latch_wait_resumption_fails() {
+    async_latch latch(1);
+    const auto ex = std::make_shared<manual_executor>();
+
+    auto result = latch.wait(ex).run();
+    ex->shutdown();
+
+    latch.count_down();
+
+    assert_throws<errors::broken_task>([&result] {
+        result.get();
+    });
+}
+
+void concurrencpp::tests::test_async_latch_wait() {
+    test_async_latch_wait_null_resume_executor();
+    test_async_latch_wait_ready();
+    test_async_latch_wait_batch_resumption();
+    test_async_latch_wait_resumption_fails();
+}
+
+void concurrencpp::tests::test_async_latch_arrive_and_wait() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_latch latch(1);
+            latch.arrive_and_wait(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_latch_arrive_and_wait_null_resume_executor_err_msg);
+
+    async_latch latch(3);
+    const auto ex = std::make_shared<manual_executor>();
+    executor_shutdowner es(ex);
+
+    auto r0 = latch.arrive_and_wait(ex).run();
+    auto r1 = latch.arrive_and_wait(ex).run();
+
+    assert_equal(r0.status(), result_status::idle);
+    assert_equal(r1.status(), result_status::idle);
+
+    // the last participant to arrive doesn't suspend
+    auto r2 = latch.arrive_and_wait(ex).run();
+    assert_equal(r2.status(), result_status::value);
+
+    assert_equal(ex->size(), static_cast<size_t>(2));
+    ex->loop(2);
+
+    r0.get();
+    r1.get();
+    r2.get();
+}
+
+namespace concurrencpp::tests {
+    result<void> count_down_and_wait(executor_tag, std::shared_ptr<executor> ex, async_latch& latch, std::atomic_size_t& counter) {
+        counter.fetch_add(1, std::memory_order_relaxed);
+        co_await latch.arrive_and_wait(ex);
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_latch_mini_load_test() {
+    constexpr size_t task_count = 1'024;
+    runtime runtime;
+    const auto ex = runtime.thread_pool_executor();
+
+    for (size_t round = 0; round < 32; round++) {
+        async_latch latch(task_count);
+        std::atomic_size_t counter = 0;
+
+        std::vector<result<void>> results;
+        results.reserve(task_count);
+
+        for (size_t i = 0; i < task_count; i++) {
+            results.emplace_back(count_down_and_wait({}, ex, latch, counter));
+        }
+
+        for (auto& result : results) {
+            result.get();
+        }
+
+        assert_equal(counter.load(), task_count);
+        assert_true(latch.try_wait());
+    }
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("async_latch test");
+
+    tester.add_step("constructor", test_async_latch_constructor);
+    tester.add_step("count_down", test_async_latch_count_down);
+    tester.add_step("try_wait", test_async_latch_try_wait);
+    tester.add_step("wait", test_async_latch_wait);
+    tester.add_step("arrive_and_wait", test_async_latch_arrive_and_wait);
+    tester.add_step("count_down + wait", test_async_latch_mini_load_test);
+
+    tester.launch_test();
+    return 0;
+}
@@ -9,6 +9,7 @@
 namespace concurrencpp::tests {
     void test_async_lock_lock_null_resume_executor();
     void test_async_lock_lock_resumption();
+    void test_async_lock_lock_fifo_order();
     void test_async_lock_lock();
 
     void test_async_lock_try_lock();
@@ -22,7 +23,7 @@ namespace concurrencpp::tests {
 
     result<void> incremenet(executor_tag, std::shared_ptr<executor> ex, async_lock& lock, size_t& counter, size_t cycles) {
         for (size_t i = 0; i < cycles; i++) {
-            auto lk = co_await lock.lock(ex);
+            auto lk = co_await lock.lock_awaitable(ex);
             ++counter;
         }
     }
@@ -34,7 +35,7 @@ namespace concurrencpp::tests {
                         size_t range_begin,
                         size_t range_end) {
         for (size_t i = range_begin; i < range_end; i++) {
-            auto lk = co_await lock.lock(ex);
+            auto lk = co_await lock.lock_awaitable(ex);
             vec.emplace_back(i);
         }
     }
@@ -54,6 +55,13 @@ void concurrencpp::tests::test_async_lock_lock_null_resume_executor() {
             lock.lock(std::shared_ptr<concurrencpp::inline_executor> {});
         },
         concurrencpp::details::consts::k_async_lock_null_resume_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_lock lock;
+            lock.lock_awaitable(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_lock_null_resume_executor_err_msg);
 }
 
 void concurrencpp::tests::test_async_lock_lock_resumption() {
@@ -81,9 +89,50 @@ void concurrencpp::tests::test_async_lock_lock_resumption() {
     }
 }
 
+namespace concurrencpp::tests {
+    lazy_result<void> lock_and_record(async_lock& lock, std::shared_ptr<executor> ex, std::vector<size_t>& order, size_t index) {
+        auto guard = co_await lock.lock(ex);
+        order.emplace_back(index);
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_lock_lock_fifo_order() {
+    async_lock lock;
+    const auto ex = std::make_shared<inline_executor>();
+    constexpr size_t waiter_count = 64;
+
+    std::vector<size_t> order;
+    std::vector<result<void>> results;
+    results.reserve(waiter_count);
+
+    {
+        auto guard = lock.lock(ex).run().get();
+
+        for (size_t i = 0; i < waiter_count; i++) {
+            results.emplace_back(lock_and_record(lock, ex, order, i).run());
+        }
+
+        assert_true(order.empty());
+    }
+
+    // the lock is handed over from one waiter to the next in the order they started waiting
+    for (auto& result : results) {
+        result.get();
+    }
+
+    assert_equal(order.size(), waiter_count);
+    for (size_t i = 0; i < waiter_count; i++) {
+        assert_equal(order[i], i);
+    }
+
+    assert_true(lock.try_lock().run().get());
+    lock.unlock();
+}
+
 void concurrencpp::tests::test_async_lock_lock() {
     test_async_lock_lock_null_resume_executor();
     test_async_lock_lock_resumption();
+    test_async_lock_lock_fifo_order();
 }
 
 void concurrencpp::tests::test_async_lock_try_lock() {
@@ -0,0 +1,346 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+
+#include "concurrencpp/threads/constants.h"
+
+namespace concurrencpp::tests {
+    void test_async_semaphore_acquire_null_resume_executor();
+    void test_async_semaphore_acquire_available();
+    void test_async_semaphore_acquire_waits();
+    void test_async_semaphore_acquire_fifo_order();
+    void test_async_semaphore_acquire();
+
+    void test_async_semaphore_try_acquire();
+
+    void test_async_semaphore_release_resumes_ready_waiters();
+    void test_async_semaphore_release_resumption_fails();
+    void test_async_semaphore_release();
+
+    void test_async_semaphore_permit();
+
+    void test_async_semaphore_mini_load_test();
+
+    lazy_result<void> acquire_and_record(async_semaphore& semaphore,
+                                         std::shared_ptr<executor> ex,
+                                         size_t count,
+                                         std::vector<size_t>& order,
+                                         size_t index,
+                                         std::vector<async_semaphore_permit>& permits) {
+        auto permit = co_await semaphore.acquire(ex, count);
+        order.emplace_back(index);
+        permits.emplace_back(std::move(permit));
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_semaphore_acquire_null_resume_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_semaphore semaphore(1);
+            semaphore.acquire(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_semaphore_acquire_null_resume_executor_err_msg);
+}
+
+void concurrencpp::tests::test_async_semaphore_acquire_available() {
+    async_semaphore semaphore(5);
+    const auto ex = std::make_shared<inline_executor>();
+
+    {
+        auto permit = semaphore.acquire(ex, 3).run().get();
+        assert_true(static_cast<bool>(permit));
+        assert_equal(permit.count(), static_cast<size_t>(3));
+        assert_equal(permit.semaphore(), &semaphore);
+        assert_equal(semaphore.available_permits(), static_cast<size_t>(2));
+
+        auto permit1 = semaphore.acquire(ex).run().get();
+        assert_equal(permit1.count(), static_cast<size_t>(1));
+        assert_equal(semaphore.available_permits(), static_cast<size_t>(1));
+    }
+
+    assert_equal(semaphore.available_permits(), static_cast<size_t>(5));
+}
+
+void concurrencpp::tests::test_async_semaphore_acquire_waits() {
+    async_semaphore semaphore(0);
+    const auto manual_ex = std::make_shared<manual_executor>();
+    executor_shutdowner es(manual_ex);
+
+    auto result = semaphore.acquire(manual_ex, 2).run();
+    assert_equal(result.status(), result_status::idle);
+
+    semaphore.release();
+    assert_equal(manual_ex->size(), static_cast<size_t>(0));
+    assert_equal(semaphore.available_permits(), static_cast<size_t>(1));
+
+    // a waiter is resumed only when all the permits it asked for are available
+    semaphore.release();
+    assert_equal(manual_ex->size(), static_cast<size_t>(1));
+    assert_equal(semaphore.available_permits(), static_cast<size_t>(0));
+
+    manual_ex->loop_once();
+
+    auto permit = result.get();
+    assert_equal(permit.count(), static_cast<size_t>(2));
+
+    permit.release();
+    assert_equal(semaphore.available_permits(), static_cast<size_t>(2));
+}
+
+void concurrencpp::tests::test_async_semaphore_acquire_fifo_order() {
+    async_semaphore semaphore(0);
+    const auto ex = std::make_shared<inline_executor>();
+    constexpr size_t waiter_count = 64;
+
+    std::vector<size_t> order;
+    std::vector<async_semaphore_permit> permits;
+    std::vector<result<void>> results;
+    results.reserve(waiter_count);
+
+    for (size_t i = 0; i < waiter_count; i++) {
+        results.emplace_back(acquire_and_record(semaphore, ex, 1, order, i, permits).run());
+    }
+
+    semaphore.release(waiter_count);
+
+    for (auto& result : results) {
+        result.get();
+    }
+
+    assert_equal(order.size(), waiter_count);
+    for (size_t i = 0; i < waiter_count; i++) {
+        assert_equal(order[i], i);
+    }
+
+    permits.clear();
+    assert_equal(semaphore.available_permits(), waiter_count);
+}
+
+void concurrencpp::tests::test_async_semaphore_acquire() {
+    test_async_semaphore_acquire_null_resume_executor();
+    test_async_semaphore_acquire_available();
+    test_async_semaphore_acquire_waits();
+    test_async_semaphore_acquire_fifo_order();
+}
+
+void concurrencpp::tests::test_async_semaphore_try_acquire() {
+    async_semaphore semaphore(3);
+
+    assert_true(semaphore.try_acquire(2));
+    assert_false(semaphore.try_acquire(2));
+    assert_true(semaphore.try_acquire());
+    assert_false(semaphore.try_acquire());
+    assert_equal(semaphore.available_permits(), static_cast<size_t>(0));
+
+    semaphore.release(3);
+    assert_true(semaphore.try_acquire(3));
+    semaphore.release(3);
+
+    // try_acquire doesn't overtake waiting coroutines
+    const auto manual_ex = std::make_shared<manual_executor>();
+    executor_shutdowner es(manual_ex);
+
+    auto result = semaphore.acquire(manual_ex, 5).run();
+    assert_false(semaphore.try_acquire());
+
+    semaphore.release(2);
+    manual_ex->loop_once();
+    result.get().release();
+
+    assert_true(semaphore.try_acquire(5));
+    semaphore.release(5);
+}
+
+void concurrencpp::tests::test_async_semaphore_release_resumes_ready_waiters() {
+    async_semaphore semaphore(0);
+    const auto manual_ex = std::make_shared<manual_executor>();
+    executor_shutdowner es(manual_ex);
+
+    auto r0 = semaphore.acquire(manual_ex, 1).run();
+    auto r1 = semaphore.acquire(manual_ex, 2).run();
+    auto r2 = semaphore.acquire(manual_ex, 4).run();
+
+    // exactly the waiters that can proceed are resumed, in order
+    semaphore.release(4);
+    assert_equal(manual_ex->size(), static_cast<size_t>(2));
+    assert_equal(semaphore.available_permits(), static_cast<size_t>(1));
+
+    semaphore.release(3);
+    assert_equal(manual_ex->size(), static_cast<size_t>(3));
+    assert_equal(semaphore.available_permits(), static_cast<size_t>(0));
+
+    manual_ex->loop(3);
+
+    auto p0 = r0.get();
+    auto p1 = r1.get();
+    auto p2 = r2.get();
+
+    assert_equal(p0.count() + p1.count() + p2.count(), static_cast<size_t>(7));
+}
+
+namespace concurrencpp::tests {
+    result<void> acquire_coro(async_semaphore& semaphore, std::shared_ptr<executor> ex) {
+        auto permit = co_await semaphore.acquire(ex);
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_semaphore_release_resumption_fails() {
+    runtime runtime;
+    std::shared_ptr<worker_thread_executor> executors[5];
+    const auto working_executor = runtime.make_worker_thread_executor();
+
+    for (auto& executor : executors) {
+        executor = runtime.make_worker_thread_executor();
+    }
+
+    async_semaphore semaphore(0);
+
+    result<void> results[5];
+    for (size_t i = 0; i < std::size(executors); i++) {
+        results[i] = acquire_coro(semaphore, executors[i]);
+    }
+
+    auto working_result = acquire_coro(semaphore, working_executor);
+
+    for (auto& executor : executors) {
+        executor->shutdown();
+    }
+
+    // permits handed to waiters that can't be resumed are given back and passed on
+    semaphore.release();
+
+    for (auto& err_result : results) {
+        assert_throws<errors::broken_task>([&err_result] {
+            err_result.get();
+        });
+    }
+
+    working_result.get();
+    assert_equal(semaphore.available_permits(), static_cast<size_t>(1));
+}
+
+void concurrencpp::tests::test_async_semaphore_release() {
+    test_async_semaphore_release_resumes_ready_waiters();
+    test_async_semaphore_release_resumption_fails();
+}
+
+void concurrencpp::tests::test_async_semaphore_permit() {
+    async_semaphore semaphore(4);
+    const auto ex = std::make_shared<inline_executor>();
+
+    {
+        async_semaphore_permit permit;
+        assert_false(static_cast<bool>(permit));
+        assert_equal(permit.count(), static_cast<size_t>(0));
+        assert_equal(permit.semaphore(), static_cast<async_semaphore*>(nullptr));
+
+        assert_throws_contains_error_message<std::system_error>(
+            [&permit] {
+                permit.release();
+            },
+            concurrencpp::details::consts::k_async_semaphore_permit_release_empty_permit_err_msg);
+    }
+
+    {
+        auto permit = semaphore.acquire(ex, 2).run().get();
+        auto moved = std::move(permit);
+
+        assert_false(static_cast<bool>(permit));
+        assert_equal(moved.count(), static_cast<size_t>(2));
+        assert_equal(semaphore.available_permits(), static_cast<size_t>(2));
+
+        async_semaphore_permit assigned;
+        assigned = std::move(moved);
+        assert_equal(assigned.count(), static_cast<size_t>(2));
+        assert_equal(semaphore.available_permits(), static_cast<size_t>(2));
+
+        // assigning releases the currently held permits
+        assigned = semaphore.acquire(ex, 1).run().get();
+        assert_equal(semaphore.available_permits(), static_cast<size_t>(3));
+    }
+
+    assert_equal(semaphore.available_permits(), static_cast<size_t>(4));
+
+    {
+        auto permit = semaphore.acquire(ex, 4).run().get();
+        assert_equal(permit.detach(), &semaphore);
+        assert_false(static_cast<bool>(permit));
+    }
+
+    assert_equal(semaphore.available_permits(), static_cast<size_t>(0));
+
+    {
+        assert_false(semaphore.try_acquire());
+        async_semaphore_permit adopted(semaphore, 4);
+    }
+
+    assert_equal(semaphore.available_permits(), static_cast<size_t>(4));
+}
+
+namespace concurrencpp::tests {
+    result<void> limited_increment(executor_tag,
+                                   std::shared_ptr<executor> ex,
+                                   async_semaphore& semaphore,
+                                   std::atomic_size_t& in_flight,
+                                   std::atomic_size_t& max_in_flight,
+                                   size_t cycles) {
+        for (size_t i = 0; i < cycles; i++) {
+            auto permit = co_await semaphore.acquire(ex, 1 + i % 2);
+
+            const auto current = in_flight.fetch_add(permit.count()) + permit.count();
+            auto max = max_in_flight.load();
+            while (current > max && !max_in_flight.compare_exchange_weak(max, current)) {
+            }
+
+            in_flight.fetch_sub(permit.count());
+        }
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_semaphore_mini_load_test() {
+    constexpr size_t permit_count = 3;
+    async_semaphore semaphore(permit_count);
+    std::atomic_size_t in_flight = 0, max_in_flight = 0;
+
+    const size_t worker_count = concurrencpp::details::thread::hardware_concurrency();
+    constexpr size_t cycles = 100'000;
+
+    std::vector<std::shared_ptr<worker_thread_executor>> workers(worker_count);
+    for (auto& worker : workers) {
+        worker = std::make_shared<worker_thread_executor>();
+    }
+
+    std::vector<result<void>> results(worker_count);
+
+    for (size_t i = 0; i < worker_count; i++) {
+        results[i] = limited_increment({}, workers[i], semaphore, in_flight, max_in_flight, cycles);
+    }
+
+    for (size_t i = 0; i < worker_count; i++) {
+        results[i].get();
+    }
+
+    assert_smaller_equal(max_in_flight.load(), permit_count);
+    assert_equal(semaphore.available_permits(), permit_count);
+
+    for (auto& worker : workers) {
+        worker->shutdown();
+    }
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("async_semaphore test");
+
+    tester.add_step("acquire", test_async_semaphore_acquire);
+    tester.add_step("try_acquire", test_async_semaphore_try_acquire);
+    tester.add_step("release", test_async_semaphore_release);
+    tester.add_step("async_semaphore_permit", test_async_semaphore_permit);
+    tester.add_step("acquire + release", test_async_semaphore_mini_load_test);
+
+    tester.launch_test();
+    return 0;
+}
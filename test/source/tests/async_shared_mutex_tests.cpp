@@ -0,0 +1,540 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+
+#include "concurrencpp/threads/constants.h"
+
+#include <algorithm>
+
+namespace concurrencpp::tests {
+    void test_async_shared_mutex_lock_null_resume_executor();
+    void test_async_shared_mutex_lock_exclusion();
+    void test_async_shared_mutex_lock();
+
+    void test_async_shared_mutex_lock_shared_null_resume_executor();
+    void test_async_shared_mutex_lock_shared_concurrent_readers();
+    void test_async_shared_mutex_lock_shared_batch_resumption();
+    void test_async_shared_mutex_lock_shared();
+
+    void test_async_shared_mutex_try_lock();
+    void test_async_shared_mutex_try_lock_shared();
+
+    void test_async_shared_mutex_writer_preference();
+
+    void test_async_shared_mutex_unlock_resumption_fails();
+    void test_async_shared_mutex_unlock();
+
+    void test_scoped_async_shared_lock();
+    void test_scoped_async_unique_lock();
+
+    void test_async_shared_mutex_mini_load_test();
+
+    class batch_counting_executor final : public derivable_executor<batch_counting_executor> {
+
+       private:
+        std::vector<task> m_tasks;
+        size_t m_batch_count = 0;
+
+       public:
+        batch_counting_executor() : derivable_executor<batch_counting_executor>("batch_counting_executor") {}
+
+        void enqueue(task task) override {
+            ++m_batch_count;
+            m_tasks.emplace_back(std::move(task));
+        }
+
+        void enqueue(std::span<task> tasks) override {
+            ++m_batch_count;
+            for (auto& task : tasks) {
+                m_tasks.emplace_back(std::move(task));
+            }
+        }
+
+        int max_concurrency_level() const noexcept override {
+            return 1;
+        }
+
+        bool shutdown_requested() const noexcept override {
+            return false;
+        }
+
+        void shutdown() noexcept override {}
+
+        size_t batch_count() const noexcept {
+            return m_batch_count;
+        }
+
+        size_t size() const noexcept {
+            return m_tasks.size();
+        }
+
+        void loop() {
+            auto tasks = std::move(m_tasks);
+            for (auto& task : tasks) {
+                task();
+            }
+        }
+    };
+
+    lazy_result<void> read_and_record(async_shared_mutex& mutex, std::shared_ptr<executor> ex, std::vector<char>& order) {
+        auto guard = co_await mutex.lock_shared(ex);
+        order.emplace_back('r');
+    }
+
+    lazy_result<void> write_and_record(async_shared_mutex& mutex, std::shared_ptr<executor> ex, std::vector<char>& order) {
+        auto guard = co_await mutex.lock(ex);
+        order.emplace_back('w');
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_shared_mutex_lock_null_resume_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_shared_mutex mutex;
+            mutex.lock(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_shared_mutex_lock_null_resume_executor_err_msg);
+}
+
+void concurrencpp::tests::test_async_shared_mutex_lock_exclusion() {
+    async_shared_mutex mutex;
+    const auto ex = std::make_shared<inline_executor>();
+
+    auto writer = mutex.lock(ex).run().get();
+    assert_true(writer.owns_lock());
+    assert_false(mutex.try_lock());
+    assert_false(mutex.try_lock_shared());
+
+    std::vector<char> order;
+    auto second_writer = write_and_record(mutex, ex, order).run();
+    auto reader = read_and_record(mutex, ex, order).run();
+
+    assert_true(order.empty());
+
+    writer.unlock();
+
+    // readers that queued behind a writer are admitted before the next queued writer
+    second_writer.get();
+    reader.get();
+
+    assert_equal(order.size(), static_cast<size_t>(2));
+    assert_equal(order[0], 'r');
+    assert_equal(order[1], 'w');
+
+    assert_true(mutex.try_lock());
+    mutex.unlock();
+}
+
+void concurrencpp::tests::test_async_shared_mutex_lock() {
+    test_async_shared_mutex_lock_null_resume_executor();
+    test_async_shared_mutex_lock_exclusion();
+}
+
+void concurrencpp::tests::test_async_shared_mutex_lock_shared_null_resume_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_shared_mutex mutex;
+            mutex.lock_shared(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_async_shared_mutex_lock_shared_null_resume_executor_err_msg);
+}
+
+void concurrencpp::tests::test_async_shared_mutex_lock_shared_concurrent_readers() {
+    async_shared_mutex mutex;
+    const auto ex = std::make_shared<inline_executor>();
+    constexpr size_t reader_count = 16;
+
+    std::vector<scoped_async_shared_lock> guards;
+    for (size_t i = 0; i < reader_count; i++) {
+        guards.emplace_back(mutex.lock_shared(ex).run().get());
+        assert_true(guards.back().owns_lock());
+    }
+
+    assert_false(mutex.try_lock());
+    assert_true(mutex.try_lock_shared());
+    mutex.unlock_shared();
+
+    guards.clear();
+
+    assert_true(mutex.try_lock());
+    mutex.unlock();
+}
+
+void concurrencpp::tests::test_async_shared_mutex_lock_shared_batch_resumption() {
+    async_shared_mutex mutex;
+    const auto ex = std::make_shared<batch_counting_executor>();
+    const auto inline_ex = std::make_shared<inline_executor>();
+    constexpr size_t reader_count = 32;
+
+    std::vector<char> order;
+    std::vector<result<void>> results;
+    results.reserve(reader_count);
+
+    auto writer = mutex.lock(inline_ex).run().get();
+
+    for (size_t i = 0; i < reader_count; i++) {
+        results.emplace_back(read_and_record(mutex, ex, order).run());
+    }
+
+    assert_equal(ex->size(), static_cast<size_t>(0));
+
+    writer.unlock();
+
+    // all the readers that share a resume executor are enqueued to it with one bulk enqueue per k_capacity readers
+    constexpr auto batch_capacity = concurrencpp::details::resumption_batch::k_capacity;
+    assert_equal(ex->batch_count(), (reader_count + batch_capacity - 1) / batch_capacity);
+    assert_equal(ex->size(), reader_count);
+
+    ex->loop();
+
+    for (auto& result : results) {
+        result.get();
+    }
+
+    assert_equal(order.size(), reader_count);
+    assert_true(mutex.try_lock());
+    mutex.unlock();
+}
+
+void concurrencpp::tests::test_async_shared_mutex_lock_shared() {
+    test_async_shared_mutex_lock_shared_null_resume_executor();
+    test_async_shared_mutex_lock_shared_concurrent_readers();
+    test_async_shared_mutex_lock_shared_batch_resumption();
+}
+
+void concurrencpp::tests::test_async_shared_mutex_try_lock() {
+    async_shared_mutex mutex;
+    assert_true(mutex.try_lock());
+    assert_false(mutex.try_lock());
+    assert_false(mutex.try_lock_shared());
+
+    mutex.unlock();
+
+    assert_true(mutex.try_lock_shared());
+    assert_false(mutex.try_lock());
+
+    mutex.unlock_shared();
+    assert_true(mutex.try_lock());
+
+    mutex.unlock();
+}
+
+void concurrencpp::tests::test_async_shared_mutex_try_lock_shared() {
+    async_shared_mutex mutex;
+    assert_true(mutex.try_lock_shared());
+    assert_true(mutex.try_lock_shared());
+
+    mutex.unlock_shared();
+    assert_false(mutex.try_lock());
+
+    mutex.unlock_shared();
+    assert_true(mutex.try_lock());
+    assert_false(mutex.try_lock_shared());
+
+    mutex.unlock();
+}
+
+void concurrencpp::tests::test_async_shared_mutex_writer_preference() {
+    async_shared_mutex mutex;
+    const auto ex = std::make_shared<inline_executor>();
+
+    std::vector<char> order;
+
+    auto reader = mutex.lock_shared(ex).run().get();
+    auto writer = write_and_record(mutex, ex, order).run();
+
+    // a waiting writer blocks new readers, even though the mutex is only shared-locked
+    assert_false(mutex.try_lock_shared());
+    auto late_reader = read_and_record(mutex, ex, order).run();
+
+    assert_true(order.empty());
+
+    reader.unlock();
+
+    writer.get();
+    late_reader.get();
+
+    assert_equal(order.size(), static_cast<size_t>(2));
+    assert_equal(order[0], 'w');
+    assert_equal(order[1], 'r');
+
+    assert_true(mutex.try_lock());
+    mutex.unlock();
+}
+
+namespace concurrencpp::tests {
+    result<void> lock_shared_coro(async_shared_mutex& mutex, std::shared_ptr<executor> ex) {
+        auto guard = co_await mutex.lock_shared(ex);
+    }
+
+    result<void> lock_coro(async_shared_mutex& mutex, std::shared_ptr<executor> ex) {
+        auto guard = co_await mutex.lock(ex);
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_shared_mutex_unlock_resumption_fails() {
+    // a waiter whose resume executor was shut down throws broken_task and passes ownership on
+    runtime runtime;
+    std::shared_ptr<worker_thread_executor> executors[4];
+    const auto working_executor = runtime.make_worker_thread_executor();
+
+    for (auto& executor : executors) {
+        executor = runtime.make_worker_thread_executor();
+    }
+
+    async_shared_mutex mutex;
+    auto guard = mutex.lock(runtime.thread_pool_executor()).run().get();
+
+    result<void> results[4];
+    results[0] = lock_coro(mutex, executors[0]);
+    results[1] = lock_shared_coro(mutex, executors[1]);
+    results[2] = lock_shared_coro(mutex, executors[2]);
+    results[3] = lock_coro(mutex, executors[3]);
+
+    auto working_result = lock_coro(mutex, working_executor);
+
+    for (auto& executor : executors) {
+        executor->shutdown();
+    }
+
+    guard.unlock();
+
+    for (auto& err_result : results) {
+        assert_throws<errors::broken_task>([&err_result] {
+            err_result.get();
+        });
+    }
+
+    working_result.get();  // make sure nothing is thrown
+
+    assert_true(mutex.try_lock());
+    mutex.unlock();
+}
+
+void concurrencpp::tests::test_async_shared_mutex_unlock() {
+    assert_throws_contains_error_message<std::system_error>(
+        [] {
+            async_shared_mutex mutex;
+            mutex.unlock();
+        },
+        concurrencpp::details::consts::k_async_shared_mutex_unlock_invalid_lock_err_msg);
+
+    assert_throws_contains_error_message<std::system_error>(
+        [] {
+            async_shared_mutex mutex;
+            mutex.unlock_shared();
+        },
+        concurrencpp::details::consts::k_async_shared_mutex_unlock_shared_invalid_lock_err_msg);
+
+    // unlock() doesn't release a shared lock and vice versa
+    {
+        async_shared_mutex mutex;
+        assert_true(mutex.try_lock_shared());
+        assert_throws<std::system_error>([&mutex] {
+            mutex.unlock();
+        });
+
+        mutex.unlock_shared();
+    }
+
+    {
+        async_shared_mutex mutex;
+        assert_true(mutex.try_lock());
+        assert_throws<std::system_error>([&mutex] {
+            mutex.unlock_shared();
+        });
+
+        mutex.unlock();
+    }
+
+    test_async_shared_mutex_unlock_resumption_fails();
+}
+
+void concurrencpp::tests::test_scoped_async_shared_lock() {
+    async_shared_mutex mutex;
+    const auto ex = std::make_shared<inline_executor>();
+
+    {
+        scoped_async_shared_lock guard;
+        assert_false(guard.owns_lock());
+        assert_false(static_cast<bool>(guard));
+        assert_equal(guard.mutex(), static_cast<async_shared_mutex*>(nullptr));
+
+        assert_throws_contains_error_message<std::system_error>(
+            [&guard] {
+                guard.unlock();
+            },
+            concurrencpp::details::consts::k_scoped_async_shared_lock_unlock_invalid_lock_err_msg);
+    }
+
+    {
+        auto guard = mutex.lock_shared(ex).run().get();
+        assert_true(guard.owns_lock());
+        assert_equal(guard.mutex(), &mutex);
+
+        auto moved = std::move(guard);
+        assert_false(guard.owns_lock());
+        assert_true(moved.owns_lock());
+        assert_false(mutex.try_lock());
+    }
+
+    assert_true(mutex.try_lock());
+    mutex.unlock();
+
+    {
+        auto guard = mutex.lock_shared(ex).run().get();
+        guard.unlock();
+        assert_false(guard.owns_lock());
+        assert_true(mutex.try_lock());
+        mutex.unlock();
+    }
+
+    {
+        auto guard = mutex.lock_shared(ex).run().get();
+        const auto released = guard.release();
+        assert_equal(released, &mutex);
+        assert_false(guard.owns_lock());
+        assert_equal(guard.mutex(), static_cast<async_shared_mutex*>(nullptr));
+
+        released->unlock_shared();
+    }
+
+    {
+        assert_true(mutex.try_lock_shared());
+        scoped_async_shared_lock guard(mutex, std::adopt_lock);
+        assert_true(guard.owns_lock());
+    }
+
+    assert_true(mutex.try_lock());
+    mutex.unlock();
+}
+
+void concurrencpp::tests::test_scoped_async_unique_lock() {
+    async_shared_mutex mutex;
+    const auto ex = std::make_shared<inline_executor>();
+
+    {
+        scoped_async_unique_lock guard;
+        assert_false(guard.owns_lock());
+        assert_false(static_cast<bool>(guard));
+        assert_equal(guard.mutex(), static_cast<async_shared_mutex*>(nullptr));
+
+        assert_throws_contains_error_message<std::system_error>(
+            [&guard] {
+                guard.unlock();
+            },
+            concurrencpp::details::consts::k_scoped_async_unique_lock_unlock_invalid_lock_err_msg);
+    }
+
+    {
+        auto guard = mutex.lock(ex).run().get();
+        assert_true(guard.owns_lock());
+        assert_equal(guard.mutex(), &mutex);
+
+        scoped_async_unique_lock other;
+        other.swap(guard);
+        assert_false(guard.owns_lock());
+        assert_true(other.owns_lock());
+        assert_false(mutex.try_lock_shared());
+    }
+
+    assert_true(mutex.try_lock_shared());
+    mutex.unlock_shared();
+
+    {
+        auto guard = mutex.lock(ex).run().get();
+        guard.unlock();
+        assert_false(guard.owns_lock());
+        assert_true(mutex.try_lock_shared());
+        mutex.unlock_shared();
+    }
+
+    {
+        assert_true(mutex.try_lock());
+        scoped_async_unique_lock guard(mutex, std::adopt_lock);
+        assert_true(guard.owns_lock());
+    }
+
+    assert_true(mutex.try_lock());
+    mutex.unlock();
+}
+
+namespace concurrencpp::tests {
+    result<void> read_or_write(executor_tag,
+                               std::shared_ptr<executor> ex,
+                               async_shared_mutex& mutex,
+                               std::vector<size_t>& vec,
+                               size_t range_begin,
+                               size_t range_end) {
+        for (size_t i = range_begin; i < range_end; i++) {
+            if (i % 4 == 0) {
+                auto lk = co_await mutex.lock(ex);
+                vec.emplace_back(i);
+                continue;
+            }
+
+            auto lk = co_await mutex.lock_shared(ex);
+            const auto size = vec.size();
+            assert_bigger_equal(size, static_cast<size_t>(0));
+        }
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_shared_mutex_mini_load_test() {
+    async_shared_mutex mutex;
+    std::vector<size_t> vector;
+
+    const size_t worker_count = concurrencpp::details::thread::hardware_concurrency();
+    constexpr size_t cycles = 100'000;
+
+    std::vector<std::shared_ptr<worker_thread_executor>> workers(worker_count);
+    for (auto& worker : workers) {
+        worker = std::make_shared<worker_thread_executor>();
+    }
+
+    std::vector<result<void>> results(worker_count);
+
+    for (size_t i = 0; i < worker_count; i++) {
+        results[i] = read_or_write({}, workers[i], mutex, vector, i * cycles, (i + 1) * cycles);
+    }
+
+    for (size_t i = 0; i < worker_count; i++) {
+        results[i].get();
+    }
+
+    {
+        auto lock = mutex.lock(workers[0]).run().get();
+        assert_equal(vector.size(), cycles * worker_count / 4);
+
+        std::sort(vector.begin(), vector.end());
+
+        for (size_t i = 0; i < vector.size(); i++) {
+            assert_equal(vector[i], i * 4);
+        }
+    }
+
+    for (auto& worker : workers) {
+        worker->shutdown();
+    }
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("async_shared_mutex test");
+
+    tester.add_step("lock", test_async_shared_mutex_lock);
+    tester.add_step("lock_shared", test_async_shared_mutex_lock_shared);
+    tester.add_step("try_lock", test_async_shared_mutex_try_lock);
+    tester.add_step("try_lock_shared", test_async_shared_mutex_try_lock_shared);
+    tester.add_step("writer preference", test_async_shared_mutex_writer_preference);
+    tester.add_step("unlock", test_async_shared_mutex_unlock);
+    tester.add_step("scoped_async_shared_lock", test_scoped_async_shared_lock);
+    tester.add_step("scoped_async_unique_lock", test_scoped_async_unique_lock);
+    tester.add_step("lock + unlock", test_async_shared_mutex_mini_load_test);
+
+    tester.launch_test();
+    return 0;
+}
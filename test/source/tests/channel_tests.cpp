@@ -0,0 +1,499 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+
+#include "concurrencpp/threads/constants.h"
+
+#include <numeric>
+
+namespace concurrencpp::tests {
+    void test_channel_constructor();
+
+    void test_channel_try_send_try_receive_bounded();
+    void test_channel_try_send_try_receive_unbounded();
+    void test_channel_try_send_try_receive();
+
+    void test_channel_send_null_resume_executor();
+    void test_channel_send_ready();
+    void test_channel_send_waits_when_full();
+    void test_channel_send_resumption_fails();
+    void test_channel_send();
+
+    void test_channel_receive_null_resume_executor();
+    void test_channel_receive_ready();
+    void test_channel_receive_waits_when_empty();
+    void test_channel_receive_resumption_fails();
+    void test_channel_receive_resumption_fails_full();
+    void test_channel_receive();
+
+    void test_channel_receive_many();
+
+    void test_channel_close();
+
+    void test_channel_mini_load_test(size_t capacity);
+    void test_channel_mini_load_test_bounded();
+    void test_channel_mini_load_test_unbounded();
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_channel_constructor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            channel<int> channel(0);
+        },
+        concurrencpp::details::consts::k_channel_constructor_zero_capacity_err_msg);
+
+    channel<int> bounded(16);
+    assert_equal(bounded.capacity(), static_cast<size_t>(16));
+    assert_false(bounded.is_closed());
+
+    channel<std::string> unbounded(channel<std::string>::unbounded);
+    assert_equal(unbounded.capacity(), channel<std::string>::unbounded);
+    assert_false(unbounded.is_closed());
+}
+
+void concurrencpp::tests::test_channel_try_send_try_receive_bounded() {
+    channel<std::string> channel(3);
+
+    assert_false(channel.try_receive().has_value());
+
+    const std::string first = "first";
+    assert_true(channel.try_send(first));
+    assert_true(channel.try_send(std::string("second")));
+    assert_true(channel.try_send(std::string("third")));
+
+    // a full channel rejects the value and doesn't move from it
+    std::string fourth = "fourth";
+    assert_false(channel.try_send(std::move(fourth)));
+    assert_equal(fourth, std::string("fourth"));
+
+    assert_equal(channel.try_receive().value(), std::string("first"));
+    assert_true(channel.try_send(std::move(fourth)));
+
+    assert_equal(channel.try_receive().value(), std::string("second"));
+    assert_equal(channel.try_receive().value(), std::string("third"));
+    assert_equal(channel.try_receive().value(), std::string("fourth"));
+    assert_false(channel.try_receive().has_value());
+
+    // the ring wraps around many times
+    for (int i = 0; i < 1'000; i++) {
+        assert_true(channel.try_send(std::to_string(i)));
+        assert_true(channel.try_send(std::to_string(i + 1)));
+        assert_equal(channel.try_receive().value(), std::to_string(i));
+        assert_equal(channel.try_receive().value(), std::to_string(i + 1));
+    }
+
+    assert_true(channel.try_send(std::string("left over")));
+}
+
+void concurrencpp::tests::test_channel_try_send_try_receive_unbounded() {
+    channel<int> channel(channel<int>::unbounded);
+
+    for (int i = 0; i < 10'000; i++) {
+        assert_true(channel.try_send(i));
+    }
+
+    auto values = channel.try_receive_many(100);
+    assert_equal(values.size(), static_cast<size_t>(100));
+    for (int i = 0; i < 100; i++) {
+        assert_equal(values[i], i);
+    }
+
+    for (int i = 100; i < 10'000; i++) {
+        assert_equal(channel.try_receive().value(), i);
+    }
+
+    assert_false(channel.try_receive().has_value());
+    assert_true(channel.try_receive_many(100).empty());
+}
+
+void concurrencpp::tests::test_channel_try_send_try_receive() {
+    test_channel_try_send_try_receive_bounded();
+    test_channel_try_send_try_receive_unbounded();
+}
+
+void concurrencpp::tests::test_channel_send_null_resume_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            channel<int> channel(1);
+            channel.send(std::shared_ptr<concurrencpp::inline_executor> {}, 0);
+        },
+        concurrencpp::details::consts::k_channel_send_null_resume_executor_err_msg);
+}
+
+void concurrencpp::tests::test_channel_send_ready() {
+    channel<int> channel(2);
+    const auto ex = std::make_shared<manual_executor>();
+    executor_shutdowner es(ex);
+
+    // sending to a channel with a free slot doesn't suspend
+    auto result = channel.send(ex, 1).run();
+    assert_equal(result.status(), result_status::value);
+    assert_true(result.get());
+    assert_equal(ex->size(), static_cast<size_t>(0));
+
+    assert_equal(channel.try_receive().value(), 1);
+}
+
+void concurrencpp::tests::test_channel_send_waits_when_full() {
+    channel<int> channel(1);
+    const auto ex = std::make_shared<manual_executor>();
+    executor_shutdowner es(ex);
+
+    assert_true(channel.try_send(0));
+
+    auto r1 = channel.send(ex, 1).run();
+    auto r2 = channel.send(ex, 2).run();
+    assert_equal(r1.status(), result_status::idle);
+    assert_equal(r2.status(), result_status::idle);
+
+    // every value taken out of the channel lets one waiting sender in
+    assert_equal(channel.try_receive().value(), 0);
+    assert_equal(ex->size(), static_cast<size_t>(1));
+
+    assert_equal(channel.try_receive().value(), 1);
+    assert_equal(ex->size(), static_cast<size_t>(2));
+
+    assert_equal(channel.try_receive().value(), 2);
+    assert_false(channel.try_receive().has_value());
+
+    ex->loop(2);
+    assert_true(r1.get());
+    assert_true(r2.get());
+}
+
+void concurrencpp::tests::test_channel_send_resumption_fails() {
+    channel<int> channel(1);
+    const auto ex = std::make_shared<manual_executor>();
+
+    assert_true(channel.try_send(0));
+    auto result = channel.send(ex, 1).run();
+    ex->shutdown();
+
+    assert_equal(channel.try_receive().value(), 0);
+
+    assert_throws<errors::broken_task>([&result] {
+        result.get();
+    });
+
+    // the value itself was sent
+    assert_equal(channel.try_receive().value(), 1);
+}
+
+void concurrencpp::tests::test_channel_send() {
+    test_channel_send_null_resume_executor();
+    test_channel_send_ready();
+    test_channel_send_waits_when_full();
+    test_channel_send_resumption_fails();
+}
+
+void concurrencpp::tests::test_channel_receive_null_resume_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            channel<int> channel(1);
+            channel.receive(std::shared_ptr<concurrencpp::inline_executor> {});
+        },
+        concurrencpp::details::consts::k_channel_receive_null_resume_executor_err_msg);
+}
+
+void concurrencpp::tests::test_channel_receive_ready() {
+    channel<int> channel(2);
+    const auto ex = std::make_shared<manual_executor>();
+    executor_shutdowner es(ex);
+
+    assert_true(channel.try_send(7));
+
+    auto result = channel.receive(ex).run();
+    assert_equal(result.status(), result_status::value);
+    assert_equal(result.get().value(), 7);
+    assert_equal(ex->size(), static_cast<size_t>(0));
+}
+
+namespace concurrencpp::tests {
+    lazy_result<void> receive_and_record(channel<int>& channel, std::shared_ptr<executor> ex, std::vector<int>& received) {
+        auto value = co_await channel.receive(ex);
+        received.emplace_back(value.value());
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_channel_receive_waits_when_empty() {
+    constexpr size_t receiver_count = 16;
+    const auto ex = std::make_shared<manual_executor>();
+    executor_shutdowner es(ex);
+
+    for (const auto capacity : {size_t(4), channel<int>::unbounded}) {
+        channel<int> channel(capacity);
+        std::vector<int> received;
+        std::vector<result<void>> results;
+
+        for (size_t i = 0; i < receiver_count; i++) {
+            results.emplace_back(receive_and_record(channel, ex, received).run());
+            assert_equal(results.back().status(), result_status::idle);
+        }
+
+        // values are handed to the waiting receivers in the order they started waiting
+        for (size_t i = 0; i < receiver_count; i++) {
+            assert_true(channel.try_send(static_cast<int>(i)));
+            assert_equal(ex->size(), static_cast<size_t>(1));
+            ex->loop_once();
+        }
+
+        for (auto& result : results) {
+            result.get();
+        }
+
+        assert_equal(received.size(), receiver_count);
+        for (size_t i = 0; i < receiver_count; i++) {
+            assert_equal(received[i], static_cast<int>(i));
+        }
+
+        assert_false(channel.try_receive().has_value());
+    }
+}
+
+void concurrencpp::tests::test_channel_receive_resumption_fails() {
+    channel<int> channel(4);
+    const auto dead_ex = std::make_shared<manual_executor>();
+
+    auto result = channel.receive(dead_ex).run();
+    dead_ex->shutdown();
+
+    assert_true(channel.try_send(1));
+
+    assert_throws<errors::broken_task>([&result] {
+        result.get();
+    });
+
+    // the value handed to the broken receiver is put back
+    assert_equal(channel.try_receive().value(), 1);
+}
+
+void concurrencpp::tests::test_channel_receive_resumption_fails_full() {
+    constexpr auto unbounded = channel<int>::unbounded;
+
+    for (const auto capacity : {size_t(2), unbounded}) {
+        channel<int> channel(capacity);
+        const auto ex = std::make_shared<manual_executor>();
+
+        auto result = channel.receive(ex).run();
+        assert_equal(result.status(), result_status::idle);
+
+        // 1 is handed to the receiver, which now waits to be resumed by ex
+        assert_true(channel.try_send(1));
+        assert_equal(ex->size(), static_cast<size_t>(1));
+
+        // the channel fills up again before the resumption fails
+        assert_true(channel.try_send(2));
+        assert_true(channel.try_send(3));
+
+        if (capacity != unbounded) {
+            assert_false(channel.try_send(4));
+        }
+
+        ex->shutdown();
+
+        assert_throws<errors::broken_task>([&result] {
+            result.get();
+        });
+
+        // 1 is neither lost nor reordered
+        assert_equal(channel.try_receive().value(), 1);
+        assert_equal(channel.try_receive().value(), 2);
+        assert_equal(channel.try_receive().value(), 3);
+        assert_false(channel.try_receive().has_value());
+    }
+}
+
+void concurrencpp::tests::test_channel_receive() {
+    test_channel_receive_null_resume_executor();
+    test_channel_receive_ready();
+    test_channel_receive_waits_when_empty();
+    test_channel_receive_resumption_fails();
+    test_channel_receive_resumption_fails_full();
+}
+
+void concurrencpp::tests::test_channel_receive_many() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            channel<int> channel(1);
+            channel.receive_many(std::shared_ptr<concurrencpp::inline_executor> {}, 1);
+        },
+        concurrencpp::details::consts::k_channel_receive_many_null_resume_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            channel<int> channel(1);
+            channel.receive_many(std::make_shared<concurrencpp::inline_executor>(), 0);
+        },
+        concurrencpp::details::consts::k_channel_receive_many_zero_max_count_err_msg);
+
+    channel<int> channel(8);
+    const auto ex = std::make_shared<manual_executor>();
+    executor_shutdowner es(ex);
+
+    for (int i = 0; i < 5; i++) {
+        assert_true(channel.try_send(i));
+    }
+
+    // takes up to max_count values without suspending
+    auto values = channel.receive_many(ex, 3).run().get();
+    assert_equal(values, std::vector<int> {0, 1, 2});
+
+    values = channel.receive_many(ex, 3).run().get();
+    assert_equal(values, std::vector<int> {3, 4});
+
+    // suspends until at least one value is available, then takes whatever is there
+    auto result = channel.receive_many(ex, 3).run();
+    assert_equal(result.status(), result_status::idle);
+
+    assert_true(channel.try_send(5));
+    assert_true(channel.try_send(6));
+
+    ex->loop_once();
+    values = result.get();
+    assert_equal(values, std::vector<int> {5, 6});
+
+    // a closed and drained channel returns an empty batch
+    channel.close();
+    assert_true(channel.receive_many(ex, 3).run().get().empty());
+}
+
+void concurrencpp::tests::test_channel_close() {
+    const auto ex = std::make_shared<manual_executor>();
+    executor_shutdowner es(ex);
+
+    // waiting senders are resumed with false
+    {
+        channel<int> channel(1);
+        assert_true(channel.try_send(0));
+
+        auto sender = channel.send(ex, 1).run();
+        channel.close();
+        assert_true(channel.is_closed());
+
+        ex->loop_once();
+        assert_false(sender.get());
+
+        // new sends fail, but buffered values are still delivered
+        assert_false(channel.try_send(2));
+        assert_false(channel.send(ex, 3).run().get());
+
+        assert_equal(channel.receive(ex).run().get().value(), 0);
+        assert_false(channel.receive(ex).run().get().has_value());
+        assert_false(channel.try_receive().has_value());
+
+        // closing twice is a no-op
+        channel.close();
+    }
+
+    // waiting receivers are resumed with an empty optional
+    {
+        channel<int> channel(channel<int>::unbounded);
+
+        auto r0 = channel.receive(ex).run();
+        auto r1 = channel.receive(ex).run();
+        channel.close();
+
+        assert_equal(ex->size(), static_cast<size_t>(2));
+        ex->loop(2);
+
+        assert_false(r0.get().has_value());
+        assert_false(r1.get().has_value());
+    }
+}
+
+namespace concurrencpp::tests {
+    result<void> produce(executor_tag, std::shared_ptr<executor> ex, channel<size_t>& channel, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            const auto sent = co_await channel.send(ex, i);
+            assert_true(sent);
+        }
+    }
+
+    result<size_t> consume(executor_tag, std::shared_ptr<executor> ex, channel<size_t>& channel, size_t& count) {
+        size_t sum = 0;
+
+        while (true) {
+            auto values = co_await channel.receive_many(ex, 8);
+            if (values.empty()) {
+                co_return sum;
+            }
+
+            count += values.size();
+            sum = std::accumulate(values.begin(), values.end(), sum);
+        }
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_channel_mini_load_test(size_t capacity) {
+    constexpr size_t values_per_producer = 100'000;
+    const size_t worker_count = std::max(concurrencpp::details::thread::hardware_concurrency() / 2, size_t(2));
+
+    channel<size_t> channel(capacity);
+
+    std::vector<std::shared_ptr<worker_thread_executor>> producers(worker_count), consumers(worker_count);
+    for (size_t i = 0; i < worker_count; i++) {
+        producers[i] = std::make_shared<worker_thread_executor>();
+        consumers[i] = std::make_shared<worker_thread_executor>();
+    }
+
+    std::vector<size_t> counts(worker_count, 0);
+    std::vector<result<size_t>> consumer_results(worker_count);
+    for (size_t i = 0; i < worker_count; i++) {
+        consumer_results[i] = consume({}, consumers[i], channel, counts[i]);
+    }
+
+    std::vector<result<void>> producer_results(worker_count);
+    for (size_t i = 0; i < worker_count; i++) {
+        producer_results[i] = produce({}, producers[i], channel, i * values_per_producer, (i + 1) * values_per_producer);
+    }
+
+    for (auto& result : producer_results) {
+        result.get();
+    }
+
+    channel.close();
+
+    size_t sum = 0, count = 0;
+    for (size_t i = 0; i < worker_count; i++) {
+        sum += consumer_results[i].get();
+        count += counts[i];
+    }
+
+    const auto total = values_per_producer * worker_count;
+    assert_equal(count, total);
+    assert_equal(sum, total * (total - 1) / 2);
+
+    for (size_t i = 0; i < worker_count; i++) {
+        producers[i]->shutdown();
+        consumers[i]->shutdown();
+    }
+}
+
+void concurrencpp::tests::test_channel_mini_load_test_bounded() {
+    test_channel_mini_load_test(1);
+    test_channel_mini_load_test(64);
+}
+
+void concurrencpp::tests::test_channel_mini_load_test_unbounded() {
+    test_channel_mini_load_test(channel<size_t>::unbounded);
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("channel test");
+
+    tester.add_step("constructor", test_channel_constructor);
+    tester.add_step("try_send + try_receive", test_channel_try_send_try_receive);
+    tester.add_step("send", test_channel_send);
+    tester.add_step("receive", test_channel_receive);
+    tester.add_step("receive_many", test_channel_receive_many);
+    tester.add_step("close", test_channel_close);
+    tester.add_step("send + receive (bounded)", test_channel_mini_load_test_bounded);
+    tester.add_step("send + receive (unbounded)", test_channel_mini_load_test_unbounded);
+
+    tester.launch_test();
+    return 0;
+}
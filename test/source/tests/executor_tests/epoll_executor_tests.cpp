@@ -0,0 +1,521 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/object_observer.h"
+#include "utils/executor_shutdowner.h"
+#include "utils/test_thread_callbacks.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+
+namespace concurrencpp::tests {
+    void test_epoll_executor_name();
+
+    void test_epoll_executor_shutdown_method_access();
+    void test_epoll_executor_shutdown_more_than_once();
+    void test_epoll_executor_shutdown_pending_awaitable();
+    void test_epoll_executor_shutdown();
+
+    void test_epoll_executor_max_concurrency_level();
+
+    void test_epoll_executor_post_foreign();
+    void test_epoll_executor_post_inline();
+    void test_epoll_executor_post();
+
+    void test_epoll_executor_submit();
+
+    void test_epoll_executor_pipe_readable();
+    void test_epoll_executor_pipe_writable();
+    void test_epoll_executor_edge_before_await();
+    void test_epoll_executor_socket_echo();
+    void test_epoll_executor_timeout();
+    void test_epoll_executor_unregister();
+    void test_epoll_executor_bad_fd();
+    void test_epoll_executor_many_fds();
+    void test_epoll_executor_timer_queue();
+
+    void test_epoll_executor_thread_callbacks();
+}  // namespace concurrencpp::tests
+
+using concurrencpp::epoll_executor;
+
+namespace concurrencpp::tests {
+    struct pipe_fds {
+        int read_end = -1;
+        int write_end = -1;
+
+        pipe_fds() {
+            int fds[2];
+            assert_equal(::pipe2(fds, O_NONBLOCK | O_CLOEXEC), 0);
+            read_end = fds[0];
+            write_end = fds[1];
+        }
+
+        ~pipe_fds() noexcept {
+            ::close(read_end);
+            ::close(write_end);
+        }
+    };
+
+    struct loopback_connection {
+        int server = -1;
+        int client = -1;
+
+        loopback_connection() {
+            const auto listener = ::socket(AF_INET, SOCK_STREAM, 0);
+            assert_not_equal(listener, -1);
+
+            sockaddr_in address {};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            address.sin_port = 0;
+
+            assert_equal(::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+            assert_equal(::listen(listener, 1), 0);
+
+            socklen_t length = sizeof(address);
+            assert_equal(::getsockname(listener, reinterpret_cast<sockaddr*>(&address), &length), 0);
+
+            client = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+            assert_not_equal(client, -1);
+
+            const auto res = ::connect(client, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+            assert_true(res == 0 || errno == EINPROGRESS);
+
+            server = ::accept4(listener, nullptr, nullptr, SOCK_NONBLOCK);
+            assert_not_equal(server, -1);
+            ::close(listener);
+        }
+
+        ~loopback_connection() noexcept {
+            ::close(client);
+            ::close(server);
+        }
+    };
+
+    result<std::string> read_some(std::shared_ptr<epoll_executor> executor, int fd) {
+        char buffer[64];
+        while (true) {
+            const auto read = ::read(fd, buffer, sizeof(buffer));
+            if (read >= 0) {
+                co_return std::string(buffer, static_cast<size_t>(read));
+            }
+
+            assert_equal(errno, EAGAIN);
+            co_await executor->readable(fd);
+        }
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_epoll_executor_name() {
+    auto executor = std::make_shared<epoll_executor>();
+    executor_shutdowner shutdown(executor);
+
+    assert_equal(executor->name, concurrencpp::details::consts::k_epoll_executor_name);
+}
+
+void concurrencpp::tests::test_epoll_executor_shutdown_method_access() {
+    auto executor = std::make_shared<epoll_executor>();
+    assert_false(executor->shutdown_requested());
+
+    executor->shutdown();
+    assert_true(executor->shutdown_requested());
+
+    assert_throws<concurrencpp::errors::runtime_shutdown>([executor] {
+        executor->enqueue(concurrencpp::task {});
+    });
+
+    assert_throws<concurrencpp::errors::runtime_shutdown>([executor] {
+        concurrencpp::task array[4];
+        std::span<concurrencpp::task> span = array;
+        executor->enqueue(span);
+    });
+
+    // awaiting a shut down reactor resumes the coroutine with broken_task
+    pipe_fds pipe;
+    auto wait = [](std::shared_ptr<epoll_executor> executor, int fd) -> result<bool> {
+        co_return co_await executor->readable(fd);
+    };
+
+    assert_throws<concurrencpp::errors::broken_task>([&] {
+        wait(executor, pipe.read_end).get();
+    });
+}
+
+void concurrencpp::tests::test_epoll_executor_shutdown_more_than_once() {
+    auto executor = std::make_shared<epoll_executor>();
+    for (size_t i = 0; i < 4; i++) {
+        executor->shutdown();
+    }
+}
+
+void concurrencpp::tests::test_epoll_executor_shutdown_pending_awaitable() {
+    auto executor = std::make_shared<epoll_executor>();
+    pipe_fds pipe;
+
+    auto result = read_some(executor, pipe.read_end);  // nothing is ever written
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    executor->shutdown();
+
+    assert_throws<concurrencpp::errors::broken_task>([&result] {
+        result.get();
+    });
+}
+
+void concurrencpp::tests::test_epoll_executor_shutdown() {
+    test_epoll_executor_shutdown_method_access();
+    test_epoll_executor_shutdown_more_than_once();
+    test_epoll_executor_shutdown_pending_awaitable();
+}
+
+void concurrencpp::tests::test_epoll_executor_max_concurrency_level() {
+    auto executor = std::make_shared<epoll_executor>();
+    executor_shutdowner shutdown(executor);
+
+    assert_equal(executor->max_concurrency_level(), concurrencpp::details::consts::k_epoll_executor_max_concurrency_level);
+}
+
+void concurrencpp::tests::test_epoll_executor_post_foreign() {
+    object_observer observer;
+    const size_t task_count = 1'024;
+    auto executor = std::make_shared<epoll_executor>();
+    executor_shutdowner shutdown(executor);
+
+    for (size_t i = 0; i < task_count; i++) {
+        executor->post(observer.get_testing_stub());
+    }
+
+    assert_true(observer.wait_execution_count(task_count, std::chrono::minutes(1)));
+    assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
+    assert_equal(observer.get_execution_map().size(), static_cast<size_t>(1));
+}
+
+void concurrencpp::tests::test_epoll_executor_post_inline() {
+    object_observer observer;
+    constexpr size_t task_count = 1'024;
+    auto executor = std::make_shared<epoll_executor>();
+    executor_shutdowner shutdown(executor);
+
+    executor->post([executor, &observer] {
+        for (size_t i = 0; i < task_count; i++) {
+            executor->post(observer.get_testing_stub());
+        }
+    });
+
+    assert_true(observer.wait_execution_count(task_count, std::chrono::minutes(1)));
+    assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
+    assert_equal(observer.get_execution_map().size(), static_cast<size_t>(1));
+}
+
+void concurrencpp::tests::test_epoll_executor_post() {
+    test_epoll_executor_post_foreign();
+    test_epoll_executor_post_inline();
+}
+
+void concurrencpp::tests::test_epoll_executor_submit() {
+    object_observer observer;
+    const size_t task_count = 1'024;
+    auto executor = std::make_shared<epoll_executor>();
+    executor_shutdowner shutdown(executor);
+
+    std::vector<result<size_t>> results;
+    results.resize(task_count);
+
+    for (size_t i = 0; i < task_count; i++) {
+        results[i] = executor->submit(observer.get_testing_stub(i));
+    }
+
+    for (size_t i = 0; i < task_count; i++) {
+        assert_equal(results[i].get(), i);
+    }
+}
+
+void concurrencpp::tests::test_epoll_executor_pipe_readable() {
+    auto executor = std::make_shared<epoll_executor>();
+    executor_shutdowner shutdown(executor);
+    pipe_fds pipe;
+
+    for (size_t i = 0; i < 16; i++) {
+        auto result = read_some(executor, pipe.read_end);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        assert_equal(result.status(), result_status::idle);
+
+        const auto message = "message #" + std::to_string(i);
+        assert_equal(::write(pipe.write_end, message.data(), message.size()), static_cast<ssize_t>(message.size()));
+        assert_equal(result.get(), message);
+    }
+}
+
+void concurrencpp::tests::test_epoll_executor_pipe_writable() {
+    auto executor = std::make_shared<epoll_executor>();
+    executor_shutdowner shutdown(executor);
+    pipe_fds pipe;
+
+    // fill the pipe so the writer has to wait
+    std::vector<char> chunk(4'096, 'x');
+    size_t buffered = 0;
+    while (true) {
+        const auto written = ::write(pipe.write_end, chunk.data(), chunk.size());
+        if (written == -1) {
+            assert_equal(errno, EAGAIN);
+            break;
+        }
+
+        buffered += static_cast<size_t>(written);
+    }
+
+    auto write_one = [](std::shared_ptr<epoll_executor> executor, int fd) -> result<size_t> {
+        while (true) {
+            const char c = 'y';
+            const auto written = ::write(fd, &c, 1);
+            if (written == 1) {
+                co_return static_cast<size_t>(written);
+            }
+
+            assert_equal(errno, EAGAIN);
+            co_await executor->writable(fd);
+        }
+    };
+
+    auto result = write_one(executor, pipe.write_end);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    assert_equal(result.status(), result_status::idle);
+
+    // drain the pipe, which makes the write end writable again
+    while (buffered != 0) {
+        const auto read = ::read(pipe.read_end, chunk.data(), std::min(chunk.size(), buffered));
+        assert_true(read > 0);
+        buffered -= static_cast<size_t>(read);
+    }
+
+    assert_equal(result.get(), static_cast<size_t>(1));
+}
+
+void concurrencpp::tests::test_epoll_executor_edge_before_await() {
+    auto executor = std::make_shared<epoll_executor>();
+    executor_shutdowner shutdown(executor);
+    pipe_fds pipe, gate;
+
+    /*
+        The descriptor is registered by the first wait, the edge arrives while the coroutine waits on the gate,
+        and the last wait is satisfied by the edge that was recorded meanwhile.
+    */
+    auto wait = [](std::shared_ptr<epoll_executor> executor, int fd, int gate_fd) -> result<bool> {
+        const auto ready = co_await executor->readable(fd, std::chrono::milliseconds(10));
+        assert_false(ready);
+
+        co_await executor->readable(gate_fd);
+        co_return co_await executor->readable(fd, std::chrono::seconds(10));
+    };
+
+    auto result = wait(executor, pipe.read_end, gate.read_end);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    assert_equal(::write(pipe.write_end, "a", 1), static_cast<ssize_t>(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    assert_equal(::write(gate.write_end, "a", 1), static_cast<ssize_t>(1));
+
+    assert_true(result.get());
+}
+
+void concurrencpp::tests::test_epoll_executor_socket_echo() {
+    auto executor = std::make_shared<epoll_executor>();
+    executor_shutdowner shutdown(executor);
+    loopback_connection connection;
+
+    auto echo_server = [](std::shared_ptr<epoll_executor> executor, int fd) -> result<size_t> {
+        size_t echoed = 0;
+        while (true) {
+            const auto message = co_await read_some(executor, fd);
+            if (message.empty()) {
+                co_return echoed;  // the client closed the connection
+            }
+
+            size_t sent = 0;
+            while (sent != message.size()) {
+                const auto res = ::send(fd, message.data() + sent, message.size() - sent, MSG_NOSIGNAL);
+                if (res >= 0) {
+                    sent += static_cast<size_t>(res);
+                    continue;
+                }
+
+                assert_equal(errno, EAGAIN);
+                co_await executor->writable(fd);
+            }
+
+            echoed += message.size();
+        }
+    };
+
+    auto client = [](std::shared_ptr<epoll_executor> executor, int fd) -> result<void> {
+        for (size_t i = 0; i < 32; i++) {
+            const auto message = "ping #" + std::to_string(i);
+            assert_equal(::send(fd, message.data(), message.size(), MSG_NOSIGNAL), static_cast<ssize_t>(message.size()));
+
+            std::string reply;
+            while (reply.size() != message.size()) {
+                reply += co_await read_some(executor, fd);
+            }
+
+            assert_equal(reply, message);
+        }
+
+        ::shutdown(fd, SHUT_WR);
+    };
+
+    auto server_result = echo_server(executor, connection.server);
+    client(executor, connection.client).get();
+
+    assert_true(server_result.get() > 0);
+}
+
+void concurrencpp::tests::test_epoll_executor_timeout() {
+    auto executor = std::make_shared<epoll_executor>();
+    executor_shutdowner shutdown(executor);
+    pipe_fds pipe;
+
+    auto wait = [](std::shared_ptr<epoll_executor> executor, int fd) -> result<std::chrono::milliseconds> {
+        const auto before = std::chrono::steady_clock::now();
+        const auto ready = co_await executor->readable(fd, std::chrono::milliseconds(100));
+        assert_false(ready);
+        co_return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - before);
+    };
+
+    const auto elapsed = wait(executor, pipe.read_end).get();
+    assert_bigger_equal(elapsed, std::chrono::milliseconds(100));
+    assert_smaller(elapsed, std::chrono::seconds(5));
+
+    // a deadline that isn't reached doesn't affect the result
+    auto wait_ready = [](std::shared_ptr<epoll_executor> executor, int fd) -> result<bool> {
+        co_return co_await executor->readable(fd, std::chrono::seconds(30));
+    };
+
+    auto result = wait_ready(executor, pipe.read_end);
+    assert_equal(::write(pipe.write_end, "a", 1), static_cast<ssize_t>(1));
+    assert_true(result.get());
+}
+
+void concurrencpp::tests::test_epoll_executor_unregister() {
+    auto executor = std::make_shared<epoll_executor>();
+    executor_shutdowner shutdown(executor);
+    pipe_fds pipe;
+
+    auto result = read_some(executor, pipe.read_end);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    executor->unregister(pipe.read_end);
+
+    try {
+        result.get();
+        assert_false(true);
+    } catch (const std::system_error& error) {
+        assert_equal(error.code().value(), ECANCELED);
+    }
+
+    // the descriptor can be awaited again after it was unregistered
+    auto result1 = read_some(executor, pipe.read_end);
+    assert_equal(::write(pipe.write_end, "abc", 3), static_cast<ssize_t>(3));
+    assert_equal(result1.get(), std::string("abc"));
+}
+
+void concurrencpp::tests::test_epoll_executor_bad_fd() {
+    auto executor = std::make_shared<epoll_executor>();
+    executor_shutdowner shutdown(executor);
+
+    auto wait = [](std::shared_ptr<epoll_executor> executor) -> result<bool> {
+        co_return co_await executor->readable(-1);
+    };
+
+    try {
+        wait(executor).get();
+        assert_false(true);
+    } catch (const std::system_error& error) {
+        assert_equal(error.code().value(), EBADF);
+    }
+}
+
+void concurrencpp::tests::test_epoll_executor_many_fds() {
+    constexpr size_t pipe_count = 64;
+
+    auto executor = std::make_shared<epoll_executor>();
+    executor_shutdowner shutdown(executor);
+
+    std::vector<pipe_fds> pipes(pipe_count);
+    std::vector<result<std::string>> results;
+
+    for (auto& pipe : pipes) {
+        results.emplace_back(read_some(executor, pipe.read_end));
+    }
+
+    for (size_t i = 0; i < pipe_count; i++) {
+        const auto index = pipe_count - 1 - i;
+        const auto message = std::to_string(index);
+        assert_equal(::write(pipes[index].write_end, message.data(), message.size()), static_cast<ssize_t>(message.size()));
+    }
+
+    for (size_t i = 0; i < pipe_count; i++) {
+        assert_equal(results[i].get(), std::to_string(i));
+    }
+}
+
+void concurrencpp::tests::test_epoll_executor_timer_queue() {
+    auto executor = std::make_shared<epoll_executor>();
+    executor_shutdowner shutdown(executor);
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(std::chrono::seconds(10));
+    pipe_fds pipe;
+
+    // a delay object resumes the coroutine inside the reactor, which then waits on a descriptor
+    auto delayed_read = [](std::shared_ptr<epoll_executor> executor,
+                           std::shared_ptr<concurrencpp::timer_queue> timer_queue,
+                           int fd) -> result<std::string> {
+        co_await timer_queue->make_delay_object(std::chrono::milliseconds(20), executor);
+        co_return co_await read_some(executor, fd);
+    };
+
+    auto result = delayed_read(executor, timer_queue, pipe.read_end);
+    auto timer = timer_queue->make_one_shot_timer(std::chrono::milliseconds(60), executor, [fd = pipe.write_end] {
+        ::write(fd, "timer", 5);
+    });
+
+    assert_equal(result.get(), std::string("timer"));
+}
+
+void concurrencpp::tests::test_epoll_executor_thread_callbacks() {
+    test_thread_callbacks(
+        [](auto thread_started_callback, auto thread_terminated_callback) {
+            return std::make_shared<epoll_executor>(thread_started_callback, thread_terminated_callback);
+        },
+        concurrencpp::details::make_executor_worker_name(concurrencpp::details::consts::k_epoll_executor_name));
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("epoll_executor test");
+
+    tester.add_step("name", test_epoll_executor_name);
+    tester.add_step("shutdown", test_epoll_executor_shutdown);
+    tester.add_step("max_concurrency_level", test_epoll_executor_max_concurrency_level);
+    tester.add_step("post", test_epoll_executor_post);
+    tester.add_step("submit", test_epoll_executor_submit);
+    tester.add_step("readable (pipe)", test_epoll_executor_pipe_readable);
+    tester.add_step("writable (pipe)", test_epoll_executor_pipe_writable);
+    tester.add_step("edge before await", test_epoll_executor_edge_before_await);
+    tester.add_step("echo (loopback socket)", test_epoll_executor_socket_echo);
+    tester.add_step("timeout", test_epoll_executor_timeout);
+    tester.add_step("unregister", test_epoll_executor_unregister);
+    tester.add_step("bad fd", test_epoll_executor_bad_fd);
+    tester.add_step("many fds", test_epoll_executor_many_fds);
+    tester.add_step("timer_queue", test_epoll_executor_timer_queue);
+    tester.add_step("thread_callbacks", test_epoll_executor_thread_callbacks);
+
+    tester.launch_test();
+    return 0;
+}
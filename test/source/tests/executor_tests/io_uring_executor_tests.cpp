@@ -0,0 +1,470 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/object_observer.h"
+#include "utils/executor_shutdowner.h"
+#include "utils/test_thread_callbacks.h"
+
+#include <cstring>
+#include <numeric>
+#include <iostream>
+#include <filesystem>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+
+namespace concurrencpp::tests {
+    void test_io_uring_executor_name();
+
+    void test_io_uring_executor_shutdown_method_access();
+    void test_io_uring_executor_shutdown_more_than_once();
+    void test_io_uring_executor_shutdown_pending_operation();
+    void test_io_uring_executor_shutdown();
+
+    void test_io_uring_executor_max_concurrency_level();
+
+    void test_io_uring_executor_post_foreign();
+    void test_io_uring_executor_post_inline();
+    void test_io_uring_executor_post();
+
+    void test_io_uring_executor_submit();
+
+    void test_io_uring_executor_null_resume_executor();
+    void test_io_uring_executor_file_operations();
+    void test_io_uring_executor_readv();
+    void test_io_uring_executor_timeout();
+    void test_io_uring_executor_socket_operations();
+    void test_io_uring_executor_operation_error();
+    void test_io_uring_executor_resume_executor();
+    void test_io_uring_executor_many_operations();
+
+    void test_io_uring_executor_thread_callbacks();
+}  // namespace concurrencpp::tests
+
+using concurrencpp::io_uring_executor;
+
+namespace concurrencpp::tests {
+    class temp_file {
+
+       private:
+        std::filesystem::path m_path;
+
+       public:
+        temp_file() {
+            const auto suffix = std::to_string(::getpid()) + "_" + std::to_string(reinterpret_cast<uintptr_t>(this));
+            m_path = std::filesystem::temp_directory_path() / ("concurrencpp_io_uring_test_" + suffix);
+        }
+
+        ~temp_file() noexcept {
+            std::error_code ec;
+            std::filesystem::remove(m_path, ec);
+        }
+
+        std::string path() const {
+            return m_path.string();
+        }
+    };
+
+    struct socket_pair {
+        int listener = -1;
+        int client = -1;
+
+        socket_pair() {
+            listener = ::socket(AF_INET, SOCK_STREAM, 0);
+            assert_not_equal(listener, -1);
+
+            sockaddr_in address {};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            address.sin_port = 0;
+
+            assert_equal(::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+            assert_equal(::listen(listener, 16), 0);
+
+            socklen_t length = sizeof(address);
+            assert_equal(::getsockname(listener, reinterpret_cast<sockaddr*>(&address), &length), 0);
+
+            client = ::socket(AF_INET, SOCK_STREAM, 0);
+            assert_not_equal(client, -1);
+            assert_equal(::connect(client, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+        }
+
+        ~socket_pair() noexcept {
+            ::close(client);
+            ::close(listener);
+        }
+    };
+
+    std::vector<std::byte> make_bytes(std::string_view text) {
+        std::vector<std::byte> bytes(text.size());
+        std::memcpy(bytes.data(), text.data(), text.size());
+        return bytes;
+    }
+
+    // io_uring may be disabled by the kernel or a seccomp profile, in which case there is nothing to test
+    std::shared_ptr<io_uring_executor> make_io_uring_executor() {
+        try {
+            return std::make_shared<io_uring_executor>();
+        } catch (const std::system_error&) {
+            return {};
+        }
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_io_uring_executor_name() {
+    auto executor = make_io_uring_executor();
+    executor_shutdowner shutdown(executor);
+
+    assert_equal(executor->name, concurrencpp::details::consts::k_io_uring_executor_name);
+}
+
+void concurrencpp::tests::test_io_uring_executor_shutdown_method_access() {
+    auto executor = make_io_uring_executor();
+    assert_false(executor->shutdown_requested());
+
+    executor->shutdown();
+    assert_true(executor->shutdown_requested());
+
+    assert_throws<concurrencpp::errors::runtime_shutdown>([executor] {
+        executor->enqueue(concurrencpp::task {});
+    });
+
+    assert_throws<concurrencpp::errors::runtime_shutdown>([executor] {
+        concurrencpp::task array[4];
+        std::span<concurrencpp::task> span = array;
+        executor->enqueue(span);
+    });
+
+    auto timeout = [](std::shared_ptr<io_uring_executor> executor) -> result<void> {
+        co_await executor->timeout(executor, std::chrono::milliseconds(1));
+    };
+
+    assert_throws<concurrencpp::errors::runtime_shutdown>([executor, timeout] {
+        timeout(executor).get();
+    });
+}
+
+void concurrencpp::tests::test_io_uring_executor_shutdown_more_than_once() {
+    auto executor = make_io_uring_executor();
+    for (size_t i = 0; i < 4; i++) {
+        executor->shutdown();
+    }
+}
+
+void concurrencpp::tests::test_io_uring_executor_shutdown_pending_operation() {
+    auto executor = make_io_uring_executor();
+    socket_pair sockets;
+
+    auto accept_and_recv = [](std::shared_ptr<io_uring_executor> executor, int listener) -> result<size_t> {
+        const auto fd = co_await executor->accept(executor, listener);
+        std::byte buffer[16];
+        co_return co_await executor->recv(executor, fd, buffer);  // nothing is ever sent
+    };
+
+    auto timeout = [](std::shared_ptr<io_uring_executor> executor) -> result<void> {
+        co_await executor->timeout(executor, std::chrono::hours(1));
+    };
+
+    auto recv_result = accept_and_recv(executor, sockets.listener);
+    auto timeout_result = timeout(executor);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    executor->shutdown();
+
+    assert_throws<concurrencpp::errors::broken_task>([&recv_result] {
+        recv_result.get();
+    });
+
+    assert_throws<concurrencpp::errors::broken_task>([&timeout_result] {
+        timeout_result.get();
+    });
+}
+
+void concurrencpp::tests::test_io_uring_executor_shutdown() {
+    test_io_uring_executor_shutdown_method_access();
+    test_io_uring_executor_shutdown_more_than_once();
+    test_io_uring_executor_shutdown_pending_operation();
+}
+
+void concurrencpp::tests::test_io_uring_executor_max_concurrency_level() {
+    auto executor = make_io_uring_executor();
+    executor_shutdowner shutdown(executor);
+
+    assert_equal(executor->max_concurrency_level(), concurrencpp::details::consts::k_io_uring_executor_max_concurrency_level);
+}
+
+void concurrencpp::tests::test_io_uring_executor_post_foreign() {
+    object_observer observer;
+    const size_t task_count = 1'024;
+    auto executor = make_io_uring_executor();
+    executor_shutdowner shutdown(executor);
+
+    for (size_t i = 0; i < task_count; i++) {
+        executor->post(observer.get_testing_stub());
+    }
+
+    assert_true(observer.wait_execution_count(task_count, std::chrono::minutes(1)));
+    assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
+    assert_equal(observer.get_execution_map().size(), static_cast<size_t>(1));
+}
+
+void concurrencpp::tests::test_io_uring_executor_post_inline() {
+    object_observer observer;
+    constexpr size_t task_count = 1'024;
+    auto executor = make_io_uring_executor();
+    executor_shutdowner shutdown(executor);
+
+    executor->post([executor, &observer] {
+        for (size_t i = 0; i < task_count; i++) {
+            executor->post(observer.get_testing_stub());
+        }
+    });
+
+    assert_true(observer.wait_execution_count(task_count, std::chrono::minutes(1)));
+    assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
+    assert_equal(observer.get_execution_map().size(), static_cast<size_t>(1));
+}
+
+void concurrencpp::tests::test_io_uring_executor_post() {
+    test_io_uring_executor_post_foreign();
+    test_io_uring_executor_post_inline();
+}
+
+void concurrencpp::tests::test_io_uring_executor_submit() {
+    object_observer observer;
+    const size_t task_count = 1'024;
+    auto executor = make_io_uring_executor();
+    executor_shutdowner shutdown(executor);
+
+    std::vector<result<size_t>> results;
+    results.resize(task_count);
+
+    for (size_t i = 0; i < task_count; i++) {
+        results[i] = executor->submit(observer.get_testing_stub(i));
+    }
+
+    for (size_t i = 0; i < task_count; i++) {
+        assert_equal(results[i].get(), i);
+    }
+}
+
+void concurrencpp::tests::test_io_uring_executor_null_resume_executor() {
+    auto executor = make_io_uring_executor();
+    executor_shutdowner shutdown(executor);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [executor] {
+            executor->timeout({}, std::chrono::milliseconds(1));
+        },
+        concurrencpp::details::consts::k_io_uring_executor_null_resume_executor_err_msg);
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [executor] {
+            std::byte buffer[8];
+            executor->read({}, 0, buffer, 0);
+        },
+        concurrencpp::details::consts::k_io_uring_executor_null_resume_executor_err_msg);
+}
+
+void concurrencpp::tests::test_io_uring_executor_file_operations() {
+    auto executor = make_io_uring_executor();
+    executor_shutdowner shutdown(executor);
+    temp_file file;
+
+    auto write_then_read = [](std::shared_ptr<io_uring_executor> executor, std::string path) -> result<std::string> {
+        const auto fd = co_await executor->openat(executor, AT_FDCWD, path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+        assert_true(fd >= 0);
+
+        const auto content = make_bytes("hello, io_uring!");
+        const auto written = co_await executor->write(executor, fd, content, 0);
+        assert_equal(written, content.size());
+
+        co_await executor->fsync(executor, fd);
+
+        std::vector<std::byte> buffer(64);
+        const auto read = co_await executor->read(executor, fd, buffer, 7);
+        ::close(fd);
+
+        co_return std::string(reinterpret_cast<const char*>(buffer.data()), read);
+    };
+
+    assert_equal(write_then_read(executor, file.path()).get(), std::string("io_uring!"));
+}
+
+void concurrencpp::tests::test_io_uring_executor_readv() {
+    auto executor = make_io_uring_executor();
+    executor_shutdowner shutdown(executor);
+    temp_file file;
+
+    const auto fd = ::open(file.path().c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    assert_not_equal(fd, -1);
+
+    const std::string_view content = "0123456789";
+    assert_equal(::write(fd, content.data(), content.size()), static_cast<ssize_t>(content.size()));
+
+    char first[4] = {}, second[6] = {};
+    iovec buffers[2] = {{first, sizeof(first)}, {second, sizeof(second)}};
+
+    auto readv = [](std::shared_ptr<io_uring_executor> executor, int fd, std::span<const iovec> buffers) -> result<size_t> {
+        co_return co_await executor->readv(executor, fd, buffers, 0);
+    };
+
+    assert_equal(readv(executor, fd, buffers).get(), content.size());
+    assert_equal(std::string_view(first, sizeof(first)), std::string_view("0123"));
+    assert_equal(std::string_view(second, sizeof(second)), std::string_view("456789"));
+
+    ::close(fd);
+}
+
+void concurrencpp::tests::test_io_uring_executor_timeout() {
+    auto executor = make_io_uring_executor();
+    executor_shutdowner shutdown(executor);
+
+    auto timeout = [](std::shared_ptr<io_uring_executor> executor) -> result<std::chrono::milliseconds> {
+        const auto before = std::chrono::steady_clock::now();
+        co_await executor->timeout(executor, std::chrono::milliseconds(150));
+        co_return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - before);
+    };
+
+    const auto elapsed = timeout(executor).get();
+    assert_bigger_equal(elapsed, std::chrono::milliseconds(150));
+    assert_smaller(elapsed, std::chrono::seconds(5));
+}
+
+void concurrencpp::tests::test_io_uring_executor_socket_operations() {
+    auto executor = make_io_uring_executor();
+    executor_shutdowner shutdown(executor);
+    socket_pair sockets;
+
+    auto echo = [](std::shared_ptr<io_uring_executor> executor, int listener, int client) -> result<std::string> {
+        const auto server = co_await executor->accept(executor, listener);
+        assert_true(server >= 0);
+
+        const auto message = make_bytes("ping");
+        const auto sent = co_await executor->send(executor, client, message);
+        assert_equal(sent, message.size());
+
+        std::byte buffer[16];
+        const auto received = co_await executor->recv(executor, server, buffer);
+        ::close(server);
+
+        co_return std::string(reinterpret_cast<const char*>(buffer), received);
+    };
+
+    assert_equal(echo(executor, sockets.listener, sockets.client).get(), std::string("ping"));
+}
+
+void concurrencpp::tests::test_io_uring_executor_operation_error() {
+    auto executor = make_io_uring_executor();
+    executor_shutdowner shutdown(executor);
+
+    auto read_bad_fd = [](std::shared_ptr<io_uring_executor> executor) -> result<size_t> {
+        std::byte buffer[8];
+        co_return co_await executor->read(executor, -1, buffer, 0);
+    };
+
+    try {
+        read_bad_fd(executor).get();
+    } catch (const std::system_error& error) {
+        assert_equal(error.code().value(), EBADF);
+        return;
+    }
+
+    assert_false(true);
+}
+
+void concurrencpp::tests::test_io_uring_executor_resume_executor() {
+    auto executor = make_io_uring_executor();
+    executor_shutdowner shutdown0(executor);
+
+    auto resume_executor = std::make_shared<worker_thread_executor>();
+    executor_shutdowner shutdown1(resume_executor);
+
+    const auto resume_thread_id = resume_executor->submit([] {
+                                                      return concurrencpp::details::thread::get_current_virtual_id();
+                                                  })
+                                      .get();
+
+    auto timeout = [](std::shared_ptr<io_uring_executor> executor, std::shared_ptr<worker_thread_executor> resume_executor) -> result<size_t> {
+        co_await executor->timeout(resume_executor, std::chrono::milliseconds(1));
+        co_return concurrencpp::details::thread::get_current_virtual_id();
+    };
+
+    assert_equal(timeout(executor, resume_executor).get(), resume_thread_id);
+}
+
+void concurrencpp::tests::test_io_uring_executor_many_operations() {
+    constexpr size_t operation_count = 2'048;  // more than the ring can hold at once
+
+    auto executor = make_io_uring_executor();
+    executor_shutdowner shutdown(executor);
+    temp_file file;
+
+    const auto fd = ::open(file.path().c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    assert_not_equal(fd, -1);
+
+    std::vector<uint32_t> values(operation_count);
+    std::iota(values.begin(), values.end(), 0);
+
+    auto write_value = [](std::shared_ptr<io_uring_executor> executor, int fd, uint32_t* value) -> result<size_t> {
+        const auto bytes = std::as_bytes(std::span<uint32_t>(value, 1));
+        co_return co_await executor->write(executor, fd, bytes, *value * sizeof(uint32_t));
+    };
+
+    std::vector<result<size_t>> results;
+    for (auto& value : values) {
+        results.emplace_back(write_value(executor, fd, &value));
+    }
+
+    for (auto& result : results) {
+        assert_equal(result.get(), sizeof(uint32_t));
+    }
+
+    std::vector<uint32_t> file_values(operation_count);
+    const auto size = static_cast<ssize_t>(operation_count * sizeof(uint32_t));
+    assert_equal(::pread(fd, file_values.data(), size, 0), size);
+    assert_equal(file_values, values);
+
+    ::close(fd);
+}
+
+void concurrencpp::tests::test_io_uring_executor_thread_callbacks() {
+    test_thread_callbacks(
+        [](auto thread_started_callback, auto thread_terminated_callback) {
+            return std::make_shared<io_uring_executor>(256, thread_started_callback, thread_terminated_callback);
+        },
+        concurrencpp::details::make_executor_worker_name(concurrencpp::details::consts::k_io_uring_executor_name));
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    if (!static_cast<bool>(make_io_uring_executor())) {
+        std::cout << "io_uring is not available on this machine, skipping io_uring_executor test." << std::endl;
+        return 0;
+    }
+
+    tester tester("io_uring_executor test");
+
+    tester.add_step("name", test_io_uring_executor_name);
+    tester.add_step("shutdown", test_io_uring_executor_shutdown);
+    tester.add_step("max_concurrency_level", test_io_uring_executor_max_concurrency_level);
+    tester.add_step("post", test_io_uring_executor_post);
+    tester.add_step("submit", test_io_uring_executor_submit);
+    tester.add_step("null resume executor", test_io_uring_executor_null_resume_executor);
+    tester.add_step("openat + write + fsync + read", test_io_uring_executor_file_operations);
+    tester.add_step("readv", test_io_uring_executor_readv);
+    tester.add_step("timeout", test_io_uring_executor_timeout);
+    tester.add_step("accept + send + recv", test_io_uring_executor_socket_operations);
+    tester.add_step("operation error", test_io_uring_executor_operation_error);
+    tester.add_step("resume executor", test_io_uring_executor_resume_executor);
+    tester.add_step("many operations", test_io_uring_executor_many_operations);
+    tester.add_step("thread_callbacks", test_io_uring_executor_thread_callbacks);
+
+    tester.launch_test();
+    return 0;
+}
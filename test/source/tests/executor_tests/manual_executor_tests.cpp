@@ -7,6 +7,10 @@
 #include "utils/test_ready_result.h"
 #include "utils/executor_shutdowner.h"
 
+#if defined(CRCPP_HAS_EVENTFD)
+#    include <poll.h>
+#endif
+
 namespace concurrencpp::tests {
     void test_manual_executor_name();
 
@@ -40,12 +44,19 @@ namespace concurrencpp::tests {
     void test_manual_executor_loop_once_for();
     void test_manual_executor_loop_once_until();
 
+    void test_manual_executor_loop_throwing_task();
+    void test_manual_executor_loop_shutdown_mid_batch();
     void test_manual_executor_loop();
     void test_manual_executor_loop_for();
     void test_manual_executor_loop_until();
+    void test_manual_executor_loop_for_duration();
 
     void test_manual_executor_clear();
 
+#if defined(CRCPP_HAS_EVENTFD)
+    void test_manual_executor_event_fd();
+#endif
+
     void test_manual_executor_wait_for_task();
     void test_manual_executor_wait_for_task_for();
     void test_manual_executor_wait_for_task_until();
@@ -765,7 +776,86 @@ void concurrencpp::tests::test_manual_executor_loop_once_until() {
     }
 }
 
+void concurrencpp::tests::test_manual_executor_loop_throwing_task() {
+    object_observer observer;
+    auto executor = std::make_shared<concurrencpp::manual_executor>();
+    executor_shutdowner shutdown(executor);
+
+    std::vector<result<size_t>> results;
+    for (size_t i = 0; i < 10; i++) {
+        results.emplace_back(executor->submit(observer.get_testing_stub(i)));
+    }
+
+    executor->enqueue(concurrencpp::task([] {
+        throw std::runtime_error("task failed");
+    }));
+
+    for (size_t i = 10; i < 20; i++) {
+        results.emplace_back(executor->submit(observer.get_testing_stub(i)));
+    }
+
+    // the tasks after the throwing one were dequeued in the same batch, they must be put back in order
+    assert_throws_with_error_message<std::runtime_error>(
+        [executor] {
+            executor->loop(100);
+        },
+        "task failed");
+
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(10));
+    assert_equal(executor->size(), static_cast<size_t>(10));
+
+    assert_equal(executor->loop_once(), true);
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(11));
+    assert_equal(observer.get_execution_map().size(), static_cast<size_t>(1));
+
+    assert_equal(executor->loop(100), static_cast<size_t>(9));
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(20));
+
+    for (size_t i = 0; i < results.size(); i++) {
+        assert_equal(results[i].get(), i);
+    }
+}
+
+void concurrencpp::tests::test_manual_executor_loop_shutdown_mid_batch() {
+    object_observer observer;
+    auto executor = std::make_shared<concurrencpp::manual_executor>();
+
+    std::vector<result<size_t>> results;
+    for (size_t i = 0; i < 10; i++) {
+        results.emplace_back(executor->submit(observer.get_testing_stub(i)));
+    }
+
+    executor->post([executor] {
+        executor->shutdown();
+    });
+
+    for (size_t i = 10; i < 20; i++) {
+        results.emplace_back(executor->submit(observer.get_testing_stub(i)));
+    }
+
+    assert_throws<errors::runtime_shutdown>([executor] {
+        executor->loop(100);
+    });
+
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(10));
+
+    for (size_t i = 0; i < 10; i++) {
+        assert_equal(results[i].get(), i);
+    }
+
+    for (size_t i = 10; i < 20; i++) {
+        assert_throws<errors::broken_task>([&results, i] {
+            results[i].get();
+        });
+    }
+
+    assert_equal(observer.get_destruction_count(), static_cast<size_t>(20));
+}
+
 void concurrencpp::tests::test_manual_executor_loop() {
+    test_manual_executor_loop_throwing_task();
+    test_manual_executor_loop_shutdown_mid_batch();
+
     object_observer observer;
     const size_t task_count = 1'024;
     auto executor = std::make_shared<concurrencpp::manual_executor>();
@@ -999,6 +1089,109 @@ void concurrencpp::tests::test_manual_executor_loop_until() {
     }
 }
 
+void concurrencpp::tests::test_manual_executor_loop_for_duration() {
+    // an empty executor returns immediately
+    {
+        auto executor = std::make_shared<concurrencpp::manual_executor>();
+        executor_shutdowner shutdown(executor);
+
+        const auto before = high_resolution_clock::now();
+        assert_equal(executor->loop_for_duration(seconds(10)), static_cast<size_t>(0));
+        assert_smaller_equal(high_resolution_clock::now() - before, milliseconds(5));
+    }
+
+    // a zero budget executes nothing
+    {
+        object_observer observer;
+        auto executor = std::make_shared<concurrencpp::manual_executor>();
+        executor_shutdowner shutdown(executor);
+
+        executor->post(observer.get_testing_stub());
+        assert_equal(executor->loop_for_duration(milliseconds(0)), static_cast<size_t>(0));
+        assert_equal(executor->size(), static_cast<size_t>(1));
+    }
+
+    // everything that fits in the budget is executed, including tasks that are enqueued by executed tasks
+    {
+        object_observer observer;
+        const size_t task_count = 100'000;
+        auto executor = std::make_shared<concurrencpp::manual_executor>();
+        executor_shutdowner shutdown(executor);
+
+        for (size_t i = 0; i < task_count; i++) {
+            executor->post(observer.get_testing_stub());
+        }
+
+        executor->post([executor, stub = observer.get_testing_stub()]() mutable {
+            executor->post(std::move(stub));
+        });
+
+        assert_equal(executor->loop_for_duration(seconds(30)), task_count + 2);
+        assert_equal(observer.get_execution_count(), task_count + 1);
+        assert_true(executor->empty());
+        assert_executed_locally(observer.get_execution_map());
+    }
+
+    // tasks that don't fit in the budget are put back, in order
+    {
+        object_observer observer;
+        const size_t task_count = 20;
+        auto executor = std::make_shared<concurrencpp::manual_executor>();
+        executor_shutdowner shutdown(executor);
+
+        std::vector<result<size_t>> results;
+        for (size_t i = 0; i < task_count; i++) {
+            results.emplace_back(executor->submit([i, stub = observer.get_testing_stub(i)]() mutable {
+                std::this_thread::sleep_for(milliseconds(10));
+                return stub();
+            }));
+        }
+
+        const auto before = high_resolution_clock::now();
+        const auto executed = executor->loop_for_duration(milliseconds(45));
+        const auto elapsed = high_resolution_clock::now() - before;
+
+        assert_bigger_equal(executed, static_cast<size_t>(1));
+        assert_smaller(executed, task_count);
+        assert_smaller_equal(elapsed, milliseconds(45 + 10 + 50));
+        assert_equal(executor->size(), task_count - executed);
+
+        assert_equal(executor->loop(task_count), task_count - executed);
+        for (size_t i = 0; i < task_count; i++) {
+            assert_equal(results[i].get(), i);
+        }
+    }
+
+    // loop_for stops in the middle of a batch as well
+    {
+        object_observer observer;
+        const size_t task_count = 20;
+        auto executor = std::make_shared<concurrencpp::manual_executor>();
+        executor_shutdowner shutdown(executor);
+
+        for (size_t i = 0; i < task_count; i++) {
+            executor->post([stub = observer.get_testing_stub()]() mutable {
+                std::this_thread::sleep_for(milliseconds(10));
+                stub();
+            });
+        }
+
+        const auto executed = executor->loop_for(task_count, milliseconds(45));
+        assert_smaller(executed, task_count);
+        assert_equal(executor->size(), task_count - executed);
+    }
+
+    // if shutdown was requested, the function throws
+    {
+        auto executor = std::make_shared<concurrencpp::manual_executor>();
+        executor->shutdown();
+
+        assert_throws<errors::runtime_shutdown>([executor] {
+            executor->loop_for_duration(seconds(1));
+        });
+    }
+}
+
 void concurrencpp::tests::test_manual_executor_clear() {
     object_observer observer;
     const size_t task_count = 100;
@@ -1030,6 +1223,81 @@ void concurrencpp::tests::test_manual_executor_clear() {
     assert_equal(executor->clear(), static_cast<size_t>(0));
 }
 
+#if defined(CRCPP_HAS_EVENTFD)
+namespace concurrencpp::tests {
+    bool is_readable(int fd) {
+        pollfd poll_fd {fd, POLLIN, 0};
+        const auto res = ::poll(&poll_fd, 1, 0);
+        assert_not_equal(res, -1);
+        return res == 1 && (poll_fd.revents & POLLIN) != 0;
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_manual_executor_event_fd() {
+    object_observer observer;
+    auto executor = std::make_shared<concurrencpp::manual_executor>();
+
+    // tasks that were enqueued before the eventfd was created are reported as well
+    executor->post(observer.get_testing_stub());
+
+    const auto fd = executor->event_fd();
+    assert_not_equal(fd, -1);
+    assert_equal(executor->event_fd(), fd);
+    assert_true(is_readable(fd));
+
+    assert_equal(executor->loop(100), static_cast<size_t>(1));
+    assert_false(is_readable(fd));
+
+    for (size_t i = 0; i < 10; i++) {
+        executor->post(observer.get_testing_stub());
+    }
+
+    assert_true(is_readable(fd));
+
+    // partially drained - the eventfd stays readable
+    assert_equal(executor->loop(4), static_cast<size_t>(4));
+    assert_true(is_readable(fd));
+
+    assert_equal(executor->loop_for(6, std::chrono::milliseconds(10)), static_cast<size_t>(6));
+    assert_false(is_readable(fd));
+
+    executor->post(observer.get_testing_stub());
+    assert_true(is_readable(fd));
+    assert_equal(executor->clear(), static_cast<size_t>(1));
+    assert_false(is_readable(fd));
+
+    // drives the executor from a poll loop running in another thread
+    std::thread looper([executor, fd] {
+        try {
+            while (true) {
+                pollfd poll_fd {fd, POLLIN, 0};
+                ::poll(&poll_fd, 1, -1);
+                executor->loop(16);
+            }
+        } catch (const errors::runtime_shutdown&) {
+            // shutdown makes the eventfd readable, so the loop can exit
+        }
+    });
+
+    for (size_t i = 0; i < 1'000; i++) {
+        executor->post(observer.get_testing_stub());
+        if (i % 100 == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    assert_true(observer.wait_execution_count(1'000 + 11, std::chrono::seconds(30)));
+
+    executor->shutdown();
+    looper.join();
+
+    assert_true(is_readable(fd));
+    assert_throws<errors::runtime_shutdown>([executor] {
+        executor->event_fd();
+    });
+}
+#endif
+
 void concurrencpp::tests::test_manual_executor_wait_for_task() {
     // case 1: tasks already exist
     {
@@ -1543,6 +1811,7 @@ int main() {
     tester.add_step("loop", test_manual_executor_loop);
     tester.add_step("loop_for", test_manual_executor_loop_for);
     tester.add_step("loop_until", test_manual_executor_loop_until);
+    tester.add_step("loop_for_duration", test_manual_executor_loop_for_duration);
     tester.add_step("wait_for_task", test_manual_executor_wait_for_task);
     tester.add_step("wait_for_task_for", test_manual_executor_wait_for_task_for);
     tester.add_step("wait_for_task_until", test_manual_executor_wait_for_task_until);
@@ -1551,6 +1820,10 @@ int main() {
     tester.add_step("wait_for_tasks_until", test_manual_executor_wait_for_tasks_until);
     tester.add_step("clear", test_manual_executor_clear);
 
+#if defined(CRCPP_HAS_EVENTFD)
+    tester.add_step("event_fd", test_manual_executor_event_fd);
+#endif
+
     tester.launch_test();
     return 0;
 }
\ No newline at end of file
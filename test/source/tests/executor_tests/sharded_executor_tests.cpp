@@ -0,0 +1,326 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/object_observer.h"
+#include "utils/test_ready_result.h"
+
+#include <thread>
+#include <string>
+#include <algorithm>
+
+namespace concurrencpp::tests {
+    void test_sharded_executor_constructor();
+    void test_sharded_executor_shard_index();
+    void test_sharded_executor_post();
+    void test_sharded_executor_submit();
+    void test_sharded_executor_resume_on();
+    void test_sharded_executor_queue_depths();
+    void test_sharded_executor_shutdown();
+    void test_sharded_executor_thread_callbacks();
+}  // namespace concurrencpp::tests
+
+using concurrencpp::sharded_executor;
+
+namespace concurrencpp::tests {
+    std::thread::id shard_thread_id(sharded_executor& executor, size_t key) {
+        return executor
+            .submit(key,
+                    [] {
+                        return std::this_thread::get_id();
+                    })
+            .get();
+    }
+
+    concurrencpp::result<std::thread::id> resume_on_shard(sharded_executor& executor, size_t key) {
+        co_await executor.resume_on(key);
+        co_return std::this_thread::get_id();
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_sharded_executor_constructor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            sharded_executor executor(0);
+        },
+        concurrencpp::details::consts::k_sharded_executor_zero_shards_err_msg);
+
+    sharded_executor executor(4);
+    assert_equal(executor.shard_count(), static_cast<size_t>(4));
+    assert_false(executor.shutdown_requested());
+    assert_equal(executor.queue_depths(), std::vector<size_t>(4, 0));
+
+    // every shard is a thread of its own
+    std::vector<std::thread::id> ids;
+    for (size_t key = 0; ids.size() < 4; key++) {
+        const auto id = shard_thread_id(executor, key);
+        if (std::find(ids.begin(), ids.end(), id) == ids.end()) {
+            ids.emplace_back(id);
+        }
+    }
+
+    assert_not_equal(ids[0], std::this_thread::get_id());
+}
+
+void concurrencpp::tests::test_sharded_executor_shard_index() {
+    constexpr size_t key_count = 10'000;
+    constexpr size_t shard_count = 8;
+    sharded_executor executor(shard_count);
+
+    // sequential keys are spread evenly
+    std::vector<size_t> histogram(shard_count);
+    for (size_t key = 0; key < key_count; key++) {
+        const auto index = executor.shard_index(key);
+        assert_smaller(index, shard_count);
+        assert_equal(executor.shard_index(key), index);
+        ++histogram[index];
+    }
+
+    for (const auto count : histogram) {
+        assert_bigger(count, key_count / shard_count / 2);
+    }
+
+    // equal strings map to the same shard, whatever their type is
+    const std::string user_id = "user #1234";
+    assert_equal(executor.shard_index(user_id), executor.shard_index("user #1234"));
+    assert_equal(executor.shard_index(user_id), executor.shard_index(std::string_view(user_id)));
+    assert_equal(executor.shard(user_id), executor.shard("user #1234"));
+
+    // growing the shard count only moves keys to the new shard
+    for (size_t shards = 1; shards < 16; shards++) {
+        for (size_t key = 0; key < 1'000; key++) {
+            const auto hash = concurrencpp::details::shard_hash(key);
+            const auto before = concurrencpp::details::shard_index_of(hash, shards);
+            const auto after = concurrencpp::details::shard_index_of(hash, shards + 1);
+            assert_true(before == after || after == shards);
+        }
+    }
+}
+
+void concurrencpp::tests::test_sharded_executor_post() {
+    constexpr size_t producer_count = 4;
+    constexpr size_t key_count = 64;
+    constexpr size_t task_count = 500;
+
+    object_observer observer;
+    sharded_executor executor(4);
+
+    // per key state, only accessed by the shard of the key
+    struct key_state {
+        std::thread::id thread_id;
+        size_t expected_index[producer_count] = {};
+        bool same_thread = true, in_order = true;
+    };
+
+    std::vector<key_state> states(key_count);
+
+    std::vector<std::thread> producers;
+    for (size_t producer = 0; producer < producer_count; producer++) {
+        producers.emplace_back([&, producer] {
+            for (size_t i = 0; i < task_count; i++) {
+                for (size_t key = 0; key < key_count; key++) {
+                    executor.post(key, [&states, producer, key, i, stub = observer.get_testing_stub()]() mutable {
+                        auto& state = states[key];
+                        if (state.thread_id == std::thread::id()) {
+                            state.thread_id = std::this_thread::get_id();
+                        }
+
+                        state.same_thread &= (state.thread_id == std::this_thread::get_id());
+                        state.in_order &= (state.expected_index[producer] == i);
+                        state.expected_index[producer] = i + 1;
+                        stub();
+                    });
+                }
+            }
+        });
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    constexpr auto total = producer_count * key_count * task_count;
+    assert_true(observer.wait_execution_count(total, std::chrono::minutes(1)));
+    assert_true(observer.wait_destruction_count(total, std::chrono::minutes(1)));
+
+    for (size_t key = 0; key < key_count; key++) {
+        executor.submit(key, [] {}).get();  // synchronizes with the shard thread
+        assert_true(states[key].same_thread);
+        assert_true(states[key].in_order);
+        assert_equal(states[key].thread_id, shard_thread_id(executor, key));
+    }
+
+    // arguments are bound like executor::post does
+    std::atomic_int sum = 0;
+    executor.post(
+        7,
+        [&sum](int a, int b) {
+            sum += a + b;
+        },
+        1,
+        2);
+
+    executor.submit(7, [] {}).get();
+    assert_equal(sum.load(), 3);
+}
+
+void concurrencpp::tests::test_sharded_executor_submit() {
+    object_observer observer;
+    constexpr size_t task_count = 1'024;
+    sharded_executor executor(4);
+
+    std::vector<result<size_t>> results;
+    results.resize(task_count);
+
+    for (size_t i = 0; i < task_count; i++) {
+        results[i] = executor.submit(i, observer.get_testing_stub(i));
+    }
+
+    for (size_t i = 0; i < task_count; i++) {
+        assert_equal(results[i].get(), i);
+    }
+
+    auto sum = executor.submit(
+        "key",
+        [](int a, int b) {
+            return a + b;
+        },
+        1,
+        2);
+
+    assert_equal(sum.get(), 3);
+
+    constexpr intptr_t id = 12345;
+    auto result = executor.submit(1, [id] {
+        throw custom_exception(id);
+    });
+
+    result.wait();
+    test_ready_result_custom_exception(std::move(result), id);
+
+    assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
+}
+
+void concurrencpp::tests::test_sharded_executor_resume_on() {
+    sharded_executor executor(4);
+
+    for (size_t key = 0; key < 16; key++) {
+        assert_equal(resume_on_shard(executor, key).get(), shard_thread_id(executor, key));
+    }
+
+    assert_equal(executor.queue_depths(), std::vector<size_t>(4, 0));
+}
+
+void concurrencpp::tests::test_sharded_executor_queue_depths() {
+    constexpr size_t key = 42;
+    constexpr size_t task_count = 10;
+    sharded_executor executor(4);
+    const auto index = executor.shard_index(key);
+
+    std::atomic_bool started = false, release = false;
+    executor.post(key, [&] {
+        started = true;
+        while (!release) {
+            std::this_thread::yield();
+        }
+    });
+
+    while (!started) {
+        std::this_thread::yield();
+    }
+
+    for (size_t i = 0; i < task_count; i++) {
+        executor.post(key, [] {});
+    }
+
+    // a running task doesn't count, only the ones waiting behind it
+    auto expected = std::vector<size_t>(4, 0);
+    expected[index] = task_count;
+    assert_equal(executor.queue_depths(), expected);
+
+    release = true;
+    executor.submit(key, [] {}).get();
+    assert_equal(executor.queue_depths(), std::vector<size_t>(4, 0));
+}
+
+void concurrencpp::tests::test_sharded_executor_shutdown() {
+    constexpr size_t key = 1;
+    constexpr size_t task_count = 16;
+    object_observer observer;
+    sharded_executor executor(2);
+
+    executor.post(key, [] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    });
+
+    for (size_t i = 0; i < task_count; i++) {
+        executor.post(key, observer.get_testing_stub());
+    }
+
+    executor.shutdown();
+    assert_true(executor.shutdown_requested());
+    assert_true(executor.shard(key)->shutdown_requested());
+
+    // tasks that didn't run were destroyed, and are not counted anymore
+    assert_equal(observer.get_destruction_count(), task_count);
+    assert_equal(executor.queue_depths(), std::vector<size_t>(2, 0));
+
+    assert_throws<concurrencpp::errors::runtime_shutdown>([&] {
+        executor.post(key, [] {});
+    });
+
+    // like executor::submit, the result is broken instead
+    auto result = executor.submit("key", [] {});
+    assert_throws<concurrencpp::errors::broken_task>([&] {
+        result.get();
+    });
+
+    assert_equal(executor.queue_depths(), std::vector<size_t>(2, 0));
+
+    executor.shutdown();  // more than once
+}
+
+void concurrencpp::tests::test_sharded_executor_thread_callbacks() {
+    auto thread_started_callback_invoked = std::make_shared<std::atomic_size_t>(0);
+    auto thread_terminated_callback_invoked = std::make_shared<std::atomic_size_t>(0);
+
+    {
+        sharded_executor executor(
+            3,
+            [thread_started_callback_invoked](std::string_view thread_name) {
+                ++(*thread_started_callback_invoked);
+                assert_equal(thread_name, concurrencpp::details::make_executor_worker_name(
+                                              concurrencpp::details::consts::k_worker_thread_executor_name));
+            },
+            [thread_terminated_callback_invoked](std::string_view thread_name) {
+                ++(*thread_terminated_callback_invoked);
+                assert_equal(thread_name, concurrencpp::details::make_executor_worker_name(
+                                              concurrencpp::details::consts::k_worker_thread_executor_name));
+            });
+
+        for (size_t key = 0; key < 32; key++) {
+            executor.submit(key, [] {}).get();
+        }
+    }
+
+    assert_equal(thread_started_callback_invoked->load(), static_cast<size_t>(3));
+    assert_equal(thread_terminated_callback_invoked->load(), static_cast<size_t>(3));
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("sharded_executor test");
+
+    tester.add_step("constructor", test_sharded_executor_constructor);
+    tester.add_step("shard_index", test_sharded_executor_shard_index);
+    tester.add_step("post", test_sharded_executor_post);
+    tester.add_step("submit", test_sharded_executor_submit);
+    tester.add_step("resume_on", test_sharded_executor_resume_on);
+    tester.add_step("queue_depths", test_sharded_executor_queue_depths);
+    tester.add_step("shutdown", test_sharded_executor_shutdown);
+    tester.add_step("thread callbacks", test_sharded_executor_thread_callbacks);
+
+    tester.launch_test();
+    return 0;
+}
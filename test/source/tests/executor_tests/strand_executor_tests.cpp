@@ -0,0 +1,351 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/object_observer.h"
+#include "utils/test_ready_result.h"
+#include "utils/executor_shutdowner.h"
+
+#include <thread>
+
+namespace concurrencpp::tests {
+    void test_strand_executor_name();
+    void test_strand_executor_null_executor();
+    void test_strand_executor_max_concurrency_level();
+
+    void test_strand_executor_shutdown_method_access();
+    void test_strand_executor_shutdown_queued_tasks();
+    void test_strand_executor_shutdown_more_than_once();
+    void test_strand_executor_shutdown_underlying_executor();
+    void test_strand_executor_shutdown();
+
+    void test_strand_executor_post();
+    void test_strand_executor_submit();
+    void test_strand_executor_bulk_post();
+
+    void test_strand_executor_serialization();
+    void test_strand_executor_batching();
+    void test_strand_executor_task_exception();
+}  // namespace concurrencpp::tests
+
+using concurrencpp::strand_executor;
+
+void concurrencpp::tests::test_strand_executor_name() {
+    auto underlying = std::make_shared<concurrencpp::inline_executor>();
+    strand_executor executor(underlying);
+
+    assert_equal(executor.name, concurrencpp::details::consts::k_strand_executor_name);
+    assert_equal(executor.underlying_executor(), std::static_pointer_cast<concurrencpp::executor>(underlying));
+}
+
+void concurrencpp::tests::test_strand_executor_null_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            strand_executor executor({});
+        },
+        concurrencpp::details::consts::k_strand_executor_null_executor_err_msg);
+}
+
+void concurrencpp::tests::test_strand_executor_max_concurrency_level() {
+    strand_executor executor(std::make_shared<concurrencpp::inline_executor>());
+    assert_equal(executor.max_concurrency_level(), concurrencpp::details::consts::k_strand_executor_max_concurrency_level);
+}
+
+void concurrencpp::tests::test_strand_executor_shutdown_method_access() {
+    auto executor = std::make_shared<strand_executor>(std::make_shared<concurrencpp::inline_executor>());
+    assert_false(executor->shutdown_requested());
+
+    executor->shutdown();
+    assert_true(executor->shutdown_requested());
+    assert_false(executor->underlying_executor()->shutdown_requested());
+
+    assert_throws<concurrencpp::errors::runtime_shutdown>([executor] {
+        executor->enqueue(concurrencpp::task {});
+    });
+
+    assert_throws<concurrencpp::errors::runtime_shutdown>([executor] {
+        concurrencpp::task array[4];
+        std::span<concurrencpp::task> span = array;
+        executor->enqueue(span);
+    });
+}
+
+void concurrencpp::tests::test_strand_executor_shutdown_queued_tasks() {
+    constexpr size_t task_count = 100;
+
+    // a pending drain observes the shutdown and destroys the queued tasks instead of running them
+    {
+        object_observer observer;
+        auto underlying = std::make_shared<concurrencpp::manual_executor>();
+        executor_shutdowner underlying_shutdown(underlying);
+        strand_executor executor(underlying);
+
+        for (size_t i = 0; i < task_count; i++) {
+            executor.post(observer.get_testing_stub());
+        }
+
+        executor.shutdown();
+
+        assert_equal(underlying->loop(1), static_cast<size_t>(1));
+        assert_equal(observer.get_execution_count(), static_cast<size_t>(0));
+        assert_equal(observer.get_destruction_count(), task_count);
+    }
+
+    // a running drain finishes its current task and destroys the rest
+    {
+        object_observer observer;
+        auto underlying = std::make_shared<concurrencpp::worker_thread_executor>();
+        executor_shutdowner underlying_shutdown(underlying);
+        strand_executor executor(underlying);
+
+        std::atomic_bool started = false;
+        executor.post([&started] {
+            started = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(150));
+        });
+
+        for (size_t i = 0; i < task_count; i++) {
+            executor.post(observer.get_testing_stub());
+        }
+
+        while (!started) {
+            std::this_thread::yield();
+        }
+
+        executor.shutdown();
+
+        assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
+        assert_equal(observer.get_execution_count(), static_cast<size_t>(0));
+    }
+}
+
+void concurrencpp::tests::test_strand_executor_shutdown_more_than_once() {
+    strand_executor executor(std::make_shared<concurrencpp::inline_executor>());
+    for (size_t i = 0; i < 4; i++) {
+        executor.shutdown();
+    }
+}
+
+void concurrencpp::tests::test_strand_executor_shutdown_underlying_executor() {
+    object_observer observer;
+    auto underlying = std::make_shared<concurrencpp::worker_thread_executor>();
+    strand_executor executor(underlying);
+    underlying->shutdown();
+
+    assert_throws<concurrencpp::errors::runtime_shutdown>([&] {
+        executor.post(observer.get_testing_stub());
+    });
+
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(0));
+    assert_equal(observer.get_destruction_count(), static_cast<size_t>(1));
+
+    // the strand is not stuck: the next task tries to schedule a drain again
+    assert_throws<concurrencpp::errors::runtime_shutdown>([&] {
+        executor.post(observer.get_testing_stub());
+    });
+
+    assert_equal(observer.get_destruction_count(), static_cast<size_t>(2));
+    assert_false(executor.shutdown_requested());
+}
+
+void concurrencpp::tests::test_strand_executor_shutdown() {
+    test_strand_executor_shutdown_method_access();
+    test_strand_executor_shutdown_queued_tasks();
+    test_strand_executor_shutdown_more_than_once();
+    test_strand_executor_shutdown_underlying_executor();
+}
+
+void concurrencpp::tests::test_strand_executor_post() {
+    object_observer observer;
+    constexpr size_t task_count = 1'024;
+    auto underlying = std::make_shared<concurrencpp::thread_pool_executor>("tpe", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(underlying);
+    auto executor = std::make_shared<strand_executor>(underlying);
+
+    for (size_t i = 0; i < task_count / 2; i++) {
+        executor->post(observer.get_testing_stub());
+    }
+
+    // tasks posted from within the strand are queued behind the running batch
+    executor->post([executor, &observer] {
+        for (size_t i = 0; i < task_count / 2; i++) {
+            executor->post(observer.get_testing_stub());
+        }
+    });
+
+    assert_true(observer.wait_execution_count(task_count, std::chrono::minutes(1)));
+    assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
+}
+
+void concurrencpp::tests::test_strand_executor_submit() {
+    object_observer observer;
+    constexpr size_t task_count = 1'024;
+    auto underlying = std::make_shared<concurrencpp::thread_pool_executor>("tpe", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(underlying);
+    strand_executor executor(underlying);
+
+    std::vector<result<size_t>> results;
+    results.resize(task_count);
+
+    for (size_t i = 0; i < task_count; i++) {
+        results[i] = executor.submit(observer.get_testing_stub(i));
+    }
+
+    for (size_t i = 0; i < task_count; i++) {
+        assert_equal(results[i].get(), i);
+    }
+
+    constexpr intptr_t id = 12345;
+    auto result = executor.submit([id] {
+        throw custom_exception(id);
+    });
+
+    result.wait();
+    test_ready_result_custom_exception(std::move(result), id);
+
+    assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
+}
+
+void concurrencpp::tests::test_strand_executor_bulk_post() {
+    object_observer observer;
+    constexpr size_t task_count = 1'024;
+    auto underlying = std::make_shared<concurrencpp::thread_pool_executor>("tpe", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(underlying);
+    strand_executor executor(underlying);
+
+    std::vector<testing_stub> stubs;
+    stubs.reserve(task_count);
+
+    for (size_t i = 0; i < task_count; i++) {
+        stubs.emplace_back(observer.get_testing_stub());
+    }
+
+    executor.bulk_post<testing_stub>(stubs);
+
+    assert_true(observer.wait_execution_count(task_count, std::chrono::minutes(1)));
+    assert_true(observer.wait_destruction_count(task_count, std::chrono::minutes(1)));
+}
+
+void concurrencpp::tests::test_strand_executor_serialization() {
+    constexpr size_t producer_count = 4;
+    constexpr size_t task_count = 10'000;
+
+    auto underlying = std::make_shared<concurrencpp::thread_pool_executor>("tpe", 8, std::chrono::seconds(10));
+    executor_shutdowner shutdown(underlying);
+    auto executor = std::make_shared<strand_executor>(underlying);
+
+    // none of these are synchronized: the strand is the only thing that protects them
+    size_t executed = 0;
+    size_t expected_index[producer_count] = {};
+    bool in_order = true, in_strand = true;
+    std::atomic_size_t concurrent = 0, max_concurrent = 0;
+
+    std::vector<std::thread> producers;
+    for (size_t producer = 0; producer < producer_count; producer++) {
+        producers.emplace_back([&, producer] {
+            for (size_t i = 0; i < task_count; i++) {
+                executor->post([&, producer, i] {
+                    const auto now_running = concurrent.fetch_add(1) + 1;
+                    if (now_running > max_concurrent.load()) {
+                        max_concurrent.store(now_running);
+                    }
+
+                    in_order &= (expected_index[producer] == i);
+                    in_strand &= executor->running_in_this_thread();
+                    expected_index[producer] = i + 1;
+                    ++executed;
+
+                    concurrent.fetch_sub(1);
+                });
+            }
+        });
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    assert_false(executor->running_in_this_thread());
+
+    executor->submit([] {}).get();  // FIFO: everything posted before has run
+
+    assert_equal(executed, producer_count * task_count);
+    assert_true(in_order);
+    assert_true(in_strand);
+    assert_equal(max_concurrent.load(), static_cast<size_t>(1));
+}
+
+void concurrencpp::tests::test_strand_executor_batching() {
+    constexpr size_t batch_size = concurrencpp::details::consts::k_strand_executor_max_batch_size;
+    constexpr size_t task_count = batch_size * 2 + 10;
+
+    object_observer observer;
+    auto underlying = std::make_shared<concurrencpp::manual_executor>();
+    executor_shutdowner shutdown(underlying);
+    strand_executor executor(underlying);
+
+    for (size_t i = 0; i < task_count; i++) {
+        executor.post(observer.get_testing_stub());
+    }
+
+    // a single drain is scheduled no matter how many tasks are queued
+    assert_equal(underlying->size(), static_cast<size_t>(1));
+
+    assert_true(underlying->loop_once());
+    assert_equal(observer.get_execution_count(), batch_size);
+    assert_equal(underlying->size(), static_cast<size_t>(1));  // rescheduled itself for the rest
+
+    assert_true(underlying->loop_once());
+    assert_equal(observer.get_execution_count(), batch_size * 2);
+
+    assert_true(underlying->loop_once());
+    assert_equal(observer.get_execution_count(), task_count);
+    assert_equal(underlying->size(), static_cast<size_t>(0));
+
+    executor.post(observer.get_testing_stub());
+    assert_equal(underlying->size(), static_cast<size_t>(1));
+    assert_true(underlying->loop_once());
+    assert_equal(observer.get_execution_count(), task_count + 1);
+}
+
+void concurrencpp::tests::test_strand_executor_task_exception() {
+    object_observer observer;
+    auto underlying = std::make_shared<concurrencpp::manual_executor>();
+    executor_shutdowner shutdown(underlying);
+    strand_executor executor(underlying);
+
+    executor.enqueue(concurrencpp::task([] {
+        throw std::runtime_error("task exception");
+    }));
+
+    executor.post(observer.get_testing_stub());
+
+    // the exception ends the batch, and is swallowed like the one of any posted task
+    assert_true(underlying->loop_once());
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(0));
+
+    // the exception doesn't leave the strand stuck
+    assert_equal(underlying->size(), static_cast<size_t>(1));
+    assert_true(underlying->loop_once());
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(1));
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("strand_executor test");
+
+    tester.add_step("name", test_strand_executor_name);
+    tester.add_step("null executor", test_strand_executor_null_executor);
+    tester.add_step("max_concurrency_level", test_strand_executor_max_concurrency_level);
+    tester.add_step("shutdown", test_strand_executor_shutdown);
+    tester.add_step("post", test_strand_executor_post);
+    tester.add_step("submit", test_strand_executor_submit);
+    tester.add_step("bulk_post", test_strand_executor_bulk_post);
+    tester.add_step("serialization", test_strand_executor_serialization);
+    tester.add_step("batching", test_strand_executor_batching);
+    tester.add_step("task exception", test_strand_executor_task_exception);
+
+    tester.launch_test();
+    return 0;
+}
@@ -8,6 +8,8 @@
 #include "utils/executor_shutdowner.h"
 #include "utils/test_thread_callbacks.h"
 
+#include <latch>
+
 namespace concurrencpp::tests {
     void test_thread_executor_name();
 
@@ -40,6 +42,12 @@ namespace concurrencpp::tests {
 
     void test_thread_executor_thread_callbacks();
 
+    void test_thread_executor_thread_cache_reuse();
+    void test_thread_executor_thread_cache_dedicated_threads();
+    void test_thread_executor_thread_cache_idle_timeout();
+    void test_thread_executor_thread_cache_shutdown();
+    void test_thread_executor_thread_cache();
+
     void assert_unique_execution_threads(const std::unordered_map<size_t, size_t>& execution_map, const size_t expected_thread_count) {
         assert_equal(execution_map.size(), expected_thread_count);
 
@@ -384,6 +392,119 @@ void concurrencpp::tests::test_thread_executor_thread_callbacks() {
         concurrencpp::details::make_executor_worker_name(concurrencpp::details::consts::k_thread_executor_name));
 }
 
+void concurrencpp::tests::test_thread_executor_thread_cache_reuse() {
+    std::atomic_size_t threads_started = 0;
+    auto executor = std::make_shared<thread_executor>(std::chrono::seconds(30), [&threads_started](std::string_view) {
+        threads_started.fetch_add(1);
+    });
+    executor_shutdowner shutdown(executor);
+
+    const auto get_thread_id = [] {
+        return concurrencpp::details::thread::get_current_virtual_id();
+    };
+
+    const auto first_id = executor->submit(get_thread_id).get();
+
+    // the first thread is parked by now, or about to be
+    for (size_t i = 0; i < 10; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        assert_equal(executor->submit(get_thread_id).get(), first_id);
+    }
+
+    assert_equal(threads_started.load(), static_cast<size_t>(1));
+}
+
+void concurrencpp::tests::test_thread_executor_thread_cache_dedicated_threads() {
+    object_observer observer;
+    auto executor = std::make_shared<thread_executor>(std::chrono::seconds(30));
+    executor_shutdowner shutdown(executor);
+
+    // park a few threads first
+    executor->submit([] {}).get();
+    executor->submit([] {}).get();
+
+    // every task blocks until all of them have started, which only works if each one runs on its own thread
+    for (size_t round = 0; round < 3; round++) {
+        const size_t task_count = 16;
+        std::latch all_started(task_count);
+        std::vector<result<void>> results;
+
+        for (size_t i = 0; i < task_count; i++) {
+            results.emplace_back(executor->submit([&all_started, stub = observer.get_testing_stub()]() mutable {
+                all_started.arrive_and_wait();
+                stub();
+            }));
+        }
+
+        for (auto& result : results) {
+            result.get();
+        }
+    }
+
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(16 * 3));
+}
+
+void concurrencpp::tests::test_thread_executor_thread_cache_idle_timeout() {
+    std::atomic_size_t threads_started = 0, threads_terminated = 0;
+    auto executor = std::make_shared<thread_executor>(
+        std::chrono::milliseconds(50),
+        [&threads_started](std::string_view) {
+            threads_started.fetch_add(1);
+        },
+        [&threads_terminated](std::string_view) {
+            threads_terminated.fetch_add(1);
+        });
+    executor_shutdowner shutdown(executor);
+
+    executor->submit([] {}).get();
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    assert_equal(threads_started.load(), static_cast<size_t>(1));
+    assert_equal(threads_terminated.load(), static_cast<size_t>(1));
+
+    // a new thread is spawned once the idle one has expired
+    executor->submit([] {}).get();
+    assert_equal(threads_started.load(), static_cast<size_t>(2));
+}
+
+void concurrencpp::tests::test_thread_executor_thread_cache_shutdown() {
+    object_observer observer;
+    auto executor = std::make_shared<thread_executor>(std::chrono::minutes(10));
+
+    for (size_t i = 0; i < 8; i++) {
+        executor->submit([] {}).get();
+    }
+
+    for (size_t i = 0; i < 8; i++) {
+        executor->post([stub = observer.get_testing_stub()]() mutable {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            stub();
+        });
+    }
+
+    // parked threads don't wait for their idle time to pass, ongoing tasks are joined
+    const auto before = std::chrono::high_resolution_clock::now();
+    executor->shutdown();
+    const auto elapsed = std::chrono::high_resolution_clock::now() - before;
+
+    assert_smaller(elapsed, std::chrono::seconds(10));
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(8));
+    assert_equal(observer.get_destruction_count(), static_cast<size_t>(8));
+}
+
+void concurrencpp::tests::test_thread_executor_thread_cache() {
+    test_thread_executor_thread_cache_reuse();
+    test_thread_executor_thread_cache_dedicated_threads();
+    test_thread_executor_thread_cache_idle_timeout();
+    test_thread_executor_thread_cache_shutdown();
+
+    test_thread_callbacks(
+        [](auto thread_started_callback, auto thread_terminated_callback) {
+            return std::make_shared<thread_executor>(std::chrono::seconds(30), thread_started_callback, thread_terminated_callback);
+        },
+        concurrencpp::details::make_executor_worker_name(concurrencpp::details::consts::k_thread_executor_name));
+}
+
 using namespace concurrencpp::tests;
 
 int main() {
@@ -397,6 +518,7 @@ int main() {
     tester.add_step("bulk_post", test_thread_executor_bulk_post);
     tester.add_step("bulk_submit", test_thread_executor_bulk_submit);
     tester.add_step("thread_callbacks", test_thread_executor_thread_callbacks);
+    tester.add_step("thread cache", test_thread_executor_thread_cache);
 
     tester.launch_test();
     return 0;
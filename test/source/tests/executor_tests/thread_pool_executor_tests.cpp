@@ -38,6 +38,9 @@ namespace concurrencpp::tests {
 
     void test_thread_pool_executor_enqueue_algorithm();
     void test_thread_pool_executor_dynamic_resizing();
+    void test_thread_pool_executor_enqueue_to_idle_worker();
+    void test_thread_pool_executor_current_worker_index();
+    void test_thread_pool_executor_enqueue_cross_pool();
 
     void test_thread_pool_executor_thread_callbacks();
 }  // namespace concurrencpp::tests
@@ -563,6 +566,119 @@ void concurrencpp::tests::test_thread_pool_executor_thread_callbacks() {
         concurrencpp::details::make_executor_worker_name(thread_pool_name));
 }
 
+void concurrencpp::tests::test_thread_pool_executor_enqueue_to_idle_worker() {
+    object_observer observer;
+    auto executor = std::make_shared<thread_pool_executor>("threadpool", 1, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    assert_true(executor->has_idle_workers());
+
+    auto wc = std::make_shared<std::counting_semaphore<>>(0);
+    task blocking_task([wc, stub = observer.get_testing_stub()]() mutable {
+        wc->acquire();
+        stub();
+    });
+
+    assert_true(executor->enqueue_to_idle_worker(blocking_task));
+    assert_false(static_cast<bool>(blocking_task));
+
+    // the only worker is now busy: the task is left untouched
+    assert_false(executor->has_idle_workers());
+
+    task other_task([stub = observer.get_testing_stub()]() mutable {
+        stub();
+    });
+
+    assert_false(executor->enqueue_to_idle_worker(other_task));
+    assert_true(static_cast<bool>(other_task));
+
+    other_task();
+    assert_equal(observer.get_execution_count(), static_cast<size_t>(1));
+
+    wc->release();
+    observer.wait_execution_count(2, std::chrono::seconds(20));
+
+    // called from a worker of another pool, whose worker index must not be mistaken for one of this pool
+    auto other_executor = std::make_shared<thread_pool_executor>("threadpool1", 1, std::chrono::seconds(10));
+    executor_shutdowner other_shutdown(other_executor);
+
+    while (!executor->has_idle_workers()) {
+        std::this_thread::yield();  // the worker marks itself idle only after the blocking task returns
+    }
+
+    const auto enqueued = other_executor
+                              ->submit([executor, stub = observer.get_testing_stub()]() mutable {
+                                  task idle_worker_task(std::move(stub));
+                                  return executor->enqueue_to_idle_worker(idle_worker_task);
+                              })
+                              .get();
+
+    assert_true(enqueued);
+    assert_true(observer.wait_execution_count(3, std::chrono::seconds(20)));
+}
+
+void concurrencpp::tests::test_thread_pool_executor_current_worker_index() {
+    auto executor0 = std::make_shared<thread_pool_executor>("threadpool0", 4, std::chrono::seconds(10));
+    auto executor1 = std::make_shared<thread_pool_executor>("threadpool1", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown0(executor0);
+    executor_shutdowner shutdown1(executor1);
+
+    assert_equal(executor0->current_worker_index(), static_cast<size_t>(-1));
+
+    const auto indices = executor0
+                             ->submit([executor0, executor1] {
+                                 return std::make_pair(executor0->current_worker_index(), executor1->current_worker_index());
+                             })
+                             .get();
+
+    assert_true(indices.first < static_cast<size_t>(4));
+    assert_equal(indices.second, static_cast<size_t>(-1));
+}
+
+void concurrencpp::tests::test_thread_pool_executor_enqueue_cross_pool() {
+    // a worker of another pool is a foreign thread: tasks it posts must not end up in its own queue,
+    // otherwise a worker that blocks on them deadlocks
+    auto executor0 = std::make_shared<thread_pool_executor>("threadpool0", 1, std::chrono::seconds(10));
+    auto executor1 = std::make_shared<thread_pool_executor>("threadpool1", 1, std::chrono::seconds(10));
+    executor_shutdowner shutdown0(executor0);
+    executor_shutdowner shutdown1(executor1);
+
+    auto single = executor0->submit([executor1] {
+        auto result = executor1->submit([] {
+            return 12345;
+        });
+
+        if (result.wait_for(std::chrono::seconds(10)) != result_status::value) {
+            return 0;
+        }
+
+        return result.get();
+    });
+
+    assert_equal(single.get(), 12345);
+
+    auto bulk = executor0->submit([executor1] {
+        std::vector<std::function<int()>> tasks(8, [] {
+            return 1;
+        });
+
+        auto results = executor1->bulk_submit<std::function<int()>>(tasks);
+
+        auto sum = 0;
+        for (auto& result : results) {
+            if (result.wait_for(std::chrono::seconds(10)) != result_status::value) {
+                return 0;
+            }
+
+            sum += result.get();
+        }
+
+        return sum;
+    });
+
+    assert_equal(bulk.get(), 8);
+}
+
 using namespace concurrencpp::tests;
 
 int main() {
@@ -576,6 +692,9 @@ int main() {
     tester.add_step("bulk_submit", test_thread_pool_executor_bulk_submit);
     tester.add_step("enqueuing algorithm", test_thread_pool_executor_enqueue_algorithm);
     tester.add_step("dynamic resizing", test_thread_pool_executor_dynamic_resizing);
+    tester.add_step("enqueue_to_idle_worker", test_thread_pool_executor_enqueue_to_idle_worker);
+    tester.add_step("current_worker_index", test_thread_pool_executor_current_worker_index);
+    tester.add_step("cross-pool enqueue", test_thread_pool_executor_enqueue_cross_pool);
     tester.add_step("thread_callbacks", test_thread_pool_executor_thread_callbacks);
 
     tester.launch_test();
@@ -0,0 +1,371 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+
+#include <cstring>
+#include <filesystem>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace concurrencpp::tests {
+    void test_async_file_open_null_executor();
+    void test_async_file_open_invalid_alignment();
+    void test_async_file_open_missing_file();
+    void test_async_file_open_runtime();
+    void test_async_file_open();
+
+    void test_async_file_empty();
+
+    void test_async_file_read_write_at_impl(std::shared_ptr<executor> executor);
+    void test_async_file_read_write_at();
+
+    void test_async_file_read_chunks_impl(std::shared_ptr<executor> executor, size_t file_size, size_t chunk_size, size_t read_ahead);
+    void test_async_file_read_chunks_abandoned();
+    void test_async_file_read_chunks_invalid_chunk_size();
+    void test_async_file_read_chunks();
+
+    void test_async_file_allocate_buffer();
+    void test_async_file_direct_io();
+}  // namespace concurrencpp::tests
+
+using concurrencpp::async_file;
+using concurrencpp::async_file_options;
+
+namespace concurrencpp::tests {
+    class temp_file {
+
+       private:
+        std::filesystem::path m_path;
+
+       public:
+        explicit temp_file(const std::filesystem::path& directory = std::filesystem::temp_directory_path()) {
+            const auto suffix = std::to_string(::getpid()) + "_" + std::to_string(reinterpret_cast<uintptr_t>(this));
+            m_path = directory / ("concurrencpp_async_file_test_" + suffix);
+        }
+
+        ~temp_file() noexcept {
+            std::error_code ec;
+            std::filesystem::remove(m_path, ec);
+        }
+
+        std::string path() const {
+            return m_path.string();
+        }
+    };
+
+    std::vector<std::byte> make_content(size_t size) {
+        std::vector<std::byte> content(size);
+        for (size_t i = 0; i < size; i++) {
+            content[i] = static_cast<std::byte>((i * 31 + i / 251) & 0xFF);
+        }
+
+        return content;
+    }
+
+    void write_file(const std::string& path, std::span<const std::byte> content) {
+        const auto fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+        assert_not_equal(fd, -1);
+        assert_equal(::write(fd, content.data(), content.size()), static_cast<ssize_t>(content.size()));
+        ::close(fd);
+    }
+
+    result<std::vector<std::byte>> collect_chunks(async_file file, size_t chunk_size) {
+        std::vector<std::byte> content;
+        auto chunks = file.read_chunks(chunk_size);
+        for (auto it = co_await chunks.begin(); it != chunks.end(); co_await ++it) {
+            assert_smaller_equal(it->size(), chunk_size);
+            content.insert(content.end(), it->begin(), it->end());
+        }
+
+        co_return content;
+    }
+
+    std::vector<std::shared_ptr<executor>> make_backends(runtime& runtime) {
+        std::vector<std::shared_ptr<executor>> backends {runtime.background_executor()};
+
+#if defined(CRCPP_HAS_IO_URING)
+        try {
+            backends.emplace_back(std::make_shared<io_uring_executor>());
+        } catch (const std::system_error&) {
+            // io_uring is not available here
+        }
+#endif
+
+        return backends;
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_file_open_null_executor() {
+    assert_throws_with_error_message<std::invalid_argument>(
+        [] {
+            async_file::open({}, "file", O_RDONLY);
+        },
+        concurrencpp::details::consts::k_async_file_open_null_executor_err_msg);
+}
+
+void concurrencpp::tests::test_async_file_open_invalid_alignment() {
+    runtime runtime;
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&runtime] {
+            async_file_options options;
+            options.alignment = 1000;
+            async_file::open(runtime.background_executor(), "file", O_RDONLY, options);
+        },
+        concurrencpp::details::consts::k_async_file_invalid_alignment_err_msg);
+}
+
+void concurrencpp::tests::test_async_file_open_missing_file() {
+    runtime runtime;
+    for (auto& executor : make_backends(runtime)) {
+        const auto path = (std::filesystem::temp_directory_path() / "concurrencpp_no_such_directory" / "file").string();
+
+        try {
+            async_file::open(executor, path, O_RDONLY).get();
+            assert_false(true);
+        } catch (const std::system_error& error) {
+            assert_equal(error.code().value(), ENOENT);
+        }
+
+        executor->shutdown();
+    }
+}
+
+void concurrencpp::tests::test_async_file_open_runtime() {
+    runtime runtime;
+    temp_file temp;
+    const auto content = make_content(10'000);
+    write_file(temp.path(), content);
+
+    // the file is served by the background executor of runtime
+    auto file = async_file::open(runtime, temp.path(), O_RDONLY).get();
+    assert_true(static_cast<bool>(file));
+
+    std::vector<std::byte> read(content.size());
+    const auto read_bytes = file.read_at(0, read).get();
+    assert_equal(read_bytes, content.size());
+    assert_equal(read, content);
+}
+
+void concurrencpp::tests::test_async_file_open() {
+    test_async_file_open_null_executor();
+    test_async_file_open_invalid_alignment();
+    test_async_file_open_missing_file();
+    test_async_file_open_runtime();
+}
+
+void concurrencpp::tests::test_async_file_empty() {
+    async_file file;
+    assert_false(static_cast<bool>(file));
+    assert_equal(file.native_handle(), -1);
+
+    std::byte buffer[8];
+
+    assert_throws_with_error_message<errors::empty_object>(
+        [&] {
+            file.read_at(0, buffer);
+        },
+        concurrencpp::details::consts::k_async_file_read_at_empty_err_msg);
+
+    assert_throws_with_error_message<errors::empty_object>(
+        [&] {
+            file.write_at(0, buffer);
+        },
+        concurrencpp::details::consts::k_async_file_write_at_empty_err_msg);
+
+    assert_throws_with_error_message<errors::empty_object>(
+        [&] {
+            file.read_chunks(8);
+        },
+        concurrencpp::details::consts::k_async_file_read_chunks_empty_err_msg);
+
+    assert_throws_with_error_message<errors::empty_object>(
+        [&] {
+            file.allocate_buffer(8);
+        },
+        concurrencpp::details::consts::k_async_file_allocate_buffer_empty_err_msg);
+}
+
+void concurrencpp::tests::test_async_file_read_write_at_impl(std::shared_ptr<executor> executor) {
+    temp_file temp;
+    const auto content = make_content(100'000);
+
+    auto file = async_file::open(executor, temp.path(), O_RDWR | O_CREAT | O_TRUNC).get();
+    assert_true(static_cast<bool>(file));
+    assert_not_equal(file.native_handle(), -1);
+
+    // written out of order, in two halves
+    const auto half = content.size() / 2;
+    const auto second = std::span<const std::byte>(content).subspan(half);
+    const auto first = std::span<const std::byte>(content).first(half);
+
+    assert_equal(file.write_at(half, second).get(), second.size());
+    assert_equal(file.write_at(0, first).get(), first.size());
+
+    std::vector<std::byte> read_back(content.size() + 100);
+    const auto read = file.read_at(0, read_back).get();
+    assert_equal(read, content.size());  // short read: end of file
+    read_back.resize(read);
+    assert_equal(read_back, content);
+
+    std::byte middle[10];
+    assert_equal(file.read_at(12'345, middle).get(), std::size(middle));
+    assert_true(std::memcmp(middle, content.data() + 12'345, std::size(middle)) == 0);
+
+    assert_equal(file.read_at(content.size() + 10, middle).get(), static_cast<size_t>(0));
+
+    file.close();
+    assert_false(static_cast<bool>(file));
+}
+
+void concurrencpp::tests::test_async_file_read_write_at() {
+    runtime runtime;
+    for (auto& executor : make_backends(runtime)) {
+        test_async_file_read_write_at_impl(executor);
+        executor->shutdown();
+    }
+}
+
+void concurrencpp::tests::test_async_file_read_chunks_impl(std::shared_ptr<executor> executor,
+                                                           size_t file_size,
+                                                           size_t chunk_size,
+                                                           size_t read_ahead) {
+    temp_file temp;
+    const auto content = make_content(file_size);
+    write_file(temp.path(), content);
+
+    async_file_options options;
+    options.read_ahead = read_ahead;
+
+    auto file = async_file::open(executor, temp.path(), O_RDONLY, options).get();
+    assert_equal(collect_chunks(std::move(file), chunk_size).get(), content);
+}
+
+void concurrencpp::tests::test_async_file_read_chunks_abandoned() {
+    runtime runtime;
+    temp_file temp;
+    write_file(temp.path(), make_content(1'000'000));
+
+    auto first_chunk = [](async_file file) -> result<size_t> {
+        auto chunks = file.read_chunks(4'096);
+        auto it = co_await chunks.begin();
+        co_return it->size();  // the rest of the reads are still in flight when the stream is destroyed
+    };
+
+    for (size_t i = 0; i < 64; i++) {
+        auto file = async_file::open(runtime.background_executor(), temp.path(), O_RDONLY).get();
+        assert_equal(first_chunk(std::move(file)).get(), static_cast<size_t>(4'096));
+    }
+}
+
+void concurrencpp::tests::test_async_file_read_chunks_invalid_chunk_size() {
+    runtime runtime;
+    temp_file temp;
+    write_file(temp.path(), make_content(10));
+
+    auto file = async_file::open(runtime.background_executor(), temp.path(), O_RDONLY).get();
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&] {
+            file.read_chunks(0);
+        },
+        concurrencpp::details::consts::k_async_file_read_chunks_invalid_chunk_size_err_msg);
+}
+
+void concurrencpp::tests::test_async_file_read_chunks() {
+    runtime runtime;
+    for (auto& executor : make_backends(runtime)) {
+        test_async_file_read_chunks_impl(executor, 0, 4'096, 4);
+        test_async_file_read_chunks_impl(executor, 100, 4'096, 4);
+        test_async_file_read_chunks_impl(executor, 64 * 1'024, 4'096, 1);
+        test_async_file_read_chunks_impl(executor, 1'000'003, 65'536, 4);
+        test_async_file_read_chunks_impl(executor, 1'000'003, 1'000, 16);
+        executor->shutdown();
+    }
+
+    test_async_file_read_chunks_abandoned();
+    test_async_file_read_chunks_invalid_chunk_size();
+}
+
+void concurrencpp::tests::test_async_file_allocate_buffer() {
+    runtime runtime;
+    temp_file temp;
+
+    async_file_options options;
+    options.alignment = 512;
+
+    auto file = async_file::open(runtime.background_executor(), temp.path(), O_RDWR | O_CREAT, options).get();
+
+    std::byte* data = nullptr;
+
+    {
+        auto buffer = file.allocate_buffer(8'192);
+        assert_true(static_cast<bool>(buffer));
+        assert_equal(buffer.size(), static_cast<size_t>(8'192));
+        assert_equal(reinterpret_cast<uintptr_t>(buffer.data()) % options.alignment, static_cast<uintptr_t>(0));
+        data = buffer.data();
+    }
+
+    // freed buffers are reused
+    auto buffer = file.allocate_buffer(8'192);
+    assert_equal(buffer.data(), data);
+
+    auto moved = std::move(buffer);
+    assert_false(static_cast<bool>(buffer));
+    assert_equal(moved.data(), data);
+
+    // a buffer can outlive the file it was allocated from
+    file.close();
+    moved = {};
+}
+
+void concurrencpp::tests::test_async_file_direct_io() {
+    runtime runtime;
+
+    async_file_options options;
+    options.direct_io = true;
+
+    for (auto& executor : make_backends(runtime)) {
+        // not every file system supports O_DIRECT (tmpfs doesn't), try the working directory as well
+        for (const auto& directory : {std::filesystem::temp_directory_path(), std::filesystem::current_path()}) {
+            temp_file temp(directory);
+            const auto content = make_content(1'000'000);
+            write_file(temp.path(), content);
+
+            async_file file;
+            try {
+                file = async_file::open(executor, temp.path(), O_RDONLY, options).get();
+            } catch (const std::system_error& error) {
+                assert_equal(error.code().value(), EINVAL);
+                continue;
+            }
+
+            assert_throws_with_error_message<std::invalid_argument>(
+                [&] {
+                    file.read_chunks(1'000);
+                },
+                concurrencpp::details::consts::k_async_file_read_chunks_invalid_chunk_size_err_msg);
+
+            assert_equal(collect_chunks(std::move(file), 64 * 1'024).get(), content);
+        }
+
+        executor->shutdown();
+    }
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("async_file test");
+
+    tester.add_step("open", test_async_file_open);
+    tester.add_step("empty", test_async_file_empty);
+    tester.add_step("read_at + write_at", test_async_file_read_write_at);
+    tester.add_step("read_chunks", test_async_file_read_chunks);
+    tester.add_step("allocate_buffer", test_async_file_allocate_buffer);
+    tester.add_step("direct_io", test_async_file_direct_io);
+
+    tester.launch_test();
+    return 0;
+}
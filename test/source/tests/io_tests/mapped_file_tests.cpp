@@ -0,0 +1,344 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/executor_shutdowner.h"
+
+#include <mutex>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <filesystem>
+
+#include <unistd.h>
+
+namespace concurrencpp::tests {
+    void test_mapped_file_constructor_missing_file();
+    void test_mapped_file_constructor_empty_file();
+    void test_mapped_file_constructor();
+
+    void test_mapped_file_move_constructor();
+    void test_mapped_file_move_assignment();
+    void test_mapped_file_advise();
+
+    void test_parallel_for_each_line_null_executor();
+    void test_parallel_for_each_line_empty_object();
+    void test_parallel_for_each_line_empty_file();
+    void test_parallel_for_each_line_impl(std::string_view content, char delimiter, size_t chunk_size);
+    void test_parallel_for_each_line_chunking();
+    void test_parallel_for_each_line_long_lines();
+    void test_parallel_for_each_line_exception();
+    void test_parallel_for_each_line_zero_copy();
+    void test_parallel_for_each_line();
+}  // namespace concurrencpp::tests
+
+using concurrencpp::mapped_file;
+using concurrencpp::mapped_file_advice;
+
+namespace concurrencpp::tests {
+    class temp_file {
+
+       private:
+        std::filesystem::path m_path;
+
+       public:
+        explicit temp_file(std::string_view content) {
+            const auto suffix = std::to_string(::getpid()) + "_" + std::to_string(reinterpret_cast<uintptr_t>(this));
+            m_path = std::filesystem::temp_directory_path() / ("concurrencpp_mapped_file_test_" + suffix);
+
+            std::ofstream stream(m_path, std::ios::binary);
+            stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+        }
+
+        ~temp_file() noexcept {
+            std::error_code ec;
+            std::filesystem::remove(m_path, ec);
+        }
+
+        std::string path() const {
+            return m_path.string();
+        }
+    };
+
+    std::vector<std::string> split_lines(std::string_view content, char delimiter) {
+        std::vector<std::string> lines;
+        while (!content.empty()) {
+            const auto pos = content.find(delimiter);
+            if (pos == std::string_view::npos) {
+                lines.emplace_back(content);
+                break;
+            }
+
+            lines.emplace_back(content.substr(0, pos));
+            content.remove_prefix(pos + 1);
+        }
+
+        return lines;
+    }
+
+    std::string make_log(size_t line_count) {
+        std::string content;
+        for (size_t i = 0; i < line_count; i++) {
+            content += "line #" + std::to_string(i) + " " + std::string(i % 97, 'x') + "\n";
+        }
+
+        return content;
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_mapped_file_constructor_missing_file() {
+    const auto path = (std::filesystem::temp_directory_path() / "concurrencpp_no_such_directory" / "file").string();
+
+    try {
+        mapped_file file(path);
+        assert_false(true);
+    } catch (const std::system_error& error) {
+        assert_equal(error.code().value(), ENOENT);
+    }
+}
+
+void concurrencpp::tests::test_mapped_file_constructor_empty_file() {
+    temp_file temp("");
+    mapped_file file(temp.path());
+
+    assert_true(static_cast<bool>(file));
+    assert_equal(file.size(), static_cast<size_t>(0));
+    assert_true(file.view().empty());
+    assert_true(file.bytes().empty());
+
+    file.advise(mapped_file_advice::will_need);
+}
+
+void concurrencpp::tests::test_mapped_file_constructor() {
+    mapped_file empty;
+    assert_false(static_cast<bool>(empty));
+    assert_equal(empty.data(), static_cast<const char*>(nullptr));
+    assert_equal(empty.size(), static_cast<size_t>(0));
+
+    const auto content = make_log(1'000);
+    temp_file temp(content);
+
+    mapped_file file(temp.path());
+    assert_true(static_cast<bool>(file));
+    assert_equal(file.size(), content.size());
+    assert_equal(file.view(), std::string_view(content));
+    assert_equal(static_cast<const void*>(file.bytes().data()), static_cast<const void*>(file.data()));
+
+    test_mapped_file_constructor_missing_file();
+    test_mapped_file_constructor_empty_file();
+}
+
+void concurrencpp::tests::test_mapped_file_move_constructor() {
+    const auto content = make_log(100);
+    temp_file temp(content);
+
+    mapped_file file(temp.path());
+    const auto data = file.data();
+
+    mapped_file moved(std::move(file));
+    assert_false(static_cast<bool>(file));
+    assert_equal(file.data(), static_cast<const char*>(nullptr));
+    assert_true(static_cast<bool>(moved));
+    assert_equal(moved.data(), data);
+    assert_equal(moved.view(), std::string_view(content));
+}
+
+void concurrencpp::tests::test_mapped_file_move_assignment() {
+    const auto content0 = make_log(100), content1 = make_log(200);
+    temp_file temp0(content0), temp1(content1);
+
+    mapped_file file0(temp0.path()), file1(temp1.path());
+    const auto data = file1.data();
+
+    file0 = std::move(file1);
+    assert_false(static_cast<bool>(file1));
+    assert_equal(file0.data(), data);
+    assert_equal(file0.view(), std::string_view(content1));
+
+    file0 = mapped_file();
+    assert_false(static_cast<bool>(file0));
+}
+
+void concurrencpp::tests::test_mapped_file_advise() {
+    const auto content = make_log(10'000);
+    temp_file temp(content);
+    mapped_file file(temp.path());
+
+    // advice is a hint: unaligned and out of range requests are accepted
+    file.advise(mapped_file_advice::sequential);
+    file.advise(mapped_file_advice::will_need, 1, 5'000);
+    file.advise(mapped_file_advice::random, file.size() - 1, 1'000'000);
+    file.advise(mapped_file_advice::dont_need, file.size() + 100, 10);
+    file.advise(mapped_file_advice::normal);
+
+    assert_equal(file.view(), std::string_view(content));
+}
+
+void concurrencpp::tests::test_parallel_for_each_line_null_executor() {
+    mapped_file file;
+    assert_throws_with_error_message<std::invalid_argument>(
+        [&file] {
+            parallel_for_each_line({}, file, [](std::string_view) {});
+        },
+        concurrencpp::details::consts::k_parallel_for_each_line_null_executor_err_msg);
+}
+
+void concurrencpp::tests::test_parallel_for_each_line_empty_object() {
+    auto executor = std::make_shared<thread_pool_executor>("tpe", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    mapped_file file;
+    assert_throws_with_error_message<errors::empty_object>(
+        [&] {
+            parallel_for_each_line(executor, file, [](std::string_view) {});
+        },
+        concurrencpp::details::consts::k_parallel_for_each_line_empty_file_err_msg);
+}
+
+void concurrencpp::tests::test_parallel_for_each_line_empty_file() {
+    auto executor = std::make_shared<thread_pool_executor>("tpe", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    temp_file temp("");
+    mapped_file file(temp.path());
+
+    std::atomic_size_t calls = 0;
+    parallel_for_each_line(executor, file, [&calls](std::string_view) {
+        calls.fetch_add(1, std::memory_order_relaxed);
+    }).run().get();
+
+    assert_equal(calls.load(), static_cast<size_t>(0));
+}
+
+void concurrencpp::tests::test_parallel_for_each_line_impl(std::string_view content, char delimiter, size_t chunk_size) {
+    auto executor = std::make_shared<thread_pool_executor>("tpe", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    temp_file temp(content);
+    mapped_file file(temp.path());
+
+    std::mutex lock;
+    std::vector<std::string> lines;
+
+    parallel_for_each_line(
+        executor,
+        file,
+        [&](std::string_view line) {
+            std::unique_lock<std::mutex> guard(lock);
+            lines.emplace_back(line);
+        },
+        delimiter,
+        chunk_size)
+        .run()
+        .get();
+
+    auto expected = split_lines(content, delimiter);
+    std::sort(lines.begin(), lines.end());
+    std::sort(expected.begin(), expected.end());
+    assert_equal(lines, expected);
+}
+
+void concurrencpp::tests::test_parallel_for_each_line_chunking() {
+    const auto log = make_log(5'000);
+
+    for (const auto chunk_size : {0, 1, 2, 7, 64, 1'000, 100'000}) {
+        test_parallel_for_each_line_impl(log, '\n', chunk_size);
+        test_parallel_for_each_line_impl(log.substr(0, log.size() - 1), '\n', chunk_size);  // no trailing delimiter
+        test_parallel_for_each_line_impl("\n\na\n\nbc\n\n\nd", '\n', chunk_size);  // empty lines
+        test_parallel_for_each_line_impl("no delimiter at all", '\n', chunk_size);
+        test_parallel_for_each_line_impl("a;bb;;ccc;dddd\n;e", ';', chunk_size);
+    }
+}
+
+void concurrencpp::tests::test_parallel_for_each_line_long_lines() {
+    std::string content;
+    for (size_t i = 0; i < 10; i++) {
+        content += std::string(100'000 + i, static_cast<char>('a' + i));
+        content += '\n';
+        content += "short\n";
+    }
+
+    test_parallel_for_each_line_impl(content, '\n', 1'000);
+    test_parallel_for_each_line_impl(content, '\n', 0);
+}
+
+void concurrencpp::tests::test_parallel_for_each_line_exception() {
+    auto executor = std::make_shared<thread_pool_executor>("tpe", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    const auto log = make_log(10'000);
+    temp_file temp(log);
+    mapped_file file(temp.path());
+
+    assert_throws_with_error_message<std::runtime_error>(
+        [&] {
+            parallel_for_each_line(
+                executor,
+                file,
+                [](std::string_view line) {
+                    if (line.starts_with("line #5000 ")) {
+                        throw std::runtime_error("bad line");
+                    }
+                },
+                '\n',
+                1'024)
+                .run()
+                .get();
+        },
+        "bad line");
+}
+
+void concurrencpp::tests::test_parallel_for_each_line_zero_copy() {
+    auto executor = std::make_shared<thread_pool_executor>("tpe", 4, std::chrono::seconds(10));
+    executor_shutdowner shutdown(executor);
+
+    const auto log = make_log(10'000);
+    temp_file temp(log);
+    mapped_file file(temp.path());
+
+    const auto begin = file.data(), end = file.data() + file.size();
+    std::atomic_size_t outside = 0, bytes = 0;
+
+    parallel_for_each_line(
+        executor,
+        file,
+        [&](std::string_view line) {
+            if (line.data() < begin || line.data() + line.size() > end) {
+                outside.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            bytes.fetch_add(line.size() + 1, std::memory_order_relaxed);
+        },
+        '\n',
+        4'096)
+        .run()
+        .get();
+
+    assert_equal(outside.load(), static_cast<size_t>(0));
+    assert_equal(bytes.load(), file.size());
+}
+
+void concurrencpp::tests::test_parallel_for_each_line() {
+    test_parallel_for_each_line_null_executor();
+    test_parallel_for_each_line_empty_object();
+    test_parallel_for_each_line_empty_file();
+    test_parallel_for_each_line_chunking();
+    test_parallel_for_each_line_long_lines();
+    test_parallel_for_each_line_exception();
+    test_parallel_for_each_line_zero_copy();
+}
+
+using namespace concurrencpp::tests;
+
+int main() {
+    tester tester("mapped_file test");
+
+    tester.add_step("constructor", test_mapped_file_constructor);
+    tester.add_step("move constructor", test_mapped_file_move_constructor);
+    tester.add_step("move assignment", test_mapped_file_move_assignment);
+    tester.add_step("advise", test_mapped_file_advise);
+    tester.add_step("parallel_for_each_line", test_parallel_for_each_line);
+
+    tester.launch_test();
+    return 0;
+}
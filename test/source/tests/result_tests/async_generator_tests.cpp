@@ -0,0 +1,389 @@
+#include "concurrencpp/concurrencpp.h"
+
+#include "infra/tester.h"
+#include "infra/assertions.h"
+#include "utils/object_observer.h"
+#include "utils/test_generators.h"
+#include "utils/executor_shutdowner.h"
+
+using namespace concurrencpp::tests;
+
+namespace concurrencpp::tests {
+    void test_async_generator_move_constructor();
+    void test_async_generator_destructor();
+
+    void test_async_generator_next_empty();
+    void test_async_generator_next_exception();
+    template<class type>
+    void test_async_generator_next_impl();
+    void test_async_generator_next();
+
+    void test_async_generator_begin_empty();
+    void test_async_generator_begin_exception();
+    template<class type>
+    void test_async_generator_begin_end_impl();
+    void test_async_generator_begin_end();
+
+    void test_async_generator_iterator_operator_plus_plus_exception();
+    void test_async_generator_iterator_operator_plus_plus_ran_to_end();
+    void test_async_generator_iterator_operator_plus_plus();
+
+    void test_async_generator_iterator_dereferencing_operators();
+
+    void test_async_generator_co_await_inside_body();
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_generator_move_constructor() {
+    auto gen0 = []() -> async_generator<int> {
+        co_yield 1;
+    }();
+
+    assert_true(static_cast<bool>(gen0));
+
+    async_generator<int> gen1(std::move(gen0));
+    assert_false(static_cast<bool>(gen0));
+    assert_true(static_cast<bool>(gen1));
+}
+
+void concurrencpp::tests::test_async_generator_destructor() {
+    auto gen_fn = [](testing_stub stub) -> async_generator<int> {
+        co_yield 1;
+    };
+
+    object_observer observer;
+
+    {
+        auto gen0 = gen_fn(observer.get_testing_stub());
+        auto gen1(std::move(gen0));  // check to see that empty generator d.tor is benign
+    }
+
+    assert_equal(observer.get_destruction_count(), 1);
+
+    // a generator that is destroyed in the middle of its iteration destroys its frame
+    auto consume_one = [](async_generator<int> gen) -> result<void> {
+        co_await gen.next();
+    };
+
+    consume_one(gen_fn(observer.get_testing_stub())).get();
+    assert_equal(observer.get_destruction_count(), 2);
+}
+
+void concurrencpp::tests::test_async_generator_next_empty() {
+    auto gen0 = []() -> async_generator<int> {
+        co_yield 1;
+    }();
+
+    auto gen1(std::move(gen0));
+    assert_throws_with_error_message<errors::empty_generator>(
+        [&gen0] {
+            gen0.next();
+        },
+        concurrencpp::details::consts::k_empty_async_generator_next_err_msg);
+}
+
+void concurrencpp::tests::test_async_generator_next_exception() {
+    auto gen = []() -> async_generator<int> {
+        co_yield 0;
+        co_yield 1;
+        throw custom_exception(1234567);
+    }();
+
+    auto consume = [](async_generator<int>& gen) -> result<void> {
+        assert_equal(*(co_await gen.next()), 0);
+        assert_equal(*(co_await gen.next()), 1);
+
+        try {
+            co_await gen.next();
+        } catch (const custom_exception& e) {
+            assert_equal(e.id, 1234567);
+            co_return;
+        }
+
+        assert_false(true);
+    };
+
+    consume(gen).get();
+}
+
+template<class type>
+void concurrencpp::tests::test_async_generator_next_impl() {
+    value_gen<type> val_gen;
+    auto gen_fn = [](value_gen<type>& val_gen) -> async_generator<type> {
+        for (size_t i = 0; i < 1024; i++) {
+            co_yield val_gen.value_of(i);
+        }
+    };
+
+    auto consume = [](async_generator<type> gen, value_gen<type>& val_gen) -> result<size_t> {
+        size_t counter = 0;
+        while (const auto value = co_await gen.next()) {
+            if constexpr (std::is_reference_v<type>) {
+                assert_equal(value, &val_gen.value_of(counter));
+            } else {
+                assert_equal(*value, val_gen.value_of(counter));
+            }
+
+            counter++;
+        }
+
+        // a generator that ran to its end keeps returning nullptr
+        assert_equal(co_await gen.next(), nullptr);
+        co_return counter;
+    };
+
+    assert_equal(consume(gen_fn(val_gen), val_gen).get(), static_cast<size_t>(1024));
+}
+
+void concurrencpp::tests::test_async_generator_next() {
+    test_async_generator_next_empty();
+    test_async_generator_next_exception();
+    test_async_generator_next_impl<int>();
+    test_async_generator_next_impl<std::string>();
+    test_async_generator_next_impl<int&>();
+    test_async_generator_next_impl<std::string&>();
+}
+
+void concurrencpp::tests::test_async_generator_begin_empty() {
+    auto gen0 = []() -> async_generator<int> {
+        co_yield 1;
+    }();
+
+    auto gen1(std::move(gen0));
+    assert_throws_with_error_message<errors::empty_generator>(
+        [&gen0] {
+            gen0.begin();
+        },
+        concurrencpp::details::consts::k_empty_async_generator_begin_err_msg);
+}
+
+void concurrencpp::tests::test_async_generator_begin_exception() {
+    auto gen = []() -> async_generator<int> {
+        throw custom_exception(1234567);
+        co_yield 1;
+    }();
+
+    auto consume = [](async_generator<int>& gen) -> result<void> {
+        co_await gen.begin();
+    };
+
+    assert_throws<custom_exception>([&gen, &consume] {
+        consume(gen).get();
+    });
+}
+
+template<class type>
+void concurrencpp::tests::test_async_generator_begin_end_impl() {
+    value_gen<type> val_gen;
+    auto gen_fn = [](value_gen<type>& val_gen) -> async_generator<type> {
+        for (size_t i = 0; i < 1024; i++) {
+            co_yield val_gen.value_of(i);
+        }
+    };
+
+    auto consume = [](async_generator<type> gen, value_gen<type>& val_gen) -> result<size_t> {
+        size_t counter = 0;
+        auto it = co_await gen.begin();
+        while (it != gen.end()) {
+            if constexpr (std::is_reference_v<type>) {
+                assert_equal(&*it, &val_gen.value_of(counter));
+            } else {
+                assert_equal(*it, val_gen.value_of(counter));
+            }
+
+            counter++;
+            co_await ++it;
+        }
+
+        co_return counter;
+    };
+
+    assert_equal(consume(gen_fn(val_gen), val_gen).get(), static_cast<size_t>(1024));
+}
+
+void concurrencpp::tests::test_async_generator_begin_end() {
+    test_async_generator_begin_empty();
+    test_async_generator_begin_exception();
+    test_async_generator_begin_end_impl<int>();
+    test_async_generator_begin_end_impl<std::string>();
+    test_async_generator_begin_end_impl<int&>();
+    test_async_generator_begin_end_impl<std::string&>();
+}
+
+void concurrencpp::tests::test_async_generator_iterator_operator_plus_plus_exception() {
+    auto gen = []() -> async_generator<int> {
+        for (auto i = 0; i < 10; i++) {
+            if (i != 0 && i % 3 == 0) {
+                throw custom_exception(i);
+            }
+
+            co_yield i;
+        }
+    }();
+
+    auto consume = [](async_generator<int>& gen) -> result<void> {
+        auto gen_it = co_await gen.begin();  // i = 0
+        const auto end = gen.end();
+        assert_not_equal(gen_it, end);
+
+        auto& res0 = co_await ++gen_it;  // i = 1
+        assert_equal(&res0, &gen_it);
+        assert_not_equal(gen_it, end);
+
+        auto& res1 = co_await ++gen_it;  // i = 2
+        assert_equal(&res1, &gen_it);
+        assert_not_equal(gen_it, end);
+
+        try {
+            co_await ++gen_it;  // i = 3
+        } catch (const custom_exception& e) {
+            assert_equal(e.id, 3);
+            assert_equal(gen_it, end);
+            co_return;
+        }
+
+        assert_false(true);
+    };
+
+    consume(gen).get();
+}
+
+void concurrencpp::tests::test_async_generator_iterator_operator_plus_plus_ran_to_end() {
+    auto gen = []() -> async_generator<int> {
+        for (auto i = 0; i < 3; i++) {
+            co_yield i;
+        }
+    }();
+
+    auto consume = [](async_generator<int>& gen) -> result<void> {
+        auto gen_it = co_await gen.begin();  // i = 0
+        const auto end = gen.end();
+        assert_not_equal(gen_it, end);
+
+        auto& res0 = co_await ++gen_it;  // i = 1
+        assert_equal(&res0, &gen_it);
+        assert_not_equal(gen_it, end);
+
+        auto& res1 = co_await ++gen_it;  // i = 2
+        assert_equal(&res1, &gen_it);
+        assert_not_equal(gen_it, end);
+
+        auto& res2 = co_await ++gen_it;  // i = 3
+        assert_equal(&res2, &gen_it);
+        assert_equal(gen_it, end);
+    };
+
+    consume(gen).get();
+}
+
+void concurrencpp::tests::test_async_generator_iterator_operator_plus_plus() {
+    test_async_generator_iterator_operator_plus_plus_exception();
+    test_async_generator_iterator_operator_plus_plus_ran_to_end();
+}
+
+void concurrencpp::tests::test_async_generator_iterator_dereferencing_operators() {
+    struct dummy {
+        int i = 0;
+    };
+
+    dummy arr[6] = {};
+    auto gen = [](std::span<dummy> s) -> async_generator<dummy> {
+        int i = 0;
+        while (true) {
+            co_yield s[i % s.size()];
+            ++i;
+        }
+    }(arr);
+
+    auto consume = [](async_generator<dummy>& gen, std::span<dummy> arr) -> result<void> {
+        auto it = co_await gen.begin();
+        for (size_t i = 0; i < 100; i++) {
+            auto& ref = *it;
+            auto* ptr = &it->i;
+
+            auto& expected = arr[i % std::size(arr)];
+            assert_equal(&ref, &expected);
+            assert_equal(ptr, &expected.i);
+            co_await ++it;
+        }
+    };
+
+    consume(gen, arr).get();
+}
+
+namespace concurrencpp::tests {
+    async_generator<size_t> async_range(std::shared_ptr<executor> ex, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            // the value is produced asynchronously, inside ex
+            auto value = co_await ex->submit([i] {
+                return i * 2;
+            });
+
+            co_yield value;
+        }
+    }
+
+    result<std::vector<size_t>> collect(async_generator<size_t> gen) {
+        std::vector<size_t> values;
+        for (auto it = co_await gen.begin(); it != gen.end(); co_await ++it) {
+            values.emplace_back(*it);
+        }
+
+        co_return values;
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_async_generator_co_await_inside_body() {
+    constexpr size_t count = 1'024;
+
+    // a manual executor lets us observe that the consumer is suspended while the body waits
+    {
+        const auto ex = std::make_shared<manual_executor>();
+        executor_shutdowner es(ex);
+
+        auto result = collect(async_range(ex, 3));
+        assert_equal(result.status(), result_status::idle);
+
+        for (size_t i = 0; i < 3; i++) {
+            assert_equal(ex->size(), static_cast<size_t>(1));
+            assert_equal(result.status(), result_status::idle);
+            ex->loop_once();
+        }
+
+        assert_equal(result.get(), std::vector<size_t> {0, 2, 4});
+    }
+
+    {
+        runtime runtime;
+        const auto values = collect(async_range(runtime.thread_pool_executor(), count)).get();
+
+        assert_equal(values.size(), count);
+        for (size_t i = 0; i < count; i++) {
+            assert_equal(values[i], i * 2);
+        }
+    }
+}
+
+int main() {
+    {
+        tester tester("async_generator test");
+
+        tester.add_step("move constructor", test_async_generator_move_constructor);
+        tester.add_step("destructor", test_async_generator_destructor);
+        tester.add_step("next", test_async_generator_next);
+        tester.add_step("begin + end", test_async_generator_begin_end);
+        tester.add_step("co_await inside body", test_async_generator_co_await_inside_body);
+
+        tester.launch_test();
+    }
+
+    {
+        tester tester("async_generator_iterator test");
+
+        tester.add_step("operator ++it", test_async_generator_iterator_operator_plus_plus);
+        tester.add_step("operator *, operator ->", test_async_generator_iterator_dereferencing_operators);
+
+        tester.launch_test();
+    }
+
+    return 0;
+}
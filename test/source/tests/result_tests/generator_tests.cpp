@@ -26,6 +26,11 @@ namespace concurrencpp::tests {
 
     void test_generator_iterator_dereferencing_operators();
     void test_generator_iterator_comparison_operators();
+
+    void test_generator_span_yield_values();
+    void test_generator_span_yield_empty_span();
+    void test_generator_span_yield_exception();
+    void test_generator_span_yield();
 }  // namespace concurrencpp::tests
 
 void concurrencpp::tests::test_generator_move_constructor() {
@@ -281,6 +286,103 @@ void concurrencpp::tests::test_generator_iterator_comparison_operators() {
     }
 }
 
+void concurrencpp::tests::test_generator_span_yield_values() {
+    auto gen = []() -> generator<int> {
+        int block[8];
+        int value = 0;
+
+        // blocks of varying sizes, mixed with single values
+        for (size_t block_size = 1; block_size <= std::size(block); block_size++) {
+            for (size_t i = 0; i < block_size; i++) {
+                block[i] = value++;
+            }
+
+            co_yield std::span<int>(block, block_size);
+            co_yield value++;
+        }
+    };
+
+    int expected = 0;
+    for (auto& value : gen()) {
+        assert_equal(value, expected);
+        expected++;
+    }
+
+    assert_equal(expected, 8 * 9 / 2 + 8);
+
+    // values are not copied: the iterator walks the yielded block in place
+    std::array<std::string, 5> strings = {"a", "b", "c", "d", "e"};
+    auto ref_gen = [](std::span<std::string> s) -> generator<std::string> {
+        co_yield s;
+    }(strings);
+
+    auto it = ref_gen.begin();
+    for (size_t i = 0; i < strings.size(); i++) {
+        assert_not_equal(it, ref_gen.end());
+        assert_equal(&*it, &strings[i]);
+        assert_equal(it->size(), static_cast<size_t>(1));
+        it++;
+    }
+
+    assert_equal(it, ref_gen.end());
+}
+
+void concurrencpp::tests::test_generator_span_yield_empty_span() {
+    // an empty block is skipped without suspending
+    auto gen0 = []() -> generator<int> {
+        co_yield std::span<int>();
+        co_yield 1;
+        co_yield std::span<int>();
+        co_yield std::span<int>();
+        co_yield 2;
+        co_yield std::span<int>();
+    }();
+
+    std::vector<int> values;
+    for (auto value : gen0) {
+        values.emplace_back(value);
+    }
+
+    assert_equal(values, std::vector<int> {1, 2});
+
+    // a generator that only yields empty blocks is empty
+    auto gen1 = []() -> generator<int> {
+        co_yield std::span<int>();
+    }();
+
+    assert_equal(gen1.begin(), gen1.end());
+}
+
+void concurrencpp::tests::test_generator_span_yield_exception() {
+    auto gen = []() -> generator<int> {
+        int block[] = {0, 1, 2};
+        co_yield std::span<int>(block);
+        throw custom_exception(3);
+    }();
+
+    auto it = gen.begin();
+    assert_equal(*it, 0);
+
+    // the exception is thrown only once the block is exhausted
+    ++it;
+    assert_equal(*it, 1);
+
+    ++it;
+    assert_equal(*it, 2);
+
+    assert_throws<custom_exception>([&it] {
+        ++it;
+    });
+
+    assert_equal(it, gen.end());
+}
+
+void concurrencpp::tests::test_generator_span_yield() {
+    test_generator_span_yield_values();
+    test_generator_span_yield_empty_span();
+    test_generator_span_yield_exception();
+}
+
 int main() {
     {
         tester tester("generator test");
@@ -289,6 +391,7 @@ int main() {
         tester.add_step("destructor", test_generator_destructor);
         tester.add_step("begin", test_generator_begin);
         tester.add_step("begin + end", test_generator_begin_end);
+        tester.add_step("co_yield std::span", test_generator_span_yield);
 
         tester.launch_test();
     }
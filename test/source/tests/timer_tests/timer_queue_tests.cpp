@@ -12,7 +12,11 @@ using namespace std::chrono_literals;
 namespace concurrencpp::tests {
     void test_timer_queue_make_timer();
     void test_timer_queue_make_oneshot_timer();
+    void test_timer_queue_make_timers();
+    void test_timer_queue_make_one_shot_timers();
+    void test_timer_queue_cancel_timers();
     void test_timer_queue_make_delay_object();
+    void test_timer_queue_make_delay_awaitable();
     void test_timer_queue_max_worker_idle_time();
     void test_timer_queue_thread_injection();
     void test_timer_queue_thread_callbacks();
@@ -64,6 +68,150 @@ void concurrencpp::tests::test_timer_queue_make_oneshot_timer() {
         concurrencpp::details::consts::k_timer_queue_shutdown_err_msg);
 }
 
+void concurrencpp::tests::test_timer_queue_make_timers() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto inline_executor = std::make_shared<concurrencpp::inline_executor>();
+    assert_false(timer_queue->shutdown_requested());
+
+    auto empty_callback = [] {
+    };
+
+    using descriptor_type = concurrencpp::timer_descriptor<decltype(empty_callback)>;
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [timer_queue, inline_executor, empty_callback] {
+            std::vector<descriptor_type> descriptors {{100ms, 100ms, inline_executor, empty_callback},
+                                                      {100ms, 100ms, {}, empty_callback}};
+            timer_queue->make_timers(std::span(descriptors));
+        },
+        concurrencpp::details::consts::k_timer_queue_make_timers_executor_null_err_msg);
+
+    {
+        std::vector<descriptor_type> descriptors;
+        assert_true(timer_queue->make_timers(std::span(descriptors)).empty());
+        assert_true(timer_queue->make_timers(descriptors).empty());
+    }
+
+    // a vector is accepted as is
+    {
+        std::vector<descriptor_type> descriptors {{1000ms, 2000ms, inline_executor, empty_callback}};
+        auto timers = timer_queue->make_timers(descriptors);
+        assert_equal(timers.size(), static_cast<size_t>(1));
+        assert_equal(timers[0].get_due_time(), 1000ms);
+        assert_equal(timers[0].get_frequency(), 2000ms);
+    }
+
+    {
+        std::vector<descriptor_type> descriptors;
+        for (size_t i = 0; i < 16; i++) {
+            const auto due_time = std::chrono::milliseconds(1000 + i);
+            const auto frequency = std::chrono::milliseconds(2000 + i);
+            descriptors.push_back({due_time, frequency, inline_executor, empty_callback});
+        }
+
+        auto timers = timer_queue->make_timers(std::span(descriptors));
+        assert_equal(timers.size(), descriptors.size());
+
+        for (size_t i = 0; i < timers.size(); i++) {
+            assert_equal(timers[i].get_due_time(), std::chrono::milliseconds(1000 + i));
+            assert_equal(timers[i].get_frequency(), std::chrono::milliseconds(2000 + i));
+            assert_equal(timers[i].get_executor(), inline_executor);
+            assert_equal(timers[i].get_timer_queue().lock(), timer_queue);
+        }
+    }
+
+    timer_queue->shutdown();
+    assert_true(timer_queue->shutdown_requested());
+
+    assert_throws_with_error_message<errors::runtime_shutdown>(
+        [timer_queue, inline_executor, empty_callback] {
+            std::vector<descriptor_type> descriptors {{100ms, 100ms, inline_executor, empty_callback}};
+            timer_queue->make_timers(std::span(descriptors));
+        },
+        concurrencpp::details::consts::k_timer_queue_shutdown_err_msg);
+}
+
+void concurrencpp::tests::test_timer_queue_make_one_shot_timers() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto inline_executor = std::make_shared<concurrencpp::inline_executor>();
+    assert_false(timer_queue->shutdown_requested());
+
+    auto empty_callback = [] {
+    };
+
+    using descriptor_type = concurrencpp::one_shot_timer_descriptor<decltype(empty_callback)>;
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [timer_queue, empty_callback] {
+            std::vector<descriptor_type> descriptors {{100ms, {}, empty_callback}};
+            timer_queue->make_one_shot_timers(std::span(descriptors));
+        },
+        concurrencpp::details::consts::k_timer_queue_make_oneshot_timers_executor_null_err_msg);
+
+    {
+        std::vector<descriptor_type> descriptors;
+        for (size_t i = 0; i < 16; i++) {
+            descriptors.push_back({std::chrono::milliseconds(1000 + i), inline_executor, empty_callback});
+        }
+
+        auto timers = timer_queue->make_one_shot_timers(std::span(descriptors));
+        assert_equal(timers.size(), descriptors.size());
+
+        for (size_t i = 0; i < timers.size(); i++) {
+            assert_equal(timers[i].get_due_time(), std::chrono::milliseconds(1000 + i));
+            assert_equal(timers[i].get_frequency(), 0ms);
+            assert_equal(timers[i].get_executor(), inline_executor);
+            assert_equal(timers[i].get_timer_queue().lock(), timer_queue);
+        }
+    }
+
+    // a vector is accepted as is
+    {
+        std::vector<descriptor_type> descriptors {{1000ms, inline_executor, empty_callback}};
+        auto timers = timer_queue->make_one_shot_timers(descriptors);
+        assert_equal(timers.size(), static_cast<size_t>(1));
+        assert_equal(timers[0].get_due_time(), 1000ms);
+        assert_equal(timers[0].get_frequency(), 0ms);
+    }
+
+    timer_queue->shutdown();
+    assert_true(timer_queue->shutdown_requested());
+
+    assert_throws_with_error_message<errors::runtime_shutdown>(
+        [timer_queue, inline_executor, empty_callback] {
+            std::vector<descriptor_type> descriptors {{100ms, inline_executor, empty_callback}};
+            timer_queue->make_one_shot_timers(std::span(descriptors));
+        },
+        concurrencpp::details::consts::k_timer_queue_shutdown_err_msg);
+}
+
+void concurrencpp::tests::test_timer_queue_cancel_timers() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto other_timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto inline_executor = std::make_shared<concurrencpp::inline_executor>();
+
+    // empty timers are ignored
+    std::vector<concurrencpp::timer> timers(4);
+    timer_queue->cancel_timers(timers);
+
+    for (size_t i = 0; i < 8; i++) {
+        timers.emplace_back(timer_queue->make_timer(1min, 1min, inline_executor, [] {
+        }));
+    }
+
+    // timers of other timer queues are cancelled as well
+    for (size_t i = 0; i < 8; i++) {
+        timers.emplace_back(other_timer_queue->make_timer(1min, 1min, inline_executor, [] {
+        }));
+    }
+
+    timer_queue->cancel_timers(timers);
+
+    for (const auto& timer : timers) {
+        assert_false(static_cast<bool>(timer));
+    }
+}
+
 void concurrencpp::tests::test_timer_queue_make_delay_object() {
     auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
     assert_false(timer_queue->shutdown_requested());
@@ -85,6 +233,42 @@ void concurrencpp::tests::test_timer_queue_make_delay_object() {
         concurrencpp::details::consts::k_broken_task_exception_error_msg);
 }
 
+namespace concurrencpp::tests {
+    lazy_result<void> await_delay(std::shared_ptr<concurrencpp::timer_queue> timer_queue, std::shared_ptr<executor> executor) {
+        co_await timer_queue->make_delay_awaitable(100ms, executor);
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_timer_queue_make_delay_awaitable() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    assert_false(timer_queue->shutdown_requested());
+
+    assert_throws_with_error_message<std::invalid_argument>(
+        [timer_queue] {
+            timer_queue->make_delay_awaitable(100ms, {});
+        },
+        concurrencpp::details::consts::k_timer_queue_make_delay_awaitable_executor_null_err_msg);
+
+    // pending delays are interrupted when the timer_queue is shut down
+    auto inline_executor = std::make_shared<concurrencpp::inline_executor>();
+    auto pending = await_delay(timer_queue, inline_executor).run();
+
+    timer_queue->shutdown();
+    assert_true(timer_queue->shutdown_requested());
+
+    assert_throws_with_error_message<errors::broken_task>(
+        [&pending] {
+            pending.get();
+        },
+        concurrencpp::details::consts::k_broken_task_exception_error_msg);
+
+    assert_throws_with_error_message<errors::broken_task>(
+        [timer_queue, inline_executor] {
+            await_delay(timer_queue, inline_executor).run().get();
+        },
+        concurrencpp::details::consts::k_broken_task_exception_error_msg);
+}
+
 void concurrencpp::tests::test_timer_queue_max_worker_idle_time() {
     auto timer_queue = std::make_shared<concurrencpp::timer_queue>(1234567ms);
     assert_equal(timer_queue->max_worker_idle_time(), 1234567ms);
@@ -149,7 +333,11 @@ int main() {
 
     test.add_step("make_timer", test_timer_queue_make_timer);
     test.add_step("make_oneshot_timer", test_timer_queue_make_timer);
+    test.add_step("make_timers", test_timer_queue_make_timers);
+    test.add_step("make_one_shot_timers", test_timer_queue_make_one_shot_timers);
+    test.add_step("cancel_timers", test_timer_queue_cancel_timers);
     test.add_step("make_delay_object", test_timer_queue_make_delay_object);
+    test.add_step("make_delay_awaitable", test_timer_queue_make_delay_awaitable);
     test.add_step("max_worker_idle_time", test_timer_queue_max_worker_idle_time);
     test.add_step("thread_injection", test_timer_queue_thread_injection);
     test.add_step("thread_callbacks", test_timer_queue_thread_callbacks);
@@ -8,6 +8,7 @@
 #include "utils/throwing_executor.h"
 
 #include <chrono>
+#include <limits>
 
 using namespace std::chrono_literals;
 
@@ -36,8 +37,18 @@ namespace concurrencpp::tests {
     void test_timer_set_frequency_after_due_time();
     void test_timer_set_frequency();
 
+    void test_timer_drift();
+    void test_timer_missed_tick_policy_fire_once();
+    void test_timer_missed_tick_policy_fire_all();
+    void test_timer_missed_tick_policy_skip();
+    void test_timer_missed_tick_policy();
+
     void test_timer_oneshot_timer();
+    void test_timer_batch_timers();
     void test_timer_delay_object();
+    void test_timer_delay_awaitable_functionality();
+    void test_timer_delay_awaitable_destroyed_coroutine();
+    void test_timer_delay_awaitable();
 
     void test_timer_assignment_operator_empty_to_empty();
     void test_timer_assignment_operator_non_empty_to_non_empty();
@@ -199,9 +210,13 @@ namespace concurrencpp::tests {
             const auto recorded_due_time = calculate_due_time();
             interval_ok(recorded_due_time, m_due_time.count());
 
-            const auto intervals = calculate_frequencies();
-            for (auto tested_frequency : intervals) {
-                interval_ok(tested_frequency, m_frequency.count());
+            // periodic ticks are scheduled against absolute deadlines, a late tick doesn't delay the following ones.
+            const auto start_time = m_executor->get_start_time();
+            const auto fire_times = m_executor->flush_time_points();
+
+            for (size_t i = 0; i < fire_times.size(); i++) {
+                const auto offset = duration_cast<milliseconds>(fire_times[i] - start_time).count();
+                interval_ok(static_cast<size_t>(offset), m_due_time.count() + i * m_frequency.count());
             }
         }
 
@@ -538,6 +553,78 @@ void concurrencpp::tests::test_timer_set_frequency() {
     test_timer_set_frequency_after_due_time();
 }
 
+void concurrencpp::tests::test_timer_drift() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto ex = std::make_shared<concurrencpp::inline_executor>();
+    std::atomic_size_t invocation_count = 0;
+
+    // 200 ticks of 10ms: a timer re-armed relative to its processing time loses a tick every few beats.
+    auto timer = timer_queue->make_timer(10ms, 10ms, ex, [&invocation_count] {
+        invocation_count.fetch_add(1, std::memory_order_relaxed);
+    });
+
+    std::this_thread::sleep_for(2005ms);
+
+    const auto skipped_ticks = timer.get_skipped_ticks();
+    timer.cancel();
+
+    const auto tick_count = invocation_count.load() + skipped_ticks;
+    assert_bigger_equal(tick_count, static_cast<size_t>(198));
+    assert_smaller_equal(tick_count, static_cast<size_t>(201));
+}
+
+namespace concurrencpp::tests {
+    void test_timer_missed_tick_policy_impl(concurrencpp::missed_tick_policy policy, size_t min_skipped, size_t max_skipped) {
+        constexpr size_t invocations = 6;
+        auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+        auto ex = std::make_shared<concurrencpp::inline_executor>();
+        std::atomic_size_t invocation_count = 0;
+
+        // ticks are due every 100ms starting at 100ms. the first invocation blocks the timer_queue thread
+        // until ~450ms, so at least the ticks of 200ms, 300ms and 400ms are processed late, at the same time.
+        // a loaded machine can delay more ticks, so the skipped count is only bounded, not exact.
+        auto timer = timer_queue->make_timer(100ms, 100ms, policy, ex, [&invocation_count] {
+            if (invocation_count.fetch_add(1, std::memory_order_relaxed) == 0) {
+                std::this_thread::sleep_for(350ms);
+            }
+        });
+
+        assert_equal(timer.get_missed_tick_policy(), policy);
+
+        const auto deadline = high_resolution_clock::now() + 30s;
+        while (invocation_count.load(std::memory_order_relaxed) < invocations && high_resolution_clock::now() < deadline) {
+            std::this_thread::sleep_for(10ms);
+        }
+
+        const auto skipped_ticks = timer.get_skipped_ticks();
+        timer.cancel();
+
+        assert_bigger_equal(invocation_count.load(), invocations);
+        assert_bigger_equal(skipped_ticks, min_skipped);
+        assert_smaller_equal(skipped_ticks, max_skipped);
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_timer_missed_tick_policy_fire_once() {
+    // the three late ticks collapse into one invocation
+    test_timer_missed_tick_policy_impl(concurrencpp::missed_tick_policy::fire_once, 2, std::numeric_limits<size_t>::max());
+}
+
+void concurrencpp::tests::test_timer_missed_tick_policy_fire_all() {
+    test_timer_missed_tick_policy_impl(concurrencpp::missed_tick_policy::fire_all, 0, 0);
+}
+
+void concurrencpp::tests::test_timer_missed_tick_policy_skip() {
+    test_timer_missed_tick_policy_impl(concurrencpp::missed_tick_policy::skip, 3, std::numeric_limits<size_t>::max());
+}
+
+void concurrencpp::tests::test_timer_missed_tick_policy() {
+    test_timer_drift();
+    test_timer_missed_tick_policy_fire_once();
+    test_timer_missed_tick_policy_fire_all();
+    test_timer_missed_tick_policy_skip();
+}
+
 void concurrencpp::tests::test_timer_oneshot_timer() {
     timer_tester tester(150ms, 0ms);
     tester.start_once_timer_test();
@@ -547,6 +634,39 @@ void concurrencpp::tests::test_timer_oneshot_timer() {
     tester.test_oneshot_timer();
 }
 
+void concurrencpp::tests::test_timer_batch_timers() {
+    const size_t timer_count = 1'024;
+    object_observer fired_observer, cancelled_observer;
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto ex = std::make_shared<concurrencpp::inline_executor>();
+
+    using descriptor_type = concurrencpp::one_shot_timer_descriptor<concurrencpp::tests::testing_stub>;
+
+    std::vector<descriptor_type> fired_descriptors, cancelled_descriptors;
+    fired_descriptors.reserve(timer_count);
+    cancelled_descriptors.reserve(timer_count);
+
+    for (size_t i = 0; i < timer_count; i++) {
+        fired_descriptors.push_back({milliseconds(100 + i % 200), ex, fired_observer.get_testing_stub()});
+        cancelled_descriptors.push_back({2s, ex, cancelled_observer.get_testing_stub()});
+    }
+
+    auto fired_timers = timer_queue->make_one_shot_timers(std::span(fired_descriptors));
+    auto cancelled_timers = timer_queue->make_one_shot_timers(std::span(cancelled_descriptors));
+
+    timer_queue->cancel_timers(cancelled_timers);
+
+    for (const auto& timer : cancelled_timers) {
+        assert_false(static_cast<bool>(timer));
+    }
+
+    assert_true(fired_observer.wait_execution_count(timer_count, 1min));
+    assert_true(cancelled_observer.wait_destruction_count(timer_count, 1min));
+
+    std::this_thread::sleep_for(3s);
+    assert_equal(cancelled_observer.get_execution_count(), static_cast<size_t>(0));
+}
+
 void concurrencpp::tests::test_timer_delay_object() {
     auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
     auto wt_executor = std::make_shared<concurrencpp::worker_thread_executor>();
@@ -565,6 +685,96 @@ void concurrencpp::tests::test_timer_delay_object() {
     wt_executor->shutdown();
 }
 
+namespace concurrencpp::tests {
+    struct detached_coroutine {
+        struct promise_type {
+            detached_coroutine get_return_object() noexcept {
+                return {concurrencpp::details::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+
+            concurrencpp::details::suspend_never initial_suspend() const noexcept {
+                return {};
+            }
+
+            concurrencpp::details::suspend_always final_suspend() const noexcept {
+                return {};
+            }
+
+            void unhandled_exception() const noexcept {}
+            void return_void() const noexcept {}
+        };
+
+        concurrencpp::details::coroutine_handle<promise_type> handle;
+    };
+
+    detached_coroutine delay_and_mark(timer_queue& timer_queue, std::shared_ptr<executor> executor, std::atomic_bool& resumed) {
+        co_await timer_queue.make_delay_awaitable(100ms, executor);
+        resumed = true;
+    }
+
+    lazy_result<void> await_delay_awaitable(std::shared_ptr<timer_queue> timer_queue,
+                                            std::shared_ptr<executor> executor,
+                                            std::chrono::milliseconds due_time) {
+        co_await timer_queue->make_delay_awaitable(due_time, executor);
+    }
+}  // namespace concurrencpp::tests
+
+void concurrencpp::tests::test_timer_delay_awaitable_functionality() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto wt_executor = std::make_shared<concurrencpp::worker_thread_executor>();
+    const auto expected_interval = 150ms;
+
+    for (size_t i = 0; i < 15; i++) {
+        const auto before = high_resolution_clock::now();
+        await_delay_awaitable(timer_queue, wt_executor, expected_interval).run().get();
+        const auto after = high_resolution_clock::now();
+        const auto interval_ms = duration_cast<milliseconds>(after - before);
+        timer_tester::interval_ok(interval_ms.count(), expected_interval.count());
+    }
+
+    // delays with different due times resume independently of the order they were registered
+    std::vector<result<void>> results;
+    for (size_t i = 0; i < 10; i++) {
+        results.emplace_back(await_delay_awaitable(timer_queue, wt_executor, milliseconds(500 - i * 40)).run());
+    }
+
+    for (auto& result : results) {
+        result.get();
+    }
+
+    wt_executor->shutdown();
+}
+
+void concurrencpp::tests::test_timer_delay_awaitable_destroyed_coroutine() {
+    auto timer_queue = std::make_shared<concurrencpp::timer_queue>(120s);
+    auto executor = std::make_shared<concurrencpp::inline_executor>();
+
+    std::atomic_bool resumed[3] = {false, false, false};
+    detached_coroutine coroutines[3];
+
+    for (size_t i = 0; i < std::size(coroutines); i++) {
+        coroutines[i] = delay_and_mark(*timer_queue, executor, resumed[i]);
+    }
+
+    // destroying a suspended coroutine unlinks its delay from the timer_queue
+    coroutines[0].handle.destroy();
+    coroutines[2].handle.destroy();
+
+    std::this_thread::sleep_for(350ms);
+
+    assert_false(resumed[0]);
+    assert_true(resumed[1]);
+    assert_false(resumed[2]);
+
+    assert_true(coroutines[1].handle.done());
+    coroutines[1].handle.destroy();
+}
+
+void concurrencpp::tests::test_timer_delay_awaitable() {
+    test_timer_delay_awaitable_functionality();
+    test_timer_delay_awaitable_destroyed_coroutine();
+}
+
 void concurrencpp::tests::test_timer_assignment_operator_empty_to_empty() {
     concurrencpp::timer timer1, timer2;
     assert_false(static_cast<bool>(timer1));
@@ -665,8 +875,11 @@ int main() {
     test.add_step("cancel", test_timer_cancel);
     test.add_step("operator bool", test_timer_operator_bool);
     test.add_step("set_frequency", test_timer_set_frequency);
+    test.add_step("missed_tick_policy", test_timer_missed_tick_policy);
     test.add_step("oneshot_timer", test_timer_oneshot_timer);
+    test.add_step("batch timers", test_timer_batch_timers);
     test.add_step("delay_object", test_timer_delay_object);
+    test.add_step("delay_awaitable", test_timer_delay_awaitable);
     test.add_step("operator =", test_timer_assignment_operator);
 
     test.launch_test();